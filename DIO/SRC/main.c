@@ -0,0 +1,30 @@
+#include "stm32f10x.h"
+#include "stm32f10x_rcc.h"
+#include "stm32f10x_gpio.h"
+#include "Dio.h"
+#include "Tm.h"
+
+/* Chờ bận time ms theo DWT CYCCNT, không chiếm TIM2 */
+void delay(uint16_t time)
+{
+    Tm_BusyWaitUs(time * 1000U);
+}
+
+int main()
+{
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC, ENABLE);
+
+    GPIO_InitTypeDef gpio;
+    gpio.GPIO_Pin = GPIO_Pin_13;
+    gpio.GPIO_Mode = GPIO_Mode_Out_PP;
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(GPIOC, &gpio);
+
+    Tm_Init();
+
+    while (1)
+    {
+        DIO_FlipChannel(DIO_CHANNEL_C13);
+        delay(100);
+    }
+}
\ No newline at end of file
@@ -1,38 +0,0 @@
-#include "stm32f10x.h"
-#include "stm32f10x_rcc.h"
-#include "stm32f10x_gpio.h"
-#include "stm32f10x_tim.h"
-#include "Dio.h"
-
-void delay(uint16_t time)
-{
-    TIM_SetCounter(TIM2, 0);
-    while (TIM_GetCounter(TIM2) < time)
-        ;
-}
-
-int main()
-{
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC, ENABLE);
-    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
-
-    GPIO_InitTypeDef gpio;
-    gpio.GPIO_Pin = GPIO_Pin_13;
-    gpio.GPIO_Mode = GPIO_Mode_Out_PP;
-    gpio.GPIO_Speed = GPIO_Speed_50MHz;
-    GPIO_Init(GPIOC, &gpio);
-
-    TIM_TimeBaseInitTypeDef tim;
-    tim.TIM_ClockDivision = TIM_CKD_DIV1;
-    tim.TIM_CounterMode = TIM_CounterMode_Up;
-    tim.TIM_Period = 0xFFFF;
-    tim.TIM_Prescaler = 8000 - 1;
-    TIM_TimeBaseInit(TIM2, &tim);
-    TIM_Cmd(TIM2, ENABLE);
-
-    while (1)
-    {
-        DIO_FlipChannel(45);
-        delay(100);
-    }
-}
\ No newline at end of file
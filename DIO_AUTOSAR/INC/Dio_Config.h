@@ -1,7 +1,7 @@
 #ifndef DIO_CONFIG_H
 #define DIO_CONFIG_H
 
-#include "DIO.h"
+#include "Dio.h"
 
 // Số lượng kênh được cấu hình
 #define DIO_CONFIGURED_CHANNELS 3
@@ -3,16 +3,20 @@
 #include "stm32f10x_tim.h"
 #include "stm32f10x_gpio.h"  
 #include "stm32f10x.h"
-#include "DIO.h"
+#include "Dio.h"
 #include "Dio_Config.h"
+#include "Tm.h"
 
+/* Chờ bận theo DWT CYCCNT: không phụ thuộc mức -O và SYSCLK */
 void delay_ms(uint32_t ms)
 {
-    for(uint32_t i = 0; i < ms * 8000; i++) __NOP();
+    Tm_BusyWaitUs(ms * 1000U);
 }
 
 int main(void)
 {
+    Tm_Init();
+
     // Bật Clock GPIO
     RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA | RCC_APB2Periph_GPIOB | RCC_APB2Periph_GPIOC, ENABLE);
 
@@ -0,0 +1,266 @@
+/**********************************************************
+ * @file    Host_Bench.c
+ * @brief   Đo số lần truy cập bus cho mỗi API MCAL trên mô hình host
+ * @details Chương trình chạy Port/Dio/Pwm trên mô hình thanh ghi RAM
+ *          (Host_Model.c), in ra số load/store và số lệnh máy host
+ *          của mỗi lần gọi API, đồng thời kiểm tra kết quả trên
+ *          thanh ghi. Trả về khác 0 nếu sai.
+ *
+ *          Build & chạy:  make host_run
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include <stdio.h>
+#include "Host_Bench.h"
+#include "Dio.h"
+#include "Port.h"
+#include "Portconfig.h"
+#include "Pwm.h"
+#include "Pwm_Lcfg.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+int Bench_Failures = 0;
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+/* Ngắt giả lập: bật PA8 trong lúc API khác đang ghi cổng A */
+static void Bench_IsrSetPA8(void)
+{
+    GPIOA->BSRR = GPIO_Pin_8;
+}
+
+/**********************************************************
+ * @brief Kiểm tra không mất cập nhật khi ngắt chen vào API ghi cổng
+ * @details Ngắt được chèn lần lượt sau từng truy cập bus của API.
+ *          Sau khi API kết thúc, PA8 (do ngắt ghi) phải còn HIGH và
+ *          PA0..PA7 phải đúng giá trị API đã ghi.
+ **********************************************************/
+static void Bench_IsrInterleaveWrite(void (*write)(void), uint16_t expected)
+{
+    Host_BusCountType c;
+    uint32_t accesses;
+
+    Host_BusCountStart();
+    write();
+    c = Host_BusCountStop();
+    accesses = c.Loads + c.Stores;
+
+    for (uint32_t at = 1; at <= accesses; at++) {
+        DIO_MaskedWritePort(DIO_PORT_A, 0x0000, 0x01FF);
+        Host_InjectIsr(at, Bench_IsrSetPA8);
+        Host_BusCountStart();
+        write();
+        (void)Host_BusCountStop();
+        Host_InjectIsr(0, NULL);
+        CHECK((Host_Peek(&GPIOA->ODR) & 0x01FFUL) == (expected | GPIO_Pin_8));
+    }
+}
+
+static void Bench_WriteMasked(void)
+{
+    DIO_MaskedWritePort(DIO_PORT_A, 0x005A, 0x00FF);
+}
+
+static void Bench_WriteGroup(void)
+{
+    static const Dio_ChannelGroupType groupA = { GPIOA, 0x00F0, 4 };
+    DIO_WriteChannelGroup(&groupA, 0x9);
+}
+
+/* Cập nhật 12 output trên PA/PB/PC: từng lệnh ghi vs stage + commit */
+static const Dio_ChannelType Bench_Outputs[12] = {
+    DIO_CHANNEL_A4, DIO_CHANNEL_A5, DIO_CHANNEL_A6, DIO_CHANNEL_A8,
+    DIO_CHANNEL_B0, DIO_CHANNEL_B1, DIO_CHANNEL_B10, DIO_CHANNEL_B11,
+    DIO_CHANNEL_C13, DIO_CHANNEL_C14, DIO_CHANNEL_C15, DIO_CHANNEL_C0
+};
+
+static void Bench_WriteEach(Dio_LevelType level)
+{
+    for (uint8_t i = 0; i < 12; i++) DIO_WriteChannel(Bench_Outputs[i], level);
+}
+
+static void Bench_StageCommit(Dio_LevelType level)
+{
+    for (uint8_t i = 0; i < 12; i++) Dio_StageChannel(Bench_Outputs[i], level);
+    Dio_Commit();
+}
+
+static void Bench_Staging(void)
+{
+    static const Dio_ChannelGroupType groupB = { GPIOB, 0x0F00, 8 };
+
+    BENCH("12x DIO_WriteChannel (A/B/C)", Bench_WriteEach(STD_HIGH));
+    BENCH("12x Dio_StageChannel + Dio_Commit", Bench_StageCommit(STD_LOW));
+    CHECK((Host_Peek(&GPIOA->ODR) & 0x0170UL) == 0);
+    CHECK((Host_Peek(&GPIOB->ODR) & 0x0C03UL) == 0);
+    CHECK((Host_Peek(&GPIOC->ODR) & 0xE001UL) == 0);
+
+    /* Stage sau cùng thắng; chỉ cổng có thay đổi bị ghi */
+    Dio_StageChannel(DIO_CHANNEL_A4, STD_HIGH);
+    Dio_StageChannel(DIO_CHANNEL_A4, STD_LOW);
+    Dio_StageChannel(DIO_CHANNEL_A5, STD_HIGH);
+    Dio_StageChannelGroup(&groupB, 0x5);
+    BENCH("Dio_Commit (2 ports dirty)", Dio_Commit());
+    CHECK((Host_Peek(&GPIOA->ODR) & 0x0030UL) == 0x0020UL);
+    CHECK((Host_Peek(&GPIOB->ODR) & 0x0F00UL) == 0x0500UL);
+    BENCH("Dio_Commit (nothing staged)", Dio_Commit());
+}
+
+/* Chụp/ghi cả 4 cổng: một API so với 4 lần gọi từng cổng */
+static Dio_PortLevelType Bench_Levels[DIO_PORT_COUNT];
+
+static void Bench_ReadEachPort(void)
+{
+    for (uint8_t p = 0; p < DIO_PORT_COUNT; p++) Bench_Levels[p] = DIO_ReadPort(p);
+}
+
+static void Bench_ReadAll(void)
+{
+    Dio_ReadAllPorts(Bench_Levels);
+}
+
+static void Bench_WriteEachPort(void)
+{
+    for (uint8_t p = 0; p < DIO_PORT_COUNT; p++) DIO_WritePort(p, Bench_Levels[p]);
+}
+
+static void Bench_WriteAll(void)
+{
+    Dio_WriteAllPorts(Bench_Levels);
+}
+
+/* In số truy cập bus và số lệnh giữa truy cập cổng đầu và cổng cuối */
+static void Bench_Skew(const char* name, void (*call)(void))
+{
+    Host_BusCountType c;
+
+    Host_BusCountStart();
+    call();
+    c = Host_BusCountStop();
+    printf("%-40s %6u %6u %6u %6u\n", name, (unsigned)c.Loads, (unsigned)c.Stores,
+           (unsigned)(c.Loads + c.Stores), (unsigned)c.Instrs);
+    printf("%-40s %6s %6s %6s %6u\n", "  skew first -> last port (instrs)", "", "", "",
+           (unsigned)c.Span);
+}
+
+static void Bench_Snapshot(void)
+{
+    static const Dio_PortLevelType pattern[DIO_PORT_COUNT] = { 0x00A5, 0x5A00, 0x8001, 0x0000 };
+    Dio_PortLevelType saved[DIO_PORT_COUNT];
+    uint32_t ok = 1;
+
+    Host_SetInput(GPIOD, 0xFFFF, 0x1234);
+    Bench_Skew("4x DIO_ReadPort (A..D)", Bench_ReadEachPort);
+    Bench_Skew("Dio_ReadAllPorts (A..D)", Bench_ReadAll);
+    for (uint8_t p = 0; p < DIO_PORT_COUNT; p++) {
+        ok &= (Bench_Levels[p] == (Dio_PortLevelType)Host_Peek(&Dio_PortMap[p]->IDR));
+        saved[p] = (Dio_PortLevelType)Host_Peek(&Dio_PortMap[p]->ODR);
+    }
+    CHECK(ok);
+    CHECK(Bench_Levels[DIO_PORT_D] == 0x1234);
+
+    for (uint8_t p = 0; p < DIO_PORT_COUNT; p++) Bench_Levels[p] = pattern[p];
+    Bench_Skew("4x DIO_WritePort (A..D)", Bench_WriteEachPort);
+    Bench_Skew("Dio_WriteAllPorts (A..D)", Bench_WriteAll);
+    ok = 1;
+    for (uint8_t p = 0; p < DIO_PORT_COUNT; p++) {
+        ok &= (Host_Peek(&Dio_PortMap[p]->ODR) == pattern[p]);
+    }
+    CHECK(ok);
+    Dio_WriteAllPorts(saved);
+    CHECK(Host_Peek(&GPIOA->ODR) == saved[DIO_PORT_A]);
+}
+
+int main(void)
+{
+    Host_ModelInit();
+
+#if (DIO_USE_BITBAND == STD_ON)
+    printf("== Dio single-channel path: bit-band alias ==\n");
+#else
+    printf("== Dio single-channel path: BSRR/IDR ==\n");
+#endif
+#if (PORT_DEV_ERROR_DETECT == STD_OFF)
+    printf("== Port/Pwm Det checks: off (release) ==\n");
+#endif
+    printf("%-40s %6s %6s %6s %6s\n", "API", "loads", "stores", "total", "instrs");
+
+    BENCH("Port_Init", Port_Init(&PortCfg_Config));
+    CHECK((Host_Peek(&GPIOC->CRH) & 0x00F00000UL) != 0x00400000UL);
+    CHECK((Host_Peek(&GPIOA->ODR) & 0x0001UL) != 0);   /* PA0 mặc định HIGH */
+
+    BENCH("DIO_WriteChannel(C13, HIGH)", DIO_WriteChannel(DIO_CHANNEL_C13, STD_HIGH));
+    CHECK((Host_Peek(&GPIOC->ODR) & (1UL << 13)) != 0);
+    BENCH("DIO_WriteChannel(C13, LOW)", DIO_WriteChannel(DIO_CHANNEL_C13, STD_LOW));
+    CHECK((Host_Peek(&GPIOC->ODR) & (1UL << 13)) == 0);
+
+    BENCH("DIO_ReadChannel(C13)", (void)DIO_ReadChannel(DIO_CHANNEL_C13));
+    CHECK(DIO_ReadChannel(DIO_CHANNEL_C13) == STD_LOW);
+    Host_SetInput(GPIOB, GPIO_Pin_5, GPIO_Pin_5);
+    BENCH("DIO_ReadChannel(B5)", (void)DIO_ReadChannel(DIO_CHANNEL_B5));
+    CHECK(DIO_ReadChannel(DIO_CHANNEL_B5) == STD_HIGH);
+    Host_SetInput(GPIOB, GPIO_Pin_5, 0);
+    CHECK(DIO_ReadChannel(DIO_CHANNEL_B5) == STD_LOW);
+    BENCH("DIO_FlipChannel(C13)", (void)DIO_FlipChannel(DIO_CHANNEL_C13));
+    CHECK((Host_Peek(&GPIOC->ODR) & (1UL << 13)) != 0);
+
+    CHECK(DIO_CHANNEL_C13 == DIO_CHANNEL(GPIOC, 13));
+    BENCH("DIO_ReadPort(DIO_PORT_C)", (void)DIO_ReadPort(DIO_PORT_C));
+    CHECK(DIO_ReadPort(DIO_PORT_C) == (uint16_t)Host_Peek(&GPIOC->IDR));
+
+    BENCH("DIO_MaskedWritePort(A, 0x00F0, 0x00FF)", DIO_MaskedWritePort(DIO_PORT_A, 0x00F0, 0x00FF));
+    BENCH("DIO_WriteChannelGroup(PA4..PA7, 0x9)", DIO_WriteChannelGroup(&(Dio_ChannelGroupType){ GPIOA, 0x00F0, 4 }, 0x9));
+    Bench_IsrInterleaveWrite(Bench_WriteMasked, 0x005A);
+    Bench_IsrInterleaveWrite(Bench_WriteGroup, 0x0090);
+
+    BENCH("Pwm_Init", Pwm_Init(&PwmDriverConfig));
+    BENCH("Pwm_SetDutyCycle(0, 50%)", Pwm_SetDutyCycle(0, 0x4000));
+    CHECK(Host_Peek(&TIM2->CCR2) == ((999UL * 0x4000UL) >> 15));
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    Pwm_SetDutyCycle(PwmDriverConfig.NumChannels, 0x8000);  /* Det PWM_E_PARAM_CHANNEL, không ghi */
+    CHECK(Host_Peek(&TIM2->CCR2) == ((999UL * 0x4000UL) >> 15));
+#endif
+    for (uint8_t i = 0; i < PwmDriverConfig.NumChannels; i++) {
+        const Pwm_ChannelConfigType* ch = &PwmDriverConfig.Channels[i];
+        CHECK(ch->ccr == &ch->TIMx->CCR1 + (ch->channel - 1U) * 2U);    /* CCRn cách nhau 4 byte */
+    }
+    BENCH("Pwm_SetOutputToIdle(1)", Pwm_SetOutputToIdle(1));
+    CHECK(Host_Peek(&TIM3->CCR2) == 0);
+    Pwm_EnableNotification(1, PWM_RISING_EDGE);
+    CHECK(Host_Peek(&TIM3->DIER) & TIM_IT_CC2);
+    Pwm_DisableNotification(1);
+    CHECK((Host_Peek(&TIM3->DIER) & TIM_IT_CC2) == 0);
+    CHECK(Pwm_GetOutputState(1) == PWM_HIGH);               /* CC2E bật bởi Pwm_Init */
+
+    Bench_Staging();
+    Bench_Snapshot();
+    Bench_DioInline();
+    Bench_DioStream();
+    Bench_DioCapture();
+    Bench_DioDebounce();
+    Bench_DioEdge();
+    Bench_DioVirtualGroup();
+    Bench_DioBus();
+    Bench_DioBitBang();
+    Bench_Tm();
+    Bench_Clk();
+    Bench_PortInit();
+    Bench_PortRefresh();
+    Bench_PortGenerated();
+    Bench_PortRemap();
+    Bench_PortProfile();
+    Bench_PortLock();           /* Khóa giữ đến hết chương trình: chạy cuối */
+
+    if (Bench_Failures != 0) {
+        printf("%d check(s) failed\n", Bench_Failures);
+        return 1;
+    }
+    return 0;
+}
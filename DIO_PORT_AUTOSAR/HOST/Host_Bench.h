@@ -0,0 +1,64 @@
+/**********************************************************
+ * @file    Host_Bench.h
+ * @brief   Macro đo và kiểm tra dùng chung cho các file benchmark host
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+#include <stdio.h>
+#include "Host_Model.h"
+
+/* Số kiểm tra sai, main() trả về khác 0 nếu > 0 */
+extern int Bench_Failures;
+
+/* Đo một lời gọi API, in ra số truy cập bus và giữ số đếm vào result */
+#define BENCH_COUNT(name, call, result)                                     \
+    do {                                                                    \
+        Host_BusCountStart();                                               \
+        call;                                                               \
+        (result) = Host_BusCountStop();                                     \
+        printf("%-40s %6u %6u %6u %6u\n", (name), (unsigned)(result).Loads, \
+               (unsigned)(result).Stores,                                   \
+               (unsigned)((result).Loads + (result).Stores),                \
+               (unsigned)(result).Instrs);                                  \
+    } while (0)
+
+/* Đo một lời gọi API và in ra số truy cập bus */
+#define BENCH(name, call)                                                   \
+    do {                                                                    \
+        Host_BusCountType c_;                                               \
+        BENCH_COUNT(name, call, c_);                                        \
+    } while (0)
+
+/* Kiểm tra kết quả trên thanh ghi */
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+            Bench_Failures++;                                               \
+        }                                                                   \
+    } while (0)
+
+/* Các nhóm benchmark nằm ở file riêng */
+void Bench_DioInline(void);
+void Bench_DioStream(void);
+void Bench_DioCapture(void);
+void Bench_DioDebounce(void);
+void Bench_DioEdge(void);
+void Bench_DioVirtualGroup(void);
+void Bench_DioBus(void);
+void Bench_DioBitBang(void);
+void Bench_Tm(void);
+void Bench_Clk(void);
+void Bench_PortInit(void);
+void Bench_PortRefresh(void);
+void Bench_PortGenerated(void);
+void Bench_PortRemap(void);
+void Bench_PortProfile(void);
+void Bench_PortLock(void);
+
+#endif /* HOST_BENCH_H */
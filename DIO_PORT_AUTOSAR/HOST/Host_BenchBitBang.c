@@ -0,0 +1,394 @@
+/**********************************************************
+ * @file    Host_BenchBitBang.c
+ * @brief   Kiểm tra Dio_BitBang (SPI, I2C, one-wire) với slave giả lập
+ * @details Slave chạy trong Host_WatchOutputs, đóng dấu thời gian mỗi
+ *          cạnh bằng Host_Now() và trả lời qua Host_DriveInput:
+ *          - SPI: PA5 SCK, PA7 MOSI (cùng cổng, gộp store), PA6 MISO;
+ *            biến thể MOSI ở PB15 (không gộp), mode 3.
+ *          - I2C: PB10 SCL, PB11 SDA open-drain, slave địa chỉ 0x50.
+ *          - One-wire: PB0 open-drain, slave trả presence và ROM.
+ *          Init chạy trong vùng đếm để phép đo tốc độ tối đa thấy đúng
+ *          số lệnh của vòng lặp bit (trên host: 1 lệnh = 1 chu kỳ).
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_BitBang.h"
+#include "stm32f10x_gpio.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define BENCH_BB_EDGES      64U
+#define BENCH_BB_JITTER     12U     /* Sai lệch cho phép của một chu kỳ SCK (lệnh) */
+#define BENCH_I2C_ADDRESS   0x50U
+#define BENCH_OW_US         72U     /* Chu kỳ mỗi µs ở 72 MHz */
+
+/* Cạnh lên SCK/SCL: thời điểm và mức MOSI ở cạnh đó */
+static uint32_t Bench_BbEdgeAt[BENCH_BB_EDGES];
+static uint32_t Bench_BbEdges;
+static uint8_t  Bench_BbMosi[BENCH_BB_EDGES / 8U];
+static uint16_t Bench_BbOdr[2];         /* ODR cuối của GPIOA, GPIOB */
+
+/* Slave SPI: gửi Bench_SpiReply trên MISO, đổi bit ở cạnh xuống SCK */
+static const uint8_t Bench_SpiReply[] = { 0xA5, 0x3C, 0x81, 0x7E };
+static uint16_t Bench_SpiMosiPin;
+static GPIO_TypeDef* Bench_SpiMosiPort;
+
+/* Slave I2C */
+typedef struct {
+    uint8_t  active;        /* Sau START, trước STOP */
+    int8_t   bit;           /* Số cạnh xuống SCL trong byte, -1 ngay sau START */
+    uint8_t  shift;
+    uint8_t  first;         /* Byte đang nhận là byte địa chỉ */
+    uint8_t  addressed;
+    uint8_t  read;
+    uint8_t  sending;
+    uint8_t  masterAck;
+    uint8_t  out;
+    uint8_t  drive;         /* 1: slave kéo SDA xuống */
+    uint8_t  rx[8];
+    uint32_t rxCount;
+    uint32_t txCount;
+} Bench_I2cSlaveType;
+
+static Bench_I2cSlaveType Bench_I2c;
+static const uint8_t Bench_I2cMemory[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+/* Slave one-wire */
+static const uint8_t Bench_OwRom[8] = { 0x28, 0xFF, 0x4C, 0x1A, 0x93, 0x16, 0x03, 0x5E };
+static uint32_t Bench_OwFallAt;
+static uint32_t Bench_OwBits;           /* Bit đã nhận/gửi sau reset */
+static uint8_t  Bench_OwRx;             /* Byte lệnh nhận sau reset */
+static uint8_t  Bench_OwHold;           /* Slave đang giữ đường dây thấp */
+static uint32_t Bench_OwWidth[2];       /* Độ rộng xung thấp của bit 0 / bit 1 cuối cùng */
+static uint32_t Bench_OwIsrOdr;         /* ODR của PB0 khi ngắt giả lập chạy */
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Ngắt giả lập chen vào slot one-wire: ghi lại mức đường dây lúc chạy */
+static void Bench_OwIsr(void)
+{
+    Bench_OwIsrOdr = GPIOB->ODR & GPIO_Pin_0;
+}
+
+static void Bench_BbReset(void)
+{
+    Bench_BbEdges = 0;
+    for (uint32_t i = 0; i < sizeof(Bench_BbMosi); i++) Bench_BbMosi[i] = 0;
+    Bench_BbOdr[0] = (uint16_t)Host_Peek(&GPIOA->ODR);
+    Bench_BbOdr[1] = (uint16_t)Host_Peek(&GPIOB->ODR);
+}
+
+/* Slave SPI: lấy mẫu MOSI ở cạnh lên SCK, đưa bit MISO ở cạnh xuống */
+static void Bench_SpiSlave(GPIO_TypeDef* GPIOx, uint16_t Odr)
+{
+    uint16_t old = Bench_BbOdr[0];
+
+    if (GPIOx == GPIOB) {
+        Bench_BbOdr[1] = Odr;
+        return;
+    }
+    if (GPIOx != GPIOA) return;
+    Bench_BbOdr[0] = Odr;
+
+    if (!(old & GPIO_Pin_5) && (Odr & GPIO_Pin_5) && Bench_BbEdges < BENCH_BB_EDGES) {
+        uint16_t mosi = (Bench_SpiMosiPort == GPIOA) ? Odr : Bench_BbOdr[1];
+        if (mosi & Bench_SpiMosiPin) {
+            Bench_BbMosi[Bench_BbEdges / 8U] |= (uint8_t)(0x80U >> (Bench_BbEdges % 8U));
+        }
+        Bench_BbEdgeAt[Bench_BbEdges++] = Host_Now();
+    } else if ((old & GPIO_Pin_5) && !(Odr & GPIO_Pin_5)) {
+        uint32_t n = Bench_BbEdges;
+        uint8_t bit = (Bench_SpiReply[(n / 8U) % sizeof(Bench_SpiReply)] >> (7U - n % 8U)) & 1U;
+        Host_DriveInput(GPIOA, GPIO_Pin_6, bit ? GPIO_Pin_6 : 0);
+    }
+}
+
+/* Chu kỳ SCK đều 2 * half (± jitter), không trôi theo số bit */
+static uint32_t Bench_BbPeriodOk(uint32_t Half)
+{
+    uint32_t ok = (Bench_BbEdges > 1U);
+
+    for (uint32_t i = 1; i < Bench_BbEdges; i++) {
+        uint32_t period = Bench_BbEdgeAt[i] - Bench_BbEdgeAt[i - 1U];
+        ok &= (period + BENCH_BB_JITTER >= 2U * Half) && (period <= 2U * Half + BENCH_BB_JITTER);
+    }
+    return ok;
+}
+
+/* Slave I2C địa chỉ BENCH_I2C_ADDRESS: nhận byte ghi, trả Bench_I2cMemory khi đọc */
+static void Bench_I2cSlave(GPIO_TypeDef* GPIOx, uint16_t Odr)
+{
+    Bench_I2cSlaveType* s = &Bench_I2c;
+    uint16_t old = Bench_BbOdr[1];
+    uint8_t sclOld = (old & GPIO_Pin_10) != 0;
+    uint8_t scl = (Odr & GPIO_Pin_10) != 0;
+    uint8_t sdaOld = (old & GPIO_Pin_11) && !s->drive;
+    uint8_t sda = (Odr & GPIO_Pin_11) && !s->drive;
+
+    if (GPIOx != GPIOB) return;
+    Bench_BbOdr[1] = Odr;
+
+    if (scl && sclOld) {
+        if (sdaOld && !sda) {                       /* START */
+            s->active = 1;
+            s->bit = -1;
+            s->shift = 0;
+            s->first = 1;
+            s->addressed = 0;
+            s->sending = 0;
+        } else if (!sdaOld && sda) {                /* STOP */
+            s->active = 0;
+        }
+        return;
+    }
+    if (!s->active) return;
+
+    if (scl && !sclOld) {
+        if (s->bit >= 0 && s->bit < 8) {
+            s->shift = (uint8_t)((s->shift << 1) | sda);
+            if (Bench_BbEdges < BENCH_BB_EDGES) Bench_BbEdgeAt[Bench_BbEdges++] = Host_Now();
+        } else if (s->bit == 8) {
+            s->masterAck = !sda;
+        }
+        return;
+    }
+    if (scl || !sclOld) return;
+
+    /* Cạnh xuống SCL: slave chỉ đổi SDA khi SCL thấp */
+    s->bit++;
+    if (s->bit == 8) {
+        if (s->sending) {
+            s->drive = 0;                           /* Master phát ACK/NACK */
+        } else if (s->first) {
+            s->first = 0;
+            s->addressed = ((s->shift >> 1) == BENCH_I2C_ADDRESS);
+            s->read = s->shift & 1U;
+            s->drive = s->addressed;
+        } else {
+            if (s->rxCount < sizeof(s->rx)) s->rx[s->rxCount] = s->shift;
+            s->rxCount++;
+            s->drive = 1;
+        }
+    } else if (s->bit == 9) {
+        s->bit = 0;
+        s->shift = 0;
+        s->drive = 0;
+        if (s->addressed && s->read && (!s->sending || s->masterAck)) {
+            s->sending = 1;
+            s->out = Bench_I2cMemory[s->txCount++ % sizeof(Bench_I2cMemory)];
+            s->drive = !(s->out & 0x80U);
+        } else {
+            s->sending = 0;
+        }
+    } else if (s->sending && s->bit > 0) {
+        s->drive = !((s->out >> (7 - s->bit)) & 1U);
+    }
+    Host_DriveInput(GPIOB, GPIO_Pin_11, s->drive ? 0 : GPIO_Pin_11);
+}
+
+/* Slave one-wire: đo độ rộng xung thấp, giữ dây thấp cho presence và bit 0 khi gửi */
+static void Bench_OwSlave(GPIO_TypeDef* GPIOx, uint16_t Odr)
+{
+    uint16_t old = Bench_BbOdr[1];
+    uint32_t width;
+
+    if (GPIOx != GPIOB) return;
+    Bench_BbOdr[1] = Odr;
+
+    if ((old & GPIO_Pin_0) && !(Odr & GPIO_Pin_0)) {
+        Bench_OwFallAt = Host_Now();
+        if (Bench_OwHold) {
+            Bench_OwHold = 0;
+            Host_DriveInput(GPIOB, GPIO_Pin_0, GPIO_Pin_0);
+        }
+        return;
+    }
+    if ((old & GPIO_Pin_0) || !(Odr & GPIO_Pin_0)) return;
+
+    width = Host_Now() - Bench_OwFallAt;
+    if (width > 400U * BENCH_OW_US) {
+        Bench_OwBits = 0;                           /* Reset: trả presence */
+        Bench_OwHold = 1;
+    } else if (Bench_OwBits < 8U) {
+        uint8_t bit = (width < 15U * BENCH_OW_US);
+        Bench_OwWidth[bit] = width;
+        if (bit) Bench_OwRx |= (uint8_t)(1U << Bench_OwBits);
+        Bench_OwBits++;
+    } else {
+        /* Sau byte lệnh READ ROM: mọi slot là slot đọc */
+        uint32_t n = Bench_OwBits++ - 8U;
+        Bench_OwHold = !((Bench_OwRom[(n / 8U) % 8U] >> (n % 8U)) & 1U);
+    }
+    if (Bench_OwHold) Host_DriveInput(GPIOB, GPIO_Pin_0, 0);
+}
+
+/* Tốc độ yêu cầu / thực / tối đa và số chu kỳ lõi mỗi bit ở tốc độ thực */
+static void Bench_BbPrint(const char* name, uint32_t requested, uint32_t actual, uint32_t max)
+{
+    printf("  %-10s req %8u  actual %8u  max %8u bit/s  %5u cycles/bit\n", name,
+           (unsigned)requested, (unsigned)actual, (unsigned)max, (unsigned)(SystemCoreClock / actual));
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioBitBang(void)
+{
+    static const Dio_BitBangSpiConfigType spiFolded = {
+        DIO_CHANNEL_A5, DIO_CHANNEL_A7, DIO_CHANNEL_A6, 0, 500000UL };
+    static const Dio_BitBangSpiConfigType spiSplit = {
+        DIO_CHANNEL_A5, DIO_CHANNEL_B15, DIO_CHANNEL_A6, 3, 250000UL };
+    static const Dio_BitBangSpiConfigType spiFast = {
+        DIO_CHANNEL_A5, DIO_CHANNEL_A7, DIO_BITBANG_NO_PIN, 0, 50000000UL };
+    static const Dio_BitBangSpiConfigType spiBadMode = {
+        DIO_CHANNEL_A5, DIO_CHANNEL_A7, DIO_CHANNEL_A6, 4, 1000UL };
+    static const Dio_BitBangI2cConfigType i2cCfg = {
+        DIO_CHANNEL_B10, DIO_CHANNEL_B11, 100000UL, 100U };
+    static const uint8_t spiTx[4] = { 0x96, 0x0F, 0xF0, 0x5A };
+    static const uint8_t i2cTx[3] = { 0x00, 0x10, 0x42 };
+    static const uint8_t owCmd = 0x33;         /* READ ROM */
+    static const uint8_t owOne = 0xFF;
+    Dio_BitBangSpiType spi;
+    Dio_BitBangI2cType i2c;
+    Dio_BitBangOneWireType ow;
+    Host_BusCountType c;
+    GPIO_InitTypeDef gpio;
+    uint8_t rx[8];
+    uint32_t ok;
+
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    gpio.GPIO_Mode = GPIO_Mode_Out_PP;
+    gpio.GPIO_Pin = GPIO_Pin_5 | GPIO_Pin_7;
+    GPIO_Init(GPIOA, &gpio);
+    gpio.GPIO_Pin = GPIO_Pin_15;
+    GPIO_Init(GPIOB, &gpio);
+    gpio.GPIO_Mode = GPIO_Mode_Out_OD;
+    gpio.GPIO_Pin = GPIO_Pin_0 | GPIO_Pin_10 | GPIO_Pin_11;
+    GPIO_Init(GPIOB, &gpio);
+    gpio.GPIO_Mode = GPIO_Mode_IN_FLOATING;
+    gpio.GPIO_Pin = GPIO_Pin_6;
+    GPIO_Init(GPIOA, &gpio);
+    Host_SetInput(GPIOA, GPIO_Pin_6, 0);
+    Host_SetInput(GPIOB, 0, 0);
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Dio_BitBang", "loads", "stores", "total", "instrs");
+
+    /* SPI mode 0, MOSI cùng cổng SCK: 2 store mỗi bit */
+    Host_BusCountStart();
+    CHECK(Dio_BitBangSpiInit(&spi, &spiFolded) == E_OK);
+    (void)Host_BusCountStop();
+    CHECK(spi.firstWord[1] == (GPIO_Pin_7 | ((uint32_t)GPIO_Pin_5 << 16)));
+    CHECK(spi.secondWord == GPIO_Pin_5 && spi.endWord == ((uint32_t)GPIO_Pin_5 << 16));
+    Bench_SpiMosiPort = GPIOA;
+    Bench_SpiMosiPin = GPIO_Pin_7;
+    Bench_BbReset();
+    Host_DriveInput(GPIOA, GPIO_Pin_6, (Bench_SpiReply[0] & 0x80U) ? GPIO_Pin_6 : 0);
+    Host_WatchOutputs(Bench_SpiSlave);
+    BENCH("Dio_BitBangSpiTransfer mode 0 (4 B)", Dio_BitBangSpiTransfer(&spi, spiTx, rx, 4));
+    Host_WatchOutputs(NULL);
+    ok = (Bench_BbEdges == 32U);
+    for (uint32_t i = 0; i < 4U; i++) ok &= (Bench_BbMosi[i] == spiTx[i] && rx[i] == Bench_SpiReply[i]);
+    CHECK(ok);
+    CHECK(Bench_BbPeriodOk(spi.halfCycles));
+    CHECK((Host_Peek(&GPIOA->ODR) & GPIO_Pin_5) == 0);      /* SCK về mức nghỉ */
+    Bench_BbPrint("SPI", spiFolded.Bitrate, spi.bitrate, spi.maxBitrate);
+
+    /* SPI mode 3, MOSI ở cổng khác: thêm một store SCK mỗi bit */
+    Host_BusCountStart();
+    CHECK(Dio_BitBangSpiInit(&spi, &spiSplit) == E_OK);
+    (void)Host_BusCountStop();
+    Bench_SpiMosiPort = GPIOB;
+    Bench_SpiMosiPin = GPIO_Pin_15;
+    Bench_BbReset();
+    Host_WatchOutputs(Bench_SpiSlave);
+    BENCH("Dio_BitBangSpiTransfer mode 3 split (4 B)", Dio_BitBangSpiTransfer(&spi, spiTx, rx, 4));
+    Host_WatchOutputs(NULL);
+    ok = (Bench_BbEdges == 32U);
+    for (uint32_t i = 0; i < 4U; i++) ok &= (Bench_BbMosi[i] == spiTx[i] && rx[i] == Bench_SpiReply[i]);
+    CHECK(ok);
+    CHECK(Bench_BbPeriodOk(spi.halfCycles));
+    CHECK((Host_Peek(&GPIOA->ODR) & GPIO_Pin_5) != 0);      /* CPOL = 1 */
+    Bench_BbPrint("SPI split", spiSplit.Bitrate, spi.bitrate, spi.maxBitrate);
+
+    /* Yêu cầu vượt tốc độ tối đa: chạy hết tốc độ, không chờ */
+    Host_BusCountStart();
+    CHECK(Dio_BitBangSpiInit(&spi, &spiFast) == E_OK);
+    (void)Host_BusCountStop();
+    CHECK(spi.halfCycles == 0 && spi.bitrate == spi.maxBitrate && spi.maxBitrate < spiFast.Bitrate);
+    Bench_BbPrint("SPI max", spiFast.Bitrate, spi.bitrate, spi.maxBitrate);
+    CHECK(Dio_BitBangSpiInit(&spi, &spiBadMode) == E_NOT_OK);
+
+    /* I2C 100 kHz với slave 0x50 */
+    Host_BusCountStart();
+    CHECK(Dio_BitBangI2cInit(&i2c, &i2cCfg) == E_OK);
+    (void)Host_BusCountStop();
+    Bench_BbReset();
+    Bench_I2c = (Bench_I2cSlaveType){ 0 };
+    Host_WatchOutputs(Bench_I2cSlave);
+    Host_BusCountStart();
+    CHECK(Dio_BitBangI2cWrite(&i2c, BENCH_I2C_ADDRESS, i2cTx, 3) == E_OK);
+    c = Host_BusCountStop();
+    printf("%-40s %6u %6u %6u %6u\n", "Dio_BitBangI2cWrite (addr + 3 B)", (unsigned)c.Loads,
+           (unsigned)c.Stores, (unsigned)(c.Loads + c.Stores), (unsigned)c.Instrs);
+    CHECK(Bench_I2c.rxCount == 3 && Bench_I2c.rx[0] == 0x00 && Bench_I2c.rx[2] == 0x42);
+    CHECK(!Bench_I2c.active);                               /* STOP đã phát */
+    CHECK(Bench_BbEdges == 33U);                            /* 32 bit + SCL lên trước STOP */
+    /* Trong một byte chu kỳ SCL đều 2 * half */
+    ok = 1;
+    for (uint32_t i = 1; i < Bench_BbEdges; i++) {
+        if (i % 8U == 0U) continue;
+        uint32_t period = Bench_BbEdgeAt[i] - Bench_BbEdgeAt[i - 1U];
+        ok &= (period + BENCH_BB_JITTER >= 2U * i2c.halfCycles) &&
+              (period <= 2U * i2c.halfCycles + BENCH_BB_JITTER);
+    }
+    CHECK(ok);
+    CHECK(Dio_BitBangI2cWrite(&i2c, BENCH_I2C_ADDRESS + 1U, i2cTx, 3) == E_NOT_OK);   /* NACK */
+    CHECK(Dio_BitBangI2cRead(&i2c, BENCH_I2C_ADDRESS, rx, 3) == E_OK);
+    CHECK(rx[0] == 0xDE && rx[1] == 0xAD && rx[2] == 0xBE);
+    CHECK(Bench_I2c.txCount == 3 && !Bench_I2c.active);
+    Host_WatchOutputs(NULL);
+    CHECK((Host_Peek(&GPIOB->IDR) & (GPIO_Pin_10 | GPIO_Pin_11)) == (GPIO_Pin_10 | GPIO_Pin_11));
+
+    /* Slave giữ SCL thấp quá lâu: hết thời gian chờ stretching */
+    Host_DriveInput(GPIOB, GPIO_Pin_10, 0);
+    CHECK(Dio_BitBangI2cWrite(&i2c, BENCH_I2C_ADDRESS, i2cTx, 1) == E_NOT_OK);
+    Host_DriveInput(GPIOB, GPIO_Pin_10, GPIO_Pin_10);
+    Bench_BbPrint("I2C", i2cCfg.Bitrate, i2c.bitrate, i2c.maxBitrate);
+
+    /* One-wire: không có slave thì không có presence */
+    CHECK(Dio_BitBangOneWireInit(&ow, DIO_CHANNEL_B0) == E_OK);
+    CHECK(Dio_BitBangOneWireReset(&ow) == E_NOT_OK);
+    Bench_BbReset();
+    Bench_OwHold = 0;
+    Host_WatchOutputs(Bench_OwSlave);
+    CHECK(Dio_BitBangOneWireReset(&ow) == E_OK);
+    Dio_BitBangOneWireWrite(&ow, &owCmd, 1);
+    CHECK(Bench_OwRx == owCmd);
+    CHECK(Bench_OwWidth[0] >= 60U * BENCH_OW_US && Bench_OwWidth[0] < 62U * BENCH_OW_US);
+    CHECK(Bench_OwWidth[1] >= 6U * BENCH_OW_US && Bench_OwWidth[1] < 8U * BENCH_OW_US);
+    Dio_BitBangOneWireRead(&ow, rx, 8);
+    ok = 1;
+    for (uint32_t i = 0; i < 8U; i++) ok &= (rx[i] == Bench_OwRom[i]);
+    CHECK(ok);
+    Host_WatchOutputs(NULL);
+
+    /* Ngắt đến ngay sau cạnh xuống của slot ghi 1 (truy cập 2: CYCCNT
+     * rồi BSRR) chỉ chạy khi xung thấp 6 µs đã kết thúc */
+    Bench_OwIsrOdr = 0;
+    Host_InjectIsr(2, Bench_OwIsr);
+    Host_BusCountStart();
+    Dio_BitBangOneWireWrite(&ow, &owOne, 1);
+    (void)Host_BusCountStop();
+    CHECK(Bench_OwIsrOdr == GPIO_Pin_0 && Host_Primask == 0U);
+
+    Host_DriveInput(GPIOB, GPIO_Pin_0, GPIO_Pin_0);
+    Bench_BbPrint("one-wire", ow.bitrate, ow.bitrate, ow.maxBitrate);
+}
@@ -0,0 +1,172 @@
+/**********************************************************
+ * @file    Host_BenchBus.c
+ * @brief   Kiểm tra Dio_Bus (8080/6800) và đo thông lượng
+ * @details Thiết bị ngoài được mô phỏng bằng Host_WatchOutputs: LCD
+ *          chốt PC0..PC7 ở cạnh lên WR (PC8), latch chốt PD10..12,
+ *          PD3..7 ở cạnh xuống E (PA4) khi R/W (PA5) = 0.
+ *
+ *          Ước tính thông lượng trên Cortex-M3 72 MHz:
+ *          chu kỳ ~ số lệnh + 2 x số truy cập GPIO (chờ cầu APB2).
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_Lcfg.h"    /* Dio_LcdBus, Dio_LatchBus */
+#include "stm32f10x_gpio.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define BENCH_BUS_BYTES     64U
+#define BENCH_BUS_HCLK      72000000UL
+
+static uint8_t  Bench_BusData[BENCH_BUS_BYTES];
+static uint8_t  Bench_BusLog[BENCH_BUS_BYTES];
+static uint32_t Bench_BusLatched;
+static uint16_t Bench_OdrA;
+static uint16_t Bench_OdrC;
+static uint16_t Bench_OdrD;
+static uint32_t Bench_BusWords[2U * 8U];    /* Buffer DMA: static để CMAR giữ được địa chỉ */
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+static void Bench_BusLatch(uint8_t value)
+{
+    if (Bench_BusLatched < BENCH_BUS_BYTES) Bench_BusLog[Bench_BusLatched] = value;
+    Bench_BusLatched++;
+}
+
+/* Thiết bị ngoài: theo dõi cạnh WR (LCD) và E (latch) */
+static void Bench_BusDevice(GPIO_TypeDef* GPIOx, uint16_t Odr)
+{
+    if (GPIOx == GPIOC) {
+        if (!(Bench_OdrC & GPIO_Pin_8) && (Odr & GPIO_Pin_8)) {
+            Bench_BusLatch((uint8_t)Odr);
+        }
+        Bench_OdrC = Odr;
+    } else if (GPIOx == GPIOA) {
+        if ((Bench_OdrA & GPIO_Pin_4) && !(Odr & GPIO_Pin_4) && !(Odr & GPIO_Pin_5)) {
+            Bench_BusLatch((uint8_t)(((Bench_OdrD >> 10) & 0x07U) | (Bench_OdrD & 0xF8U)));
+        }
+        Bench_OdrA = Odr;
+    } else if (GPIOx == GPIOD) {
+        Bench_OdrD = Odr;
+    }
+}
+
+static void Bench_BusStart(void)
+{
+    Bench_BusLatched = 0;
+    Bench_OdrA = (uint16_t)Host_Peek(&GPIOA->ODR);
+    Bench_OdrC = (uint16_t)Host_Peek(&GPIOC->ODR);
+    Bench_OdrD = (uint16_t)Host_Peek(&GPIOD->ODR);
+    Host_WatchOutputs(Bench_BusDevice);
+}
+
+static uint32_t Bench_BusCheck(uint32_t n)
+{
+    uint32_t ok = (Bench_BusLatched == n);
+    Host_WatchOutputs(NULL);
+    for (uint32_t i = 0; i < n && i < BENCH_BUS_BYTES; i++) ok &= (Bench_BusLog[i] == Bench_BusData[i]);
+    return ok;
+}
+
+/* Cách cũ: 8 lần DIO_WriteChannel + WR thấp/cao cho mỗi byte */
+static void Bench_BusWriteEach(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        for (uint8_t b = 0; b < 8; b++) {
+            DIO_WriteChannel(DIO_CHANNEL_C0 + b, (Bench_BusData[i] >> b) & 1U);
+        }
+        DIO_WriteChannel(DIO_CHANNEL_C8, STD_LOW);
+        DIO_WriteChannel(DIO_CHANNEL_C8, STD_HIGH);
+    }
+}
+
+/* Đo và in thông lượng ước tính cho n byte */
+static void Bench_BusRate(const char* name, const Dio_BusType* bus, uint32_t n)
+{
+    Host_BusCountType c;
+    uint32_t cycles;
+
+    Bench_BusStart();
+    Host_BusCountStart();
+    if (bus != NULL) {
+        Dio_BusWrite(bus, Bench_BusData, n);
+    } else {
+        Bench_BusWriteEach(n);
+    }
+    c = Host_BusCountStop();
+    CHECK(Bench_BusCheck(n));
+
+    cycles = c.Instrs + 2U * (c.Loads + c.Stores);
+    printf("%-40s %6u %6u %6u %6u\n", name, (unsigned)c.Loads, (unsigned)c.Stores,
+           (unsigned)(c.Loads + c.Stores), (unsigned)c.Instrs);
+    printf("  ~%u cycles/byte, ~%u kB/s @72 MHz\n", (unsigned)(cycles / n),
+           (unsigned)(BENCH_BUS_HCLK / 1000U * n / cycles));
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioBus(void)
+{
+    static const Dio_StreamTimerType pace = { TIM4, 0, 3, DIO_STREAM_ONESHOT, NULL, NULL };
+    GPIO_InitTypeDef gpio;
+    uint8_t rx[4];
+
+    /* Chân bus là output push-pull; WR/RD nhả (cao), E nhả (thấp) */
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    gpio.GPIO_Mode = GPIO_Mode_Out_PP;
+    gpio.GPIO_Pin = 0x03FF;
+    GPIO_Init(GPIOC, &gpio);
+    gpio.GPIO_Pin = 0x1CF8;
+    GPIO_Init(GPIOD, &gpio);
+    gpio.GPIO_Pin = GPIO_Pin_4 | GPIO_Pin_5;
+    GPIO_Init(GPIOA, &gpio);
+    DIO_MaskedWritePort(DIO_PORT_C, 0x0300, 0x03FF);
+    DIO_MaskedWritePort(DIO_PORT_D, 0x0000, 0x1CF8);
+    DIO_MaskedWritePort(DIO_PORT_A, 0x0000, 0x0030);
+    for (uint32_t i = 0; i < BENCH_BUS_BYTES; i++) Bench_BusData[i] = (uint8_t)(i * 37U + 5U);
+
+    CHECK(Dio_LcdBus.write.assertWord == 0 && Dio_LcdBus.writeTable[0xA5] ==
+          (0x00A5UL | (0x005AUL << 16) | (GPIO_Pin_8 << 16)));
+    CHECK(Dio_LatchBus.write.assertWord == GPIO_Pin_4 && Dio_LatchBus.dataMask == 0x1CF8);
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Dio_Bus (bytes)", "loads", "stores", "total", "instrs");
+    Bench_BusRate("per-bit DIO_WriteChannel 8080 (16)", NULL, 16);
+    Bench_BusRate("Dio_BusWrite 8080, WR folded (64)", &Dio_LcdBus, BENCH_BUS_BYTES);
+    Bench_BusRate("Dio_BusWrite 6800, E on PA (64)", &Dio_LatchBus, BENCH_BUS_BYTES);
+    CHECK((Host_Peek(&GPIOA->ODR) & GPIO_Pin_5) == 0);          /* R/W = ghi */
+    CHECK((Host_Peek(&GPIOC->ODR) & GPIO_Pin_8) != 0);          /* WR nhả */
+
+    /* Đọc 8080: chân data chuyển sang input rồi trả lại output */
+    Host_SetInput(GPIOC, 0x00FF, 0x005A);
+    BENCH("Dio_BusRead 8080 (4)", Dio_BusRead(&Dio_LcdBus, rx, 4));
+    CHECK(rx[0] == 0x5A && rx[3] == 0x5A);
+    CHECK((Host_Peek(&GPIOC->CRL) & 0xFFFFFFFFUL) == 0x33333333UL);
+    CHECK((Host_Peek(&GPIOC->ODR) & GPIO_Pin_9) != 0);          /* RD nhả */
+
+    /* Đọc 6800 với chân data không liền nhau */
+    Host_SetInput(GPIOD, 0x1CF8, (uint16_t)(((0xC6U & 0x07U) << 10) | (0xC6U & 0xF8U)));
+    Dio_BusRead(&Dio_LatchBus, rx, 2);
+    CHECK(rx[0] == 0xC6 && rx[1] == 0xC6);
+    CHECK((Host_Peek(&GPIOA->ODR) & (GPIO_Pin_4 | GPIO_Pin_5)) == GPIO_Pin_5);
+    Host_SetInput(GPIOC, 0x0000, 0);
+    Host_SetInput(GPIOD, 0x0000, 0);
+
+    /* DMA: 8 byte = 16 update event của TIM4 */
+    Bench_BusStart();
+    CHECK(Dio_BusWriteDma(&Dio_LcdBus, Bench_BusData, 8, Bench_BusWords, &pace) == E_OK);
+    for (uint32_t k = 0; k < 20; k++) Host_TimerUpdate(TIM4);
+    CHECK(Bench_BusCheck(8));
+    CHECK(!Dio_StreamIsBusy(TIM4));
+    CHECK(Dio_BusWriteDma(&Dio_LatchBus, Bench_BusData, 8, Bench_BusWords, &pace) == E_NOT_OK);
+    Dio_StreamStop(TIM4);
+}
@@ -0,0 +1,102 @@
+/**********************************************************
+ * @file    Host_BenchCapture.c
+ * @brief   Kiểm tra Dio_Capture (TIM compare -> DMA1 <- IDR) trên mô hình host
+ * @details Trước mỗi Host_TimerUpdate() đặt mức ngoài cho cả cổng D,
+ *          callback chép từng chunk vào log theo chỉ số mẫu tuyệt đối,
+ *          sau đó so log với chuỗi mức đã đưa vào.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_Capture.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define BENCH_CAPTURE_RING   8U
+#define BENCH_CAPTURE_LOG    64U
+
+/* Mức đưa vào cổng D ở mẫu thứ k */
+#define BENCH_INPUT(k)       ((uint16_t)(((k) * 0x1357U) & 0x7FFFU))
+
+static uint16_t Bench_CaptureRing[BENCH_CAPTURE_RING];
+static uint16_t Bench_CaptureLog[BENCH_CAPTURE_LOG];
+static uint32_t Bench_CaptureChunks;
+static uint32_t Bench_CaptureFirst;     /* FirstSample của chunk đầu tiên được báo */
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+static void Bench_OnCapture(const uint16* Chunk, uint16 Length, uint32 FirstSample)
+{
+    if (Bench_CaptureChunks++ == 0) Bench_CaptureFirst = FirstSample;
+    for (uint16 i = 0; i < Length && FirstSample + i < BENCH_CAPTURE_LOG; i++) {
+        Bench_CaptureLog[FirstSample + i] = Chunk[i];
+    }
+}
+
+/* Chạy n chu kỳ timer, mẫu thứ k của lần chạy nhận mức BENCH_INPUT(start + k) */
+static void Bench_Drive(uint32_t start, uint32_t n)
+{
+    for (uint32_t k = start; k < start + n; k++) {
+        Host_SetInput(GPIOD, 0xFFFF, BENCH_INPUT(k));
+        Host_TimerUpdate(TIM4);
+    }
+}
+
+static void Bench_Ticks(uint32_t n)
+{
+    for (uint32_t k = 0; k < n; k++) Host_TimerUpdate(TIM4);
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioCapture(void)
+{
+    static const Dio_CaptureTimerType freeRun = { TIM4, 0, 71, 0, 0,
+                                                  Bench_OnCapture, Bench_OnCapture };
+    static const Dio_CaptureTimerType trigger = { TIM4, 0, 71, 0x4000, 0x4000,
+                                                  Bench_OnCapture, Bench_OnCapture };
+    uint32_t ok;
+
+    /* Chạy tự do: mọi chunk được báo, liền mạch theo chỉ số mẫu */
+    BENCH("Dio_CaptureStart(D, 8 samples, TIM4)",
+          (void)Dio_CaptureStart(DIO_PORT_D, Bench_CaptureRing, BENCH_CAPTURE_RING, &freeRun));
+    Bench_Drive(0, 32);
+    ok = 1;
+    for (uint32_t k = 0; k < 32; k++) ok &= (Bench_CaptureLog[k] == BENCH_INPUT(k));
+    CHECK(ok);
+    CHECK(Bench_CaptureChunks == 8 && Bench_CaptureFirst == 0);
+    CHECK(Dio_CaptureGetSampleCount(TIM4) == 32);
+    Bench_Drive(32, 3);
+    CHECK(Dio_CaptureGetSampleCount(TIM4) == 35);
+    BENCH("8 samples capture (CPU: 2 ISR)", Bench_Ticks(8));
+    CHECK(Dio_CaptureGetSampleCount(TIM4) == 43);
+    CHECK(Dio_CaptureGetTriggerSample(TIM4) == DIO_CAPTURE_NO_TRIGGER);
+    Dio_CaptureStop(TIM4);
+    Bench_Ticks(4);
+    CHECK(Dio_CaptureGetSampleCount(TIM4) == 0);
+
+    /* Trigger PD14 = HIGH: chỉ báo từ chunk chứa mẫu khớp đầu tiên */
+    for (uint32_t k = 0; k < BENCH_CAPTURE_LOG; k++) Bench_CaptureLog[k] = 0;
+    Bench_CaptureChunks = 0;
+    (void)Dio_CaptureStart(DIO_PORT_D, Bench_CaptureRing, BENCH_CAPTURE_RING, &trigger);
+    for (uint32_t k = 0; k < 24; k++) {
+        Host_SetInput(GPIOD, 0xFFFF, (k == 13U) ? 0x4001U : (uint16_t)(k & 0x3FFFU));
+        Host_TimerUpdate(TIM4);
+    }
+    CHECK(Dio_CaptureGetTriggerSample(TIM4) == 13);
+    CHECK(Bench_CaptureFirst == 12 && Bench_CaptureChunks == 3);
+    CHECK(Bench_CaptureLog[13] == 0x4001U && Bench_CaptureLog[23] == 23U);
+    CHECK(Bench_CaptureLog[11] == 0);
+    CHECK(DIO_CAPTURE_TICKS(&trigger, 13) == 13U * 72U);
+    Dio_CaptureStop(TIM4);
+
+    CHECK(Dio_CaptureStart(DIO_PORT_D, Bench_CaptureRing, 7, &freeRun) == E_NOT_OK);
+}
@@ -0,0 +1,167 @@
+/**********************************************************
+ * @file    Host_BenchClk.c
+ * @brief   Kiểm tra dịch vụ clock Clk: gom lệnh ghi RCC, đếm tham chiếu
+ * @details Bật 8 ngoại vi trên cả ba bus bằng Clk (một lần đọc/ghi mỗi
+ *          bus) so với 8 lần gọi RCC_xxxPeriphClockCmd của SPL. Sau đó
+ *          kiểm tra clock dùng chung giữa Pwm và một driver khác chỉ bị
+ *          tắt khi cả hai đã trả lại, và timer của Pwm không bị
+ *          Dio_Stream/Dio_Capture giành mất (và ngược lại).
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Clk.h"
+#include "Pwm.h"
+#include "Pwm_Lcfg.h"
+#include "Dio_Stream.h"
+#include "Dio_Capture.h"
+#include "stm32f10x_rcc.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Ngoại vi chưa driver nào dùng, đủ cả AHB/APB1/APB2 */
+static const Clk_PeripheralType Bench_ClkSet[8] = {
+    CLK_CRC, CLK_SPI2, CLK_USART2, CLK_I2C1, CLK_CAN1, CLK_ADC1, CLK_SPI1, CLK_USART1
+};
+
+#define BENCH_CLK_AHB       RCC_AHBPeriph_CRC
+#define BENCH_CLK_APB1      (RCC_APB1Periph_SPI2 | RCC_APB1Periph_USART2 | \
+                             RCC_APB1Periph_I2C1 | RCC_APB1Periph_CAN1)
+#define BENCH_CLK_APB2      (RCC_APB2Periph_ADC1 | RCC_APB2Periph_SPI1 | RCC_APB2Periph_USART1)
+
+/* Buffer cho Dio_Stream/Dio_Capture trên timer của Pwm */
+static uint32 Bench_ClkWords[2];
+static uint16 Bench_ClkSamples[2];
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+static void Bench_ClkRequestAll(void)
+{
+    for (uint8_t i = 0; i < 8; i++) Clk_Request(Bench_ClkSet[i]);
+    Clk_Apply();
+}
+
+static void Bench_ClkReleaseAll(void)
+{
+    for (uint8_t i = 0; i < 8; i++) Clk_Release(Bench_ClkSet[i]);
+    Clk_Apply();
+}
+
+/* Cách cũ: mỗi ngoại vi một lần RCC_xxxPeriphClockCmd */
+static void Bench_ClkSplEach(FunctionalState state)
+{
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, state);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_SPI2, state);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, state);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_I2C1, state);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_CAN1, state);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1, state);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_SPI1, state);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1, state);
+}
+
+static uint32_t Bench_ClkAllOn(void)
+{
+    return (Host_Peek(&RCC->AHBENR) & BENCH_CLK_AHB) == BENCH_CLK_AHB &&
+           (Host_Peek(&RCC->APB1ENR) & BENCH_CLK_APB1) == BENCH_CLK_APB1 &&
+           (Host_Peek(&RCC->APB2ENR) & BENCH_CLK_APB2) == BENCH_CLK_APB2;
+}
+
+static uint32_t Bench_ClkAllOff(void)
+{
+    return (Host_Peek(&RCC->AHBENR) & BENCH_CLK_AHB) == 0 &&
+           (Host_Peek(&RCC->APB1ENR) & BENCH_CLK_APB1) == 0 &&
+           (Host_Peek(&RCC->APB2ENR) & BENCH_CLK_APB2) == 0;
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_Clk(void)
+{
+    static const Dio_StreamTimerType onTim2 = { TIM2, 0, 7, DIO_STREAM_CIRCULAR, NULL, NULL };
+    static const Dio_CaptureTimerType onTim3 = { TIM3, 0, 7, 0, 0, NULL, NULL };
+    uint8 tim2Refs;
+    uint32_t tim2Arr;
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Clk", "loads", "stores", "total", "instrs");
+
+    BENCH("8x RCC_xxxPeriphClockCmd(ENABLE)", Bench_ClkSplEach(ENABLE));
+    CHECK(Bench_ClkAllOn());
+    Bench_ClkSplEach(DISABLE);
+    CHECK(Bench_ClkAllOff());
+
+    BENCH("8x Clk_Request + Clk_Apply", Bench_ClkRequestAll());
+    CHECK(Bench_ClkAllOn());
+    BENCH("Clk_Apply (nothing pending)", Clk_Apply());
+    BENCH("8x Clk_Release + Clk_Apply", Bench_ClkReleaseAll());
+    CHECK(Bench_ClkAllOff());
+
+    /* TIM2 dùng chung: Pwm (kênh 0) và một driver khác */
+    tim2Refs = Clk_GetRefCount(CLK_TIM2);
+    CHECK(tim2Refs >= 1U);
+    Clk_Request(CLK_TIM2);
+    Clk_Apply();
+    Pwm_DeInit();
+    CHECK(Clk_GetRefCount(CLK_TIM2) == tim2Refs);
+    CHECK(Host_Peek(&RCC->APB1ENR) & RCC_APB1Periph_TIM2);
+    CHECK((Host_Peek(&RCC->APB1ENR) & RCC_APB1Periph_TIM3) == 0);   /* Chỉ Pwm dùng */
+    Clk_Release(CLK_TIM2);
+    Clk_Apply();
+    CHECK((Host_Peek(&RCC->APB1ENR) & RCC_APB1Periph_TIM2) == 0);
+    BENCH("Pwm_Init (2 timers, after DeInit)", Pwm_Init(&PwmDriverConfig));
+    CHECK((Host_Peek(&RCC->APB1ENR) & (RCC_APB1Periph_TIM2 | RCC_APB1Periph_TIM3)) ==
+          (RCC_APB1Periph_TIM2 | RCC_APB1Periph_TIM3));
+
+    /* Timer độc quyền: Pwm giữ TIM2/TIM3, Dio_Stream/Dio_Capture bị từ chối
+     * và không ghi PSC/ARR của kênh PWM */
+    CHECK(Clk_GetOwner(CLK_TIM2) == CLK_OWNER_PWM && Clk_GetOwner(CLK_TIM3) == CLK_OWNER_PWM);
+    tim2Arr = Host_Peek(&TIM2->ARR);
+    CHECK(Dio_StreamStart(DIO_PORT_B, Bench_ClkWords, 2, &onTim2) == E_NOT_OK);
+    CHECK(Dio_CaptureStart(DIO_PORT_B, Bench_ClkSamples, 2, &onTim3) == E_NOT_OK);
+    CHECK(Host_Peek(&TIM2->ARR) == tim2Arr && !Dio_StreamIsBusy(TIM2));
+    CHECK(Clk_GetRefCount(CLK_TIM2) == tim2Refs);
+
+    /* Ngược lại: stream giữ TIM2 thì Pwm_Init không init, không giữ TIM3 */
+    Pwm_DeInit();
+    CHECK(Dio_StreamStart(DIO_PORT_B, Bench_ClkWords, 2, &onTim2) == E_OK);
+    Pwm_Init(&PwmDriverConfig);
+    CHECK(Clk_GetOwner(CLK_TIM2) == CLK_OWNER_DIO_STREAM);
+    CHECK(Clk_GetOwner(CLK_TIM3) == CLK_OWNER_NONE);
+    CHECK(Host_Peek(&TIM2->ARR) == onTim2.period);
+    Dio_StreamStop(TIM2);
+    CHECK(Clk_GetOwner(CLK_TIM2) == CLK_OWNER_NONE);
+
+    /* TIMx ngoài TIM1..TIM4 là lỗi config (PWM_E_INIT_FAILED): kênh
+     * trước đã giành được trả lại, driver không init */
+    {
+        Pwm_ChannelConfigType badChannels[2] = { PwmDriverConfig.Channels[0], PwmDriverConfig.Channels[0] };
+        const Pwm_ConfigType bad = { badChannels, 2 };
+
+        badChannels[1].TIMx = (TIM_TypeDef*)GPIOA;
+        Pwm_Init(&bad);
+        CHECK(Clk_GetOwner(CLK_TIM2) == CLK_OWNER_NONE);    /* Channels[0]: TIM2 */
+    }
+    Pwm_Init(&PwmDriverConfig);
+    CHECK(Clk_GetOwner(CLK_TIM2) == CLK_OWNER_PWM && Clk_GetOwner(CLK_TIM3) == CLK_OWNER_PWM);
+    CHECK(Host_Peek(&TIM2->ARR) == tim2Arr);
+
+    /* Bit bật sẵn trước Clk (SRAM sau reset) không bị Clk tắt */
+    RCC->AHBENR |= RCC_AHBPeriph_SRAM;
+    Clk_Request(CLK_SRAM);
+    Clk_Apply();
+    Clk_Release(CLK_SRAM);
+    Clk_Apply();
+    CHECK(Host_Peek(&RCC->AHBENR) & RCC_AHBPeriph_SRAM);
+
+    /* Định danh ngoài bảng bị bỏ qua */
+    Clk_Request(CLK_NONE);
+    CHECK(Clk_GetRefCount(CLK_NONE) == 0);
+}
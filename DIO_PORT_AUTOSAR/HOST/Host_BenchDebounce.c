@@ -0,0 +1,102 @@
+/**********************************************************
+ * @file    Host_BenchDebounce.c
+ * @brief   Kiểm tra Dio_Debounce và so chi phí với lọc từng chân
+ * @details Đưa chuỗi mức có dội vào PB13/PC10 qua Host_SetInput, gọi
+ *          main function mỗi "1 ms" và kiểm tra thời điểm lật trạng
+ *          thái cùng các cạnh báo ra.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_Lcfg.h"    /* Dio_DebounceConfig, DIO_DEBOUNCE_PORT_COUNT */
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Cách cũ: mỗi chân một lần DIO_ReadChannel và một bộ đếm riêng */
+#define BENCH_PIN_COUNT     11U     /* 6 chân cổng B + 5 chân cổng C */
+
+static uint8_t Bench_PinCount[BENCH_PIN_COUNT];
+static uint8_t Bench_PinState[BENCH_PIN_COUNT];
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+static void Bench_DebouncePerPin(void)
+{
+    uint8_t n = 0;
+
+    for (uint8_t i = 0; i < DIO_DEBOUNCE_PORT_COUNT; i++) {
+        const Dio_DebounceConfigType* cfg = &Dio_DebounceConfig[i];
+        for (uint8_t pin = 0; pin < DIO_PINS_PER_PORT; pin++) {
+            if (!(cfg->mask & (1U << pin))) continue;
+            Dio_LevelType level = DIO_ReadChannel(DIO_CHANNEL_ID(cfg->port, pin));
+            if (level == Bench_PinState[n]) {
+                Bench_PinCount[n] = 0;
+            } else if (++Bench_PinCount[n] >= cfg->depth) {
+                Bench_PinState[n] = level;
+                Bench_PinCount[n] = 0;
+            }
+            n++;
+        }
+    }
+}
+
+/* Đưa mức vào PB13 rồi chạy một chu kỳ lọc, trả về trạng thái ổn định PB13 */
+static uint16_t Bench_StepPB13(uint16_t level)
+{
+    Dio_DebouncedPortType port;
+
+    Host_SetInput(GPIOB, 0xE806, level ? GPIO_Pin_13 : 0);
+    Dio_DebounceMainFunction();
+    port.State = 0;
+    (void)Dio_GetDebouncedPort(DIO_PORT_B, &port);
+    return port.State & GPIO_Pin_13;
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioDebounce(void)
+{
+    static const uint8_t bounce[] = { 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1 };
+    Dio_DebouncedPortType port;
+    uint32_t changedAt = 0;
+
+    Host_SetInput(GPIOB, 0xE806, 0);
+    Host_SetInput(GPIOC, 0xDC00, 0);
+    Dio_DebounceInit();
+
+    /* PB13 (depth 8): chỉ lật sau 8 mẫu HIGH liên tiếp (mẫu 5..12) */
+    for (uint32_t k = 0; k < sizeof(bounce); k++) {
+        if (Bench_StepPB13(bounce[k]) != 0 && changedAt == 0) changedAt = k;
+    }
+    CHECK(changedAt == 12);
+
+    /* Cạnh được tích lũy đến khi đọc và chỉ báo một lần */
+    Host_SetInput(GPIOB, 0xE806, 0);
+    for (uint32_t k = 0; k < 8; k++) Dio_DebounceMainFunction();
+    CHECK(Dio_GetDebouncedPort(DIO_PORT_B, &port) == E_OK);
+    CHECK(port.State == 0 && port.Falling == GPIO_Pin_13 && port.Rising == 0);
+    CHECK(Dio_GetDebouncedPort(DIO_PORT_B, &port) == E_OK && port.Falling == 0);
+
+    /* PC10 (depth 4) và PC15 cùng lật sau 4 mẫu, PC13 ngoài mask bị bỏ qua */
+    Host_SetInput(GPIOC, 0xFC00, GPIO_Pin_10 | GPIO_Pin_13 | GPIO_Pin_15);
+    for (uint32_t k = 0; k < 3; k++) Dio_DebounceMainFunction();
+    (void)Dio_GetDebouncedPort(DIO_PORT_C, &port);
+    CHECK(port.State == 0 && port.Rising == 0);
+    Dio_DebounceMainFunction();
+    (void)Dio_GetDebouncedPort(DIO_PORT_C, &port);
+    CHECK(port.State == (GPIO_Pin_10 | GPIO_Pin_15) && port.Rising == (GPIO_Pin_10 | GPIO_Pin_15));
+
+    CHECK(Dio_GetDebouncedPort(DIO_PORT_A, &port) == E_NOT_OK);
+
+    BENCH("Dio_DebounceMainFunction (2 ports)", Dio_DebounceMainFunction());
+    BENCH("per-pin DIO_ReadChannel debounce (11)", Bench_DebouncePerPin());
+    Host_SetInput(GPIOC, 0, 0);
+}
@@ -0,0 +1,125 @@
+/**********************************************************
+ * @file    Host_BenchEdge.c
+ * @brief   Kiểm tra Dio_Edge (EXTI) và đo độ trễ ISR -> callback
+ * @details Host_SetInput tạo cạnh trên cổng D, mô hình bật cờ EXTI và
+ *          gọi vector tương ứng. Độ trễ đọc từ Dio_EdgeGetLatency: trên
+ *          host DWT->CYCCNT đếm số lệnh máy đã chạy.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_Edge.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define BENCH_EDGE_LOG      8U
+
+void EXTI9_5_IRQHandler(void);
+
+static Dio_ChannelType Bench_EdgeChannel[BENCH_EDGE_LOG];
+static Dio_LevelType   Bench_EdgeLevel[BENCH_EDGE_LOG];
+static uint32_t        Bench_EdgeCount;
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+static void Bench_OnEdge(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    if (Bench_EdgeCount < BENCH_EDGE_LOG) {
+        Bench_EdgeChannel[Bench_EdgeCount] = ChannelId;
+        Bench_EdgeLevel[Bench_EdgeCount] = Level;
+    }
+    Bench_EdgeCount++;
+}
+
+static const Dio_EdgeConfigType Bench_EdgeConfig = {
+    .Lines = {
+        [0]  = { DIO_CHANNEL_D0,  DIO_EDGE_RISING,  Bench_OnEdge },
+        [7]  = { DIO_CHANNEL_D7,  DIO_EDGE_FALLING, Bench_OnEdge },
+        [12] = { DIO_CHANNEL_D12, DIO_EDGE_BOTH,    Bench_OnEdge },
+        [13] = { DIO_CHANNEL_D13, DIO_EDGE_RISING,  Bench_OnEdge }
+    }
+};
+
+/* Đặt mức cổng D, trả về số callback phát sinh */
+static uint32_t Bench_Drive(uint16_t level)
+{
+    uint32_t before = Bench_EdgeCount;
+    Host_SetInput(GPIOD, 0xFFFF, level);
+    return Bench_EdgeCount - before;
+}
+
+/* Đo một cạnh: tổng chi phí ISR và độ trễ đầu ISR -> callback */
+static void Bench_EdgeLatency(const char* name, uint16_t from, uint16_t to)
+{
+    Host_BusCountType c;
+    uint32_t last;
+    uint32_t max;
+
+    (void)Bench_Drive(from);
+    Host_BusCountStart();
+    Host_SetInput(GPIOD, 0xFFFF, to);
+    c = Host_BusCountStop();
+    Dio_EdgeGetLatency(&last, &max);
+    printf("%-40s %6u %6u %6u %6u\n", name, (unsigned)c.Loads, (unsigned)c.Stores,
+           (unsigned)(c.Loads + c.Stores), (unsigned)c.Instrs);
+    printf("%-40s %6s %6s %6s %6u\n", "  ISR entry -> callback (DWT)", "", "", "", (unsigned)last);
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioEdge(void)
+{
+    /* Line 8 (PD8) do module khác bật trên vector EXTI9_5 trước Dio_EdgeInit:
+     * ISR chỉ xóa cờ, không đọc bảng dispatch còn NULL */
+    Host_SetInput(GPIOD, 0xFFFF, GPIO_Pin_8);
+    AFIO->EXTICR[2] = 0x3UL;
+    EXTI->IMR = GPIO_Pin_8;
+    EXTI->FTSR = GPIO_Pin_8;
+    Host_SetInput(GPIOD, 0xFFFF, 0);
+    CHECK((Host_Peek(&EXTI->PR) & GPIO_Pin_8) != 0);
+    EXTI9_5_IRQHandler();
+    CHECK((Host_Peek(&EXTI->PR) & 0xFFFFUL) == 0);
+    EXTI->FTSR = 0;
+    EXTI->IMR = 0;
+    AFIO->EXTICR[2] = 0;
+
+    Bench_EdgeCount = 0;
+    Dio_EdgeInit(&Bench_EdgeConfig);
+
+    /* Cạnh lên PD0 (line riêng EXTI0) */
+    CHECK(Bench_Drive(GPIO_Pin_0) == 1);
+    CHECK(Bench_EdgeChannel[0] == DIO_CHANNEL_D0 && Bench_EdgeLevel[0] == STD_HIGH);
+
+    /* PD7 chỉ báo cạnh xuống */
+    CHECK(Bench_Drive(GPIO_Pin_0 | GPIO_Pin_7) == 0);
+    CHECK(Bench_Drive(GPIO_Pin_0) == 1);
+    CHECK(Bench_EdgeChannel[1] == DIO_CHANNEL_D7 && Bench_EdgeLevel[1] == STD_LOW);
+
+    /* PD12 + PD13 cùng lúc: một lần vào EXTI15_10, line cao được gọi trước */
+    CHECK(Bench_Drive(GPIO_Pin_0 | GPIO_Pin_12 | GPIO_Pin_13) == 2);
+    CHECK(Bench_EdgeChannel[2] == DIO_CHANNEL_D13 && Bench_EdgeChannel[3] == DIO_CHANNEL_D12);
+    CHECK(Bench_EdgeLevel[3] == STD_HIGH);
+    CHECK(Bench_Drive(GPIO_Pin_0 | GPIO_Pin_13) == 1);
+    CHECK(Bench_EdgeChannel[4] == DIO_CHANNEL_D12 && Bench_EdgeLevel[4] == STD_LOW);
+
+    /* Mask line: cạnh lúc bị mask không được báo kể cả sau khi bật lại */
+    Dio_EdgeDisableNotification(DIO_CHANNEL_D0);
+    CHECK(Bench_Drive(GPIO_Pin_13) == 0);
+    CHECK(Bench_Drive(GPIO_Pin_0 | GPIO_Pin_13) == 0);
+    Dio_EdgeEnableNotification(DIO_CHANNEL_D0);
+    CHECK(Bench_Drive(GPIO_Pin_13) == 0);
+    CHECK(Bench_Drive(GPIO_Pin_0 | GPIO_Pin_13) == 1);
+    CHECK((Host_Peek(&EXTI->PR) & 0xFFFFUL) == 0);
+
+    Bench_EdgeLatency("EXTI0 ISR (PD0 rising)", 0, GPIO_Pin_0);
+    Bench_EdgeLatency("EXTI9_5 ISR (PD7 falling)", GPIO_Pin_7, 0);
+    Bench_EdgeLatency("EXTI15_10 ISR (PD12+PD13)", 0, GPIO_Pin_12 | GPIO_Pin_13);
+}
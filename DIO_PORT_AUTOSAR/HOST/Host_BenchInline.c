@@ -0,0 +1,39 @@
+/**********************************************************
+ * @file    Host_BenchInline.c
+ * @brief   So sánh API DIO inline (Dio_Inline.h) với bản trong Dio.c
+ * @details File này include Dio_Inline.h nên DIO_xxx(...) là bản
+ *          inline; (DIO_xxx)(...) gọi bản out-of-line trong Dio.c.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_Inline.h"
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioInline(void)
+{
+    printf("\n%-40s %6s %6s %6s %6s\n", "Dio_Inline.h vs Dio.c", "loads", "stores", "total", "instrs");
+
+    BENCH("Dio.c     DIO_WriteChannel(C13, HIGH)", (DIO_WriteChannel)(DIO_CHANNEL_C13, STD_HIGH));
+    BENCH("inline    DIO_WriteChannel(C13, HIGH)", DIO_WriteChannel(DIO_CHANNEL_C13, STD_HIGH));
+    CHECK((Host_Peek(&GPIOC->ODR) & GPIO_Pin_13) != 0);
+    BENCH("inline    DIO_WriteChannel(C13, LOW)", DIO_WriteChannel(DIO_CHANNEL_C13, STD_LOW));
+    CHECK((Host_Peek(&GPIOC->ODR) & GPIO_Pin_13) == 0);
+
+    BENCH("Dio.c     DIO_ReadChannel(C13)", (void)(DIO_ReadChannel)(DIO_CHANNEL_C13));
+    BENCH("inline    DIO_ReadChannel(C13)", (void)DIO_ReadChannel(DIO_CHANNEL_C13));
+    CHECK(DIO_ReadChannel(DIO_CHANNEL_C13) == (DIO_ReadChannel)(DIO_CHANNEL_C13));
+
+    BENCH("Dio.c     DIO_FlipChannel(C13)", (void)(DIO_FlipChannel)(DIO_CHANNEL_C13));
+    BENCH("inline    DIO_FlipChannel(C13)", (void)DIO_FlipChannel(DIO_CHANNEL(GPIOC, 13)));
+    CHECK((Host_Peek(&GPIOC->ODR) & GPIO_Pin_13) == 0);
+
+    BENCH("Dio.c     DIO_WritePort(B, 0x00A5)", (DIO_WritePort)(DIO_PORT_B, 0x00A5));
+    BENCH("inline    DIO_WritePort(B, 0x005A)", DIO_WritePort(DIO_PORT_B, 0x005A));
+    CHECK(Host_Peek(&GPIOB->ODR) == 0x005AUL);
+}
@@ -0,0 +1,539 @@
+/**********************************************************
+ * @file    Host_BenchPort.c
+ * @brief   Đo chi phí Port_Init theo số pin (ảnh thanh ghi vs GPIO_Init)
+ * @details Cấu hình 48 pin PA/PB/PC được khởi tạo hai cách trên thanh
+ *          ghi reset: cách cũ (từng pin: bật clock + GPIO_Init + mức
+ *          ODR qua SPL) và Port_Init dựng ảnh CRL/CRH/ODR. Hai cách
+ *          phải cho cùng giá trị thanh ghi. Sau đó đo đổi chiều/mode
+ *          lúc runtime: GPIO_Init từng pin so với vá một nibble, và
+ *          refresh chiều pin: áp lại từng pin so với so/sửa theo ảnh.
+ *          Cuối cùng so ảnh sinh sẵn của TOOLS/mcal_gen.py (PortCfg_Images)
+ *          với ảnh Port_Init tự dựng từ cùng bảng pin, và đo remap AFIO:
+ *          nhiều lần GPIO_PinRemapConfig so với một lệnh ghi MAPR.
+ *          Profile chân: GPIO_Init analog cho các pin rồi Port_Init lại
+ *          so với Port_SetProfile sang SLEEP/SAFE và về ACTIVE.
+ *          Bench khóa LCKR chạy cuối và chỉ dùng PC/PD: khóa giữ trong
+ *          Port đến hết chương trình.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Port.h"
+#include "Portconfig.h"
+#include "Clk.h"
+#include "stm32f10x_rcc.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define BENCH_PORT_PINS     48U
+#define BENCH_PORT_USED     3U      /* PA, PB, PC */
+
+/* Các kiểu pin lặp vòng trên 48 pin */
+static const Port_PinConfigType Bench_PortKinds[6] = {
+    { .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_OUT, .Pull = PORT_PIN_PULL_UP,
+      .Level = PORT_PIN_LEVEL_HIGH, .Speed = PORT_SPEED_50Mhz },
+    { .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_OUT, .Pull = PORT_PIN_PULL_NONE,
+      .Level = PORT_PIN_LEVEL_LOW, .Speed = PORT_SPEED_2Mhz },
+    { .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_IN, .Pull = PORT_PIN_PULL_UP },
+    { .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_IN, .Pull = PORT_PIN_PULL_DOWN },
+    { .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_IN, .Pull = PORT_PIN_PULL_NONE },
+    { .Mode = PORT_PIN_MODE_PWM, .Direction = PORT_PIN_OUT, .Speed = PORT_SPEED_10Mhz },
+};
+
+static Port_PinConfigType Bench_PortPins[BENCH_PORT_PINS];
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Port_Init trước đây: mỗi pin bật clock, gọi GPIO_Init rồi đặt mức */
+static void Bench_PortInitPerPin(const Port_PinConfigType* pins, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++) {
+        const Port_PinConfigType* pin = &pins[i];
+        GPIO_TypeDef* port = PORT_GET_PORT(pin->PortNum);
+        GPIO_InitTypeDef init;
+
+        RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA << pin->PortNum, ENABLE);
+        init.GPIO_Pin = PORT_GET_PIN_MASK(pin->PinNum);
+        init.GPIO_Speed = pin->Speed == PORT_SPEED_10Mhz ? GPIO_Speed_10MHz :
+                          pin->Speed == PORT_SPEED_50Mhz ? GPIO_Speed_50MHz : GPIO_Speed_2MHz;
+        if (pin->Mode == PORT_PIN_MODE_PWM) {
+            init.GPIO_Mode = GPIO_Mode_AF_PP;
+        } else if (pin->Direction == PORT_PIN_OUT) {
+            init.GPIO_Mode = pin->Pull == PORT_PIN_PULL_UP ? GPIO_Mode_Out_PP : GPIO_Mode_Out_OD;
+        } else {
+            init.GPIO_Mode = pin->Pull == PORT_PIN_PULL_UP ? GPIO_Mode_IPU :
+                             pin->Pull == PORT_PIN_PULL_DOWN ? GPIO_Mode_IPD : GPIO_Mode_IN_FLOATING;
+        }
+        GPIO_Init(port, &init);
+        if (pin->Direction == PORT_PIN_OUT) {
+            if (pin->Level == PORT_PIN_LEVEL_HIGH) GPIO_SetBits(port, init.GPIO_Pin);
+            else GPIO_ResetBits(port, init.GPIO_Pin);
+        }
+    }
+}
+
+static void Bench_PortSave(uint32_t regs[BENCH_PORT_USED][3])
+{
+    for (uint8_t p = 0; p < BENCH_PORT_USED; p++) {
+        regs[p][0] = Host_Peek(&PORT_GET_PORT(p)->CRL);
+        regs[p][1] = Host_Peek(&PORT_GET_PORT(p)->CRH);
+        regs[p][2] = Host_Peek(&PORT_GET_PORT(p)->ODR);
+    }
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_PortInit(void)
+{
+    const Port_ConfigType config = { Bench_PortPins, BENCH_PORT_PINS };
+    const Port_ConfigType config6 = { Bench_PortPins, 6 };
+    Host_BusCountType perPin, image;
+    uint32_t expected[BENCH_PORT_USED][3];
+    uint32_t actual[BENCH_PORT_USED][3];
+    uint32_t ok = 1;
+
+    for (uint8_t i = 0; i < BENCH_PORT_PINS; i++) {
+        Bench_PortPins[i] = Bench_PortKinds[i % 6];
+        Bench_PortPins[i].PortNum = i / 16;
+        Bench_PortPins[i].PinNum = i % 16;
+        Bench_PortPins[i].DirectionChangeable = (i != 19);
+        Bench_PortPins[i].ModeChangeable = (i != 19);
+    }
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Port boot", "loads", "stores", "total", "instrs");
+
+    Host_ModelReset();
+    BENCH_COUNT("6 pins: per-pin GPIO_Init", Bench_PortInitPerPin(Bench_PortPins, 6), perPin);
+    Host_ModelReset();
+    BENCH_COUNT("6 pins: Port_Init (register images)", Port_Init(&config6), image);
+    /* Ít pin: cái lợi là số truy cập bus (mỗi thanh ghi một lần), số
+     * lệnh chỉ ngang GPIO_Init vì phần dựng ảnh cố định theo cổng */
+    CHECK(image.Loads + image.Stores < perPin.Loads + perPin.Stores);
+
+    Host_ModelReset();
+    BENCH_COUNT("48 pins: per-pin GPIO_Init", Bench_PortInitPerPin(Bench_PortPins, BENCH_PORT_PINS),
+                perPin);
+    Bench_PortSave(expected);
+    Host_ModelReset();
+    BENCH_COUNT("48 pins: Port_Init (register images)", Port_Init(&config), image);
+    Bench_PortSave(actual);
+    CHECK(image.Instrs < perPin.Instrs);
+
+    for (uint8_t p = 0; p < BENCH_PORT_USED; p++) {
+        for (uint8_t r = 0; r < 3; r++) ok &= (actual[p][r] == expected[p][r]);
+    }
+    CHECK(ok);
+    CHECK((Host_Peek(&RCC->APB2ENR) & 0x1CUL) == 0x1CUL);
+    CHECK(Host_Peek(&GPIOD->CRL) == 0x44444444UL);
+
+    /* Pin ngoài cấu hình giữ nguyên, pin cấu hình lặp lại thì dòng sau thắng */
+    {
+        static const Port_PinConfigType partial[2] = {
+            { .PortNum = PORT_ID_B, .PinNum = 2, .Mode = PORT_PIN_MODE_DIO,
+              .Direction = PORT_PIN_OUT, .Pull = PORT_PIN_PULL_UP, .Level = PORT_PIN_LEVEL_HIGH },
+            { .PortNum = PORT_ID_B, .PinNum = 2, .Mode = PORT_PIN_MODE_DIO,
+              .Direction = PORT_PIN_IN, .Pull = PORT_PIN_PULL_DOWN },
+        };
+        const Port_ConfigType configPartial = { partial, 2 };
+
+        BENCH("1 pin: Port_Init (read-modify-write)", Port_Init(&configPartial));
+        CHECK(Host_Peek(&GPIOB->CRL) == ((expected[1][0] & ~0x00000F00UL) | 0x00000800UL));
+        CHECK(Host_Peek(&GPIOB->CRH) == expected[1][1]);
+        CHECK(Host_Peek(&GPIOB->ODR) == (expected[1][2] & ~0x0004UL));
+    }
+
+    /* Đổi chiều/mode runtime: cách cũ chạy lại clock + GPIO_Init cho pin */
+    {
+        Port_PinConfigType pb0 = Bench_PortPins[16];   /* PB0: input floating */
+
+        Port_Init(&config);
+        pb0.Direction = PORT_PIN_OUT;
+        BENCH("SetPinDirection old: clock + GPIO_Init", Bench_PortInitPerPin(&pb0, 1));
+        CHECK((Host_Peek(&GPIOB->CRL) & 0xFUL) == 0x6UL);
+        pb0.Direction = PORT_PIN_IN;
+        Bench_PortInitPerPin(&pb0, 1);
+
+        BENCH("Port_SetPinDirection(PB0, OUT)", Port_SetPinDirection(16, PORT_PIN_OUT));
+        CHECK((Host_Peek(&GPIOB->CRL) & 0xFUL) == 0x6UL);     /* Output OD 2 MHz */
+        BENCH("Port_SetPinDirection(PB0, IN)", Port_SetPinDirection(16, PORT_PIN_IN));
+        CHECK((Host_Peek(&GPIOB->CRL) & 0xFUL) == 0x4UL);
+        CHECK(Bench_PortPins[16].Direction == PORT_PIN_IN); /* Config không bị sửa */
+
+        /* PB2 output pull-up -> input: pull chọn qua ODR */
+        GPIOB->BRR = GPIO_Pin_2;
+        BENCH("Port_SetPinDirection(PB2, IN pull-up)", Port_SetPinDirection(18, PORT_PIN_IN));
+        CHECK((Host_Peek(&GPIOB->CRL) & 0xF00UL) == 0x800UL);
+        CHECK(Host_Peek(&GPIOB->ODR) & GPIO_Pin_2);
+
+        BENCH("Port_SetPinMode(PB0, PWM)", Port_SetPinMode(16, PORT_PIN_MODE_PWM));
+        CHECK((Host_Peek(&GPIOB->CRL) & 0xFUL) == 0xAUL);     /* AF PP 2 MHz */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Port_SetPinMode(16, PORT_PIN_MODE_COUNT);
+        CHECK((Host_Peek(&GPIOB->CRL) & 0xFUL) == 0xAUL);
+#endif
+
+        /* PB3 không cho đổi */
+        Port_SetPinDirection(19, PORT_PIN_OUT);
+        Port_SetPinMode(19, PORT_PIN_MODE_PWM);
+        CHECK((Host_Peek(&GPIOB->CRL) & 0xF000UL) == 0x6000UL);     /* Giữ output OD */
+    }
+}
+
+void Bench_PortRefresh(void)
+{
+    /* Ba pin không đổi chiều đứng đầu để chạy lại theo cách cũ */
+    static const Port_PinConfigType pins[4] = {
+        { .PortNum = PORT_ID_A, .PinNum = 1, .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_OUT,
+          .Pull = PORT_PIN_PULL_UP, .Speed = PORT_SPEED_50Mhz },
+        { .PortNum = PORT_ID_A, .PinNum = 9, .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_IN,
+          .Pull = PORT_PIN_PULL_UP },
+        { .PortNum = PORT_ID_B, .PinNum = 5, .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_OUT,
+          .Pull = PORT_PIN_PULL_UP, .Speed = PORT_SPEED_10Mhz, .ModeChangeable = 1 },
+        { .PortNum = PORT_ID_A, .PinNum = 0, .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_OUT,
+          .DirectionChangeable = 1, .ModeChangeable = 1 },
+    };
+    const Port_ConfigType config = { pins, 4 };
+    uint32_t driftA, driftB;
+
+    Port_Init(&config);
+    driftA = Port_GetDriftCount(PORT_ID_A);
+    driftB = Port_GetDriftCount(PORT_ID_B);
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Port refresh", "loads", "stores", "total", "instrs");
+    BENCH("Refresh old: clock + GPIO_Init x3", Bench_PortInitPerPin(pins, 3));
+    BENCH("Port_RefreshPortDirection (no drift)", Port_RefreshPortDirection());
+    CHECK(Port_GetDriftCount(PORT_ID_A) == driftA && Port_GetDriftCount(PORT_ID_B) == driftB);
+
+    /* PA1 và PA9 bị nhiễu, PA0 cho đổi chiều nên không bị sửa */
+    GPIOA->CRL = (GPIOA->CRL & ~0xFFUL) | 0x4FUL;
+    GPIOA->CRH = GPIOA->CRH & ~0xF0UL;
+    BENCH("Port_RefreshPortDirection (2 pins drift)", Port_RefreshPortDirection());
+    CHECK((Host_Peek(&GPIOA->CRL) & 0xFFUL) == 0x3FUL);
+    CHECK((Host_Peek(&GPIOA->CRH) & 0xF0UL) == 0x80UL);
+    CHECK(Port_GetDriftCount(PORT_ID_A) == driftA + 2U);
+    CHECK(Port_GetDriftCount(PORT_ID_B) == driftB);
+
+    /* Đổi mode hợp lệ của pin khóa chiều không bị refresh đảo lại */
+    Port_SetPinMode(2, PORT_PIN_MODE_PWM);
+    Port_RefreshPortDirection();
+    CHECK((Host_Peek(&GPIOB->CRL) & 0xF00000UL) == 0x900000UL);     /* AF PP 10 MHz */
+    CHECK(Port_GetDriftCount(PORT_ID_B) == driftB);
+    CHECK(Port_GetDriftCount(PORT_COUNT) == 0);
+}
+
+void Bench_PortGenerated(void)
+{
+    const Port_ConfigType built = { PortCfg_Pins, PortCfg_PinsCount, NULL };
+    uint32_t expected[BENCH_PORT_USED][3];
+    uint32_t actual[BENCH_PORT_USED][3];
+    uint32_t ok = 1;
+    uint32_t drift[PORT_COUNT];
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Port generated config", "loads", "stores", "total", "instrs");
+
+    Host_ModelReset();
+    BENCH("Port_Init (images built at boot)", Port_Init(&built));
+    Bench_PortSave(expected);
+    Host_ModelReset();
+    BENCH("Port_Init (PortCfg_Images)", Port_Init(&PortCfg_Config));
+    Bench_PortSave(actual);
+
+    for (uint8_t p = 0; p < BENCH_PORT_USED; p++) {
+        for (uint8_t r = 0; r < 3; r++) ok &= (actual[p][r] == expected[p][r]);
+    }
+    CHECK(ok);
+
+    /* Mask refresh sinh sẵn khớp: không có drift giả */
+    for (uint8_t p = 0; p < PORT_COUNT; p++) drift[p] = Port_GetDriftCount(p);
+    Port_RefreshPortDirection();
+    ok = 1;
+    for (uint8_t p = 0; p < PORT_COUNT; p++) ok &= (Port_GetDriftCount(p) == drift[p]);
+    CHECK(ok);
+    GPIOA->CRL &= ~0xF0UL;      /* PA1 (PWM, khóa chiều) bị nhiễu */
+    Port_RefreshPortDirection();
+    CHECK(Host_Peek(&GPIOA->CRL) == actual[PORT_ID_A][0]);
+    CHECK(Port_GetDriftCount(PORT_ID_A) == drift[PORT_ID_A] + 1U);
+}
+
+/* Cách cũ: một GPIO_PinRemapConfig (đọc-sửa-ghi MAPR) cho mỗi remap */
+static void Bench_PortRemapSpl(void)
+{
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
+    GPIO_PinRemapConfig(GPIO_Remap_SWJ_JTAGDisable, ENABLE);
+    GPIO_PinRemapConfig(GPIO_PartialRemap1_TIM2, ENABLE);
+    GPIO_PinRemapConfig(GPIO_PartialRemap_TIM3, ENABLE);
+    GPIO_PinRemapConfig(GPIO_Remap1_CAN1, ENABLE);
+}
+
+void Bench_PortRemap(void)
+{
+    /* TIM2_CH2 PB3, TIM3_CH2 PB5, CAN RX/TX PB8/PB9, I2C2 PB10/PB11, ADC PA4, LIN RX PA3 */
+    static const Port_PinConfigType pins[8] = {
+        { .PortNum = PORT_ID_B, .PinNum = 3, .Mode = PORT_PIN_MODE_PWM, .Direction = PORT_PIN_OUT,
+          .Speed = PORT_SPEED_50Mhz },
+        { .PortNum = PORT_ID_B, .PinNum = 5, .Mode = PORT_PIN_MODE_PWM, .Direction = PORT_PIN_OUT,
+          .Speed = PORT_SPEED_50Mhz },
+        { .PortNum = PORT_ID_B, .PinNum = 8, .Mode = PORT_PIN_MODE_CAN, .Direction = PORT_PIN_IN,
+          .Pull = PORT_PIN_PULL_UP },
+        { .PortNum = PORT_ID_B, .PinNum = 9, .Mode = PORT_PIN_MODE_CAN, .Direction = PORT_PIN_OUT,
+          .Speed = PORT_SPEED_50Mhz },
+        { .PortNum = PORT_ID_B, .PinNum = 10, .Mode = PORT_PIN_MODE_AF_OD, .Direction = PORT_PIN_OUT,
+          .Speed = PORT_SPEED_2Mhz },
+        { .PortNum = PORT_ID_B, .PinNum = 11, .Mode = PORT_PIN_MODE_AF_OD, .Direction = PORT_PIN_IN,
+          .Speed = PORT_SPEED_2Mhz },
+        { .PortNum = PORT_ID_A, .PinNum = 4, .Mode = PORT_PIN_MODE_ADC, .Direction = PORT_PIN_IN },
+        { .PortNum = PORT_ID_A, .PinNum = 3, .Mode = PORT_PIN_MODE_LIN, .Direction = PORT_PIN_IN },
+    };
+    const Port_ConfigType config = {
+        .PinConfigs = pins, .PinCount = 8,
+        .Remap = PORT_REMAP_TIM2_PARTIAL1 | PORT_REMAP_TIM3_PARTIAL | PORT_REMAP_CAN_PB8_PB9,
+        .SwjCfg = PORT_SWJ_SWD
+    };
+    const Port_ConfigType plain = { .PinConfigs = pins + 6, .PinCount = 2 };
+    const uint32_t mapr = AFIO_MAPR_SWJ_CFG_JTAGDISABLE | AFIO_MAPR_TIM2_REMAP_PARTIALREMAP1 |
+                          AFIO_MAPR_TIM3_REMAP_PARTIALREMAP | AFIO_MAPR_CAN_REMAP_REMAP2;
+    uint8 afioRefs;
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Port AFIO remap", "loads", "stores", "total", "instrs");
+
+    Host_ModelReset();
+    BENCH("3 remaps + SWJ: GPIO_PinRemapConfig", Bench_PortRemapSpl());
+    /* SPL ghi 111 vào SWJ_CFG ở mỗi remap thường (trường chỉ ghi, không đọc lại được) */
+    CHECK((Host_Peek(&AFIO->MAPR) & PORT_REMAP_MASK) == (mapr & PORT_REMAP_MASK));
+
+    Host_ModelReset();
+    Port_Init(&plain);
+    afioRefs = Clk_GetRefCount(CLK_AFIO);
+    BENCH("3 remaps + SWJ: Port_Init (8 pins)", Port_Init(&config));
+    CHECK(Host_Peek(&AFIO->MAPR) == mapr);
+    CHECK(Host_Peek(&RCC->APB2ENR) & RCC_APB2Periph_AFIO);
+    CHECK(Clk_GetRefCount(CLK_AFIO) == afioRefs + 1U);
+
+    /* Bảng tra mode: CAN RX pull-up, CAN TX AF PP, AF OD cả hai chiều, ADC analog, LIN RX floating */
+    CHECK((Host_Peek(&GPIOB->CRH) & 0xFFFFUL) == 0xEEB8UL);
+    CHECK(Host_Peek(&GPIOB->ODR) & GPIO_Pin_8);
+    CHECK((Host_Peek(&GPIOB->CRL) & 0xF0F000UL) == 0xB0B000UL);
+    CHECK((Host_Peek(&GPIOA->CRL) & 0xFF000UL) == 0x04000UL);
+
+    /* Init lại cùng remap: không ghi MAPR nữa */
+    AFIO->MAPR = 0;
+    Port_Init(&config);
+    CHECK(Host_Peek(&AFIO->MAPR) == 0);
+
+    /* Bỏ remap: MAPR về reset (ghi khi AFIO còn clock) rồi trả clock */
+    AFIO->MAPR = mapr;
+    Port_Init(&plain);
+    CHECK(Host_Peek(&AFIO->MAPR) == 0);
+    CHECK(Clk_GetRefCount(CLK_AFIO) == afioRefs);
+
+    /* Đổi mode runtime sang mode mới dùng cùng bảng tra */
+    {
+        static const Port_PinConfigType pa5 = {
+            .PortNum = PORT_ID_A, .PinNum = 5, .Mode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_IN,
+            .ModeChangeable = 1
+        };
+        const Port_ConfigType one = { .PinConfigs = &pa5, .PinCount = 1 };
+
+        Port_Init(&one);
+        Port_SetPinMode(0, PORT_PIN_MODE_ADC);
+        CHECK((Host_Peek(&GPIOA->CRL) & 0xF00000UL) == 0);
+        Port_SetPinMode(0, PORT_PIN_MODE_AF_OD);
+        CHECK((Host_Peek(&GPIOA->CRL) & 0xF00000UL) == 0xE00000UL);
+    }
+}
+
+/* Cách cũ trước STOP: GPIO_Init analog mọi pin không giữ của từng cổng */
+static void Bench_PortSleepSpl(void)
+{
+    GPIO_InitTypeDef init = { .GPIO_Speed = GPIO_Speed_2MHz, .GPIO_Mode = GPIO_Mode_AIN };
+
+    init.GPIO_Pin = GPIO_Pin_All;
+    GPIO_Init(GPIOA, &init);
+    init.GPIO_Pin = GPIO_Pin_All & ~GPIO_Pin_0;     /* PB0 (Relay) giữ */
+    GPIO_Init(GPIOB, &init);
+    init.GPIO_Pin = GPIO_Pin_All;
+    GPIO_Init(GPIOC, &init);
+}
+
+void Bench_PortProfile(void)
+{
+    const Port_ConfigType built = { PortCfg_Pins, PortCfg_PinsCount, NULL };
+    uint32_t active[BENCH_PORT_USED][3];
+    uint32_t expected[BENCH_PORT_USED][3];
+    uint32_t actual[BENCH_PORT_USED][3];
+    uint32_t ok = 1;
+    Host_BusCountType c;
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Port profile", "loads", "stores", "total", "instrs");
+
+    Host_ModelReset();
+    Port_Init(&PortCfg_Config);
+    BENCH("Sleep old: GPIO_Init analog x3 ports", Bench_PortSleepSpl());
+    Bench_PortSave(expected);
+    BENCH("Wake old: Port_Init", Port_Init(&PortCfg_Config));
+
+    /* Trạng thái runtime phải được khôi phục: PA0 đã đổi chiều, PA8 ngoài
+     * config do ứng dụng đặt, Relay (PB0) đang bật */
+    Port_SetPinDirection(0, PORT_PIN_IN);
+    GPIOA->CRH = (GPIOA->CRH & ~0xFUL) | 0x3UL;
+    GPIOB->BSRR = GPIO_Pin_0;
+    Bench_PortSave(active);
+
+    BENCH("Port_SetProfile(SLEEP)", CHECK(Port_SetProfile(PORT_PROFILE_SLEEP) == E_OK));
+    Bench_PortSave(actual);
+    for (uint8_t p = 0; p < BENCH_PORT_USED; p++) {
+        ok &= (actual[p][0] == expected[p][0]) && (actual[p][1] == expected[p][1]);
+    }
+    CHECK(ok);
+    CHECK(Host_Peek(&GPIOB->ODR) & GPIO_Pin_0);
+    CHECK(Host_Peek(&GPIOD->CRL) == 0x44444444UL);             /* Cổng không dùng không bị đụng */
+    CHECK(Port_GetProfile() == PORT_PROFILE_SLEEP);
+
+    /* Ngoài ACTIVE: refresh không đọc cổng, đổi chiều bị bỏ qua */
+    Host_BusCountStart();
+    Port_RefreshPortDirection();
+    Port_SetPinDirection(0, PORT_PIN_OUT);
+    c = Host_BusCountStop();
+    CHECK(c.Loads == 0 && c.Stores == 0);
+    Host_BusCountStart();
+    CHECK(Port_SetProfile(PORT_PROFILE_SLEEP) == E_OK);
+    c = Host_BusCountStop();
+    CHECK(c.Loads == 0 && c.Stores == 0);
+    CHECK(Port_SetProfile(PORT_PROFILE_COUNT) == E_NOT_OK);
+
+    BENCH("Port_SetProfile(ACTIVE)", CHECK(Port_SetProfile(PORT_PROFILE_ACTIVE) == E_OK));
+    Bench_PortSave(actual);
+    ok = 1;
+    for (uint8_t p = 0; p < BENCH_PORT_USED; p++) {
+        for (uint8_t r = 0; r < 3; r++) ok &= (actual[p][r] == active[p][r]);
+    }
+    CHECK(ok);
+
+    /* SAFE: PWM và Relay lái mức thấp (output PP 2 MHz), còn lại analog */
+    BENCH("Port_SetProfile(SAFE)", CHECK(Port_SetProfile(PORT_PROFILE_SAFE) == E_OK));
+    CHECK(Host_Peek(&GPIOA->CRL) == 0x20000020UL);
+    CHECK(Host_Peek(&GPIOA->CRH) == 0);
+    CHECK(Host_Peek(&GPIOB->CRL) == 0x00000002UL);
+    CHECK((Host_Peek(&GPIOA->ODR) & (GPIO_Pin_1 | GPIO_Pin_7)) == 0);
+    CHECK((Host_Peek(&GPIOB->ODR) & GPIO_Pin_0) == 0);
+    Port_SetProfile(PORT_PROFILE_SLEEP);
+    CHECK(Host_Peek(&GPIOB->CRL) == 0x00000007UL);              /* SLEEP giữ nibble active */
+    Port_SetProfile(PORT_PROFILE_ACTIVE);
+    Bench_PortSave(actual);
+    ok = 1;
+    for (uint8_t p = 0; p < BENCH_PORT_USED; p++) {
+        for (uint8_t r = 0; r < 3; r++) ok &= (actual[p][r] == active[p][r]);
+    }
+    CHECK(ok);                                                  /* Relay bật lại */
+
+    /* Ảnh profile sinh sẵn khớp ảnh Port_Init tự dựng; lần chuyển đầu
+     * tiên sau Port_Init(&built) không dựng gì thêm nên tốn như nhau */
+    ok = 1;
+    for (Port_ProfileType prof = PORT_PROFILE_SLEEP; prof < PORT_PROFILE_COUNT; prof++) {
+        Host_BusCountType first;
+
+        Host_ModelReset();
+        Port_Init(&built);
+        Host_BusCountStart();
+        Port_SetProfile(prof);
+        first = Host_BusCountStop();
+        Bench_PortSave(expected);
+        Host_ModelReset();
+        Port_Init(&PortCfg_Config);
+        Host_BusCountStart();
+        Port_SetProfile(prof);
+        c = Host_BusCountStop();
+        Bench_PortSave(actual);
+        ok &= (first.Instrs == c.Instrs);
+        for (uint8_t p = 0; p < BENCH_PORT_USED; p++) {
+            for (uint8_t r = 0; r < 3; r++) ok &= (actual[p][r] == expected[p][r]);
+        }
+    }
+    CHECK(ok);
+
+    /* Port_Init lại đưa profile về ACTIVE */
+    Port_Init(&PortCfg_Config);
+    CHECK(Port_GetProfile() == PORT_PROFILE_ACTIVE);
+}
+
+void Bench_PortLock(void)
+{
+    /* PD1..PD7 và PC14 cố định, PD9 khóa chiều nhưng đổi mode được, PD0 tự do */
+    static Port_PinConfigType pins[11];
+    const Port_ConfigType config = { pins, 10 };
+    const Port_ConfigType configMore = { pins, 11 };
+    Host_BusCountType c;
+    uint32_t driftD;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        pins[i] = (Port_PinConfigType){ .PortNum = PORT_ID_D, .PinNum = i, .Mode = PORT_PIN_MODE_DIO,
+                                        .Direction = PORT_PIN_OUT, .Pull = PORT_PIN_PULL_UP };
+    }
+    pins[0].DirectionChangeable = 1;
+    pins[0].ModeChangeable = 1;
+    pins[8] = (Port_PinConfigType){ .PortNum = PORT_ID_D, .PinNum = 9, .Mode = PORT_PIN_MODE_DIO,
+                                    .Direction = PORT_PIN_IN, .ModeChangeable = 1 };
+    pins[9] = (Port_PinConfigType){ .PortNum = PORT_ID_C, .PinNum = 14, .Mode = PORT_PIN_MODE_DIO,
+                                    .Direction = PORT_PIN_IN, .Pull = PORT_PIN_PULL_DOWN };
+    pins[10] = (Port_PinConfigType){ .PortNum = PORT_ID_D, .PinNum = 10, .Mode = PORT_PIN_MODE_DIO,
+                                     .Direction = PORT_PIN_IN };
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Port lock", "loads", "stores", "total", "instrs");
+
+    Port_Init(&config);
+    BENCH("Port_RefreshPortDirection (unlocked)", Port_RefreshPortDirection());
+
+    /* Ở SLEEP pin đang analog: không khóa, không chạm LCKR */
+    Port_SetProfile(PORT_PROFILE_SLEEP);
+    CHECK(Port_LockConfig() == E_NOT_OK);
+    CHECK(Host_Peek(&GPIOD->LCKR) == 0 && Host_Peek(&GPIOC->LCKR) == 0);
+    Port_SetProfile(PORT_PROFILE_ACTIVE);
+
+    BENCH("Port_LockConfig (PC, PD)", CHECK(Port_LockConfig() == E_OK));
+    CHECK(Host_Peek(&GPIOD->LCKR) == (GPIO_LCKR_LCKK | 0x00FEUL));
+    CHECK(Host_Peek(&GPIOC->LCKR) == (GPIO_LCKR_LCKK | 0x4000UL));
+    BENCH("Port_RefreshPortDirection (locked)", Port_RefreshPortDirection());
+
+    /* SLEEP không ghi đè pin khóa: chỉ PD0 thành analog */
+    {
+        uint32_t crl = Host_Peek(&GPIOD->CRL);
+
+        Port_SetProfile(PORT_PROFILE_SLEEP);
+        CHECK(Host_Peek(&GPIOD->CRL) == (crl & ~0xFUL));
+        CHECK((Host_Peek(&GPIOC->CRH) & 0x0F000000UL) == (0x8UL << 24));   /* PC14 */
+        Port_SetProfile(PORT_PROFILE_ACTIVE);
+        CHECK(Host_Peek(&GPIOD->CRL) == crl);
+    }
+
+    /* PD9 vẫn được refresh; nibble pin khóa không còn bị so */
+    driftD = Port_GetDriftCount(PORT_ID_D);
+    GPIOD->CRH &= ~0xF0UL;
+    GPIOD->CRL &= ~0xF0UL;
+    Port_RefreshPortDirection();
+    CHECK((Host_Peek(&GPIOD->CRH) & 0xF0UL) == 0x40UL);
+    CHECK((Host_Peek(&GPIOD->CRL) & 0xF0UL) == 0);
+    CHECK(Port_GetDriftCount(PORT_ID_D) == driftD + 1U);
+    GPIOD->CRL |= 0x30UL;
+
+    /* Gọi lại: không chạy lại chuỗi khóa */
+    Host_BusCountStart();
+    CHECK(Port_LockConfig() == E_OK);
+    c = Host_BusCountStop();
+    CHECK(c.Loads == 0 && c.Stores == 0);
+
+    /* Khóa giữ qua Port_Init; pin cố định mới trên cổng đã khóa bị báo lỗi */
+    Port_Init(&configMore);
+    Host_BusCountStart();
+    Port_RefreshPortDirection();
+    c = Host_BusCountStop();
+    CHECK(c.Loads == 1 && c.Stores == 0);      /* Chỉ CRH của PD (PD9, PD10) */
+    CHECK(Port_LockConfig() == E_NOT_OK);
+}
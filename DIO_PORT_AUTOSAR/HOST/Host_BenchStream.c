@@ -0,0 +1,127 @@
+/**********************************************************
+ * @file    Host_BenchStream.c
+ * @brief   Kiểm tra Dio_Stream (TIM update -> DMA1 -> BSRR) trên mô hình host
+ * @details Mỗi Host_TimerUpdate() là một update event; sau mỗi event
+ *          đọc lại ODR để so chuỗi mức chân phát ra với buffer. Buffer
+ *          là biến static vì CMAR chỉ giữ được địa chỉ 32 bit.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_Stream.h"
+#include "Clk.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Stream ra PB12..PB15, các chân khác của cổng B không bị đụng tới */
+#define BENCH_STREAM_SHIFT   12U
+#define BENCH_STREAM_MASK    0xFUL
+#define BENCH_BSRR(v)        ((((uint32_t)(v) & BENCH_STREAM_MASK) << BENCH_STREAM_SHIFT) | \
+                              ((~(uint32_t)(v) & BENCH_STREAM_MASK) << (BENCH_STREAM_SHIFT + 16U)))
+#define BENCH_STREAM_PINS()  ((Host_Peek(&GPIOB->ODR) >> BENCH_STREAM_SHIFT) & BENCH_STREAM_MASK)
+
+static uint32_t Bench_Pattern[8];
+static uint32_t Bench_Ring[8];
+static uint32_t Bench_NextValue;     /* Giá trị kế tiếp nạp vào double buffer */
+static uint32_t Bench_HalfCalls;
+static uint32_t Bench_CompleteCalls;
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Nạp lại nửa buffer vừa phát xong bằng các giá trị kế tiếp */
+static void Bench_Refill(const uint32* Chunk, uint16 Length)
+{
+    uint32_t* dst = &Bench_Ring[Chunk - Bench_Ring];
+    for (uint16 i = 0; i < Length; i++, Bench_NextValue++) dst[i] = BENCH_BSRR(Bench_NextValue);
+}
+
+static void Bench_OnHalf(const uint32* Chunk, uint16 Length)
+{
+    Bench_HalfCalls++;
+    Bench_Refill(Chunk, Length);
+}
+
+static void Bench_OnComplete(const uint32* Chunk, uint16 Length)
+{
+    Bench_CompleteCalls++;
+    Bench_Refill(Chunk, Length);
+}
+
+static void Bench_OnOneShotDone(const uint32* Chunk, uint16 Length)
+{
+    (void)Chunk;
+    (void)Length;
+    Bench_CompleteCalls++;
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioStream(void)
+{
+    static const uint8_t walk[8] = { 0x1, 0x2, 0x4, 0x8, 0x8, 0x4, 0x2, 0x1 };
+    static const Dio_StreamTimerType circular = { TIM4, 71, 9, DIO_STREAM_CIRCULAR, NULL, NULL };
+    static const Dio_StreamTimerType ring = { TIM4, 0, 17, DIO_STREAM_DOUBLE_BUFFER,
+                                              Bench_OnHalf, Bench_OnComplete };
+    static const Dio_StreamTimerType oneshot = { TIM4, 0, 17, DIO_STREAM_ONESHOT,
+                                                 NULL, Bench_OnOneShotDone };
+    uint32_t ok;
+
+    for (uint8_t i = 0; i < 8; i++) Bench_Pattern[i] = BENCH_BSRR(walk[i]);
+    DIO_WritePort(DIO_PORT_B, 0x0021);
+
+    /* Circular, không callback: lặp pattern, CPU không truy cập bus */
+    BENCH("Dio_StreamStart(B, 8 words, circular)",
+          (void)Dio_StreamStart(DIO_PORT_B, Bench_Pattern, 8, &circular));
+    CHECK(Dio_StreamIsBusy(TIM4));
+    ok = 1;
+    for (uint32_t k = 0; k < 20; k++) {
+        Host_TimerUpdate(TIM4);
+        ok &= (BENCH_STREAM_PINS() == walk[k % 8]);
+    }
+    CHECK(ok);
+    CHECK((Host_Peek(&GPIOB->ODR) & 0x0FFFUL) == 0x0021UL);   /* Chân khác giữ nguyên */
+    BENCH("16 samples circular (CPU, no callback)",
+          for (uint32_t k = 0; k < 16; k++) Host_TimerUpdate(TIM4));
+    CHECK(BENCH_STREAM_PINS() == walk[(20 + 16 - 1) % 8]);
+    Dio_StreamStop(TIM4);
+    CHECK(!Dio_StreamIsBusy(TIM4));
+    Host_TimerUpdate(TIM4);
+    CHECK(BENCH_STREAM_PINS() == walk[(20 + 16 - 1) % 8]);
+
+    /* Double buffer: callback nạp lại nửa vừa phát, chuỗi ra liên tục */
+    Bench_NextValue = 0;
+    Bench_Refill(Bench_Ring, 8);
+    (void)Dio_StreamStart(DIO_PORT_B, Bench_Ring, 8, &ring);
+    ok = 1;
+    for (uint32_t k = 0; k < 40; k++) {
+        Host_TimerUpdate(TIM4);
+        ok &= (BENCH_STREAM_PINS() == (k & BENCH_STREAM_MASK));
+    }
+    CHECK(ok);
+    CHECK(Bench_HalfCalls == 5 && Bench_CompleteCalls == 5);
+    Dio_StreamStop(TIM4);
+
+    /* One-shot: phát 5 word rồi tự dừng, callback đúng một lần */
+    Bench_CompleteCalls = 0;
+    (void)Dio_StreamStart(DIO_PORT_B, Bench_Pattern, 5, &oneshot);
+    for (uint32_t k = 0; k < 12; k++) Host_TimerUpdate(TIM4);
+    CHECK(BENCH_STREAM_PINS() == walk[4]);
+    CHECK(Bench_CompleteCalls == 1);
+    CHECK(!Dio_StreamIsBusy(TIM4));
+    CHECK((Host_Peek(&TIM4->CR1) & TIM_CR1_CEN) == 0);
+    CHECK(Clk_GetOwner(CLK_TIM4) == CLK_OWNER_DIO_STREAM);    /* Giữ đến Stop */
+    Dio_StreamStop(TIM4);
+    CHECK(Clk_GetOwner(CLK_TIM4) == CLK_OWNER_NONE);
+
+    /* Tham số sai bị Det chặn */
+    CHECK(Dio_StreamStart(DIO_PORT_B, Bench_Ring, 7, &ring) == E_NOT_OK);
+    CHECK(Dio_StreamStart(4, Bench_Pattern, 8, &circular) == E_NOT_OK);
+}
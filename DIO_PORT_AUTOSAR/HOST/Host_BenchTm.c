@@ -0,0 +1,73 @@
+/**********************************************************
+ * @file    Host_BenchTm.c
+ * @brief   Kiểm tra Tm (CYCCNT + SysTick) trên mô hình host
+ * @details Trên host một chu kỳ là một lệnh đã chạy trong vùng đếm,
+ *          nên độ dài vòng chờ đo bằng Instrs phải bằng số chu kỳ yêu
+ *          cầu cộng sai số một vòng poll. SysTick không tự chạy:
+ *          bench gọi SysTick_Handler như một lần ngắt.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Tm.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define BENCH_TM_SLACK      24U     /* Lệnh gọi hàm + một vòng poll */
+
+extern void SysTick_Handler(void);
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_Tm(void)
+{
+    Host_BusCountType c;
+    uint64_t c0, c1, c2;
+    uint32_t t0, t1;
+
+    Tm_Init();
+    CHECK(Host_Peek(&SysTick->LOAD) == SystemCoreClock / TM_SYSTICK_HZ - 1U);
+    CHECK((Host_Peek(&SysTick->CTRL) & 0x7U) == 0x7U);
+    CHECK(Host_Peek(&DWT->CTRL) & DWT_CTRL_CYCCNTENA_Msk);
+
+    printf("\n%-40s %6s %6s %6s %6s\n", "Tm", "loads", "stores", "total", "instrs");
+
+    /* Chờ ngắn: đúng số chu kỳ, không phụ thuộc mức tối ưu */
+    Host_BusCountStart();
+    Tm_BusyWaitCycles(100);
+    c = Host_BusCountStop();
+    printf("%-40s %6u %6u %6u %6u\n", "Tm_BusyWaitCycles(100)", (unsigned)c.Loads,
+           (unsigned)c.Stores, (unsigned)(c.Loads + c.Stores), (unsigned)c.Instrs);
+    CHECK(c.Instrs >= 100U && c.Instrs < 100U + BENCH_TM_SLACK);
+
+    Host_BusCountStart();
+    Tm_BusyWaitUs(10);
+    c = Host_BusCountStop();
+    printf("%-40s %6u %6u %6u %6u\n", "Tm_BusyWaitUs(10) @72 MHz", (unsigned)c.Loads,
+           (unsigned)c.Stores, (unsigned)(c.Loads + c.Stores), (unsigned)c.Instrs);
+    CHECK(c.Instrs >= 720U && c.Instrs < 720U + BENCH_TM_SLACK);
+
+    /* Mốc µs tăng ít nhất bằng thời gian đã chờ */
+    t0 = Tm_GetTimestampUs();
+    Tm_BusyWaitUs(25);
+    t1 = Tm_GetTimestampUs();
+    CHECK(t1 - t0 >= 25U && t1 - t0 < 30U);
+
+    /* CYCCNT tràn: phần cao tăng ngay cả khi SysTick chưa chạy */
+    DWT->CYCCNT = 0xFFFFF000UL;
+    SysTick_Handler();
+    c0 = Tm_GetCycles64();
+    Tm_BusyWaitCycles(0x2000);
+    c1 = Tm_GetCycles64();
+    SysTick_Handler();
+    c2 = Tm_GetCycles64();
+    CHECK((c0 >> 32) == 0 && (c1 >> 32) == 1 && (c2 >> 32) == 1);
+    CHECK(c1 - c0 >= 0x2000U && c2 >= c1);
+    CHECK(Tm_GetTimeUs64() >= c2 / 72U);
+}
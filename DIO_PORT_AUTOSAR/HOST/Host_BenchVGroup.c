@@ -0,0 +1,95 @@
+/**********************************************************
+ * @file    Host_BenchVGroup.c
+ * @brief   Kiểm tra nhóm kênh ảo nhiều cổng (Dio_Bus12Group, PA/PB)
+ * @details So kết quả scatter/gather bằng bảng với cách làm từng bit
+ *          qua Dio_ChannelMap, rồi đo chi phí hai cách.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Host_Bench.h"
+#include "Dio_Lcfg.h"    /* Dio_Bus12Group */
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Cùng danh sách chân với Dio_Bus12Group (mcal_config.json -> Dio_Lcfg.c) */
+static const Dio_ChannelType Bench_BusPins[12] = {
+    DIO_CHANNEL_A8, DIO_CHANNEL_A9, DIO_CHANNEL_A10, DIO_CHANNEL_A11, DIO_CHANNEL_A12, DIO_CHANNEL_A6,
+    DIO_CHANNEL_B5, DIO_CHANNEL_B6, DIO_CHANNEL_B7, DIO_CHANNEL_B8, DIO_CHANNEL_B9, DIO_CHANNEL_B10
+};
+
+#define BENCH_BUS_MASK_A    0x1F40U
+#define BENCH_BUS_MASK_B    0x07E0U
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Mức chân của cổng Port ứng với giá trị bus, tính từng bit */
+static uint16_t Bench_BusPortLevel(uint16_t value, uint8_t port)
+{
+    uint16_t level = 0;
+    for (uint8_t i = 0; i < 12; i++) {
+        if ((value >> i) & 1U && Bench_BusPins[i] / DIO_PINS_PER_PORT == port) {
+            level |= Dio_ChannelMap[Bench_BusPins[i]].mask;
+        }
+    }
+    return level;
+}
+
+static void Bench_BusWriteEach(uint16_t value)
+{
+    for (uint8_t i = 0; i < 12; i++) DIO_WriteChannel(Bench_BusPins[i], (value >> i) & 1U);
+}
+
+static uint16_t Bench_BusReadEach(void)
+{
+    uint16_t value = 0;
+    for (uint8_t i = 0; i < 12; i++) value |= (uint16_t)(DIO_ReadChannel(Bench_BusPins[i]) << i);
+    return value;
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Bench_DioVirtualGroup(void)
+{
+    uint32_t ok = 1;
+
+    CHECK(Dio_Bus12Group.width == 12);
+    CHECK(Dio_Bus12Group.mask[0] == BENCH_BUS_MASK_A && Dio_Bus12Group.mask[1] == BENCH_BUS_MASK_B);
+
+    /* Ghi: chỉ chân của bus đổi, các chân khác giữ nguyên */
+    DIO_WritePort(DIO_PORT_A, 0x0021);
+    DIO_WritePort(DIO_PORT_B, 0x4002);
+    for (uint16_t v = 0; v < 0x1000U; v += 0x0BDU) {
+        Dio_WriteVirtualGroup(&Dio_Bus12Group, v);
+        ok &= (Host_Peek(&GPIOA->ODR) == (0x0021U | Bench_BusPortLevel(v, DIO_PORT_A)));
+        ok &= (Host_Peek(&GPIOB->ODR) == (0x4002U | Bench_BusPortLevel(v, DIO_PORT_B)));
+    }
+    CHECK(ok);
+
+    /* Đọc: đưa mức từ bên ngoài vào các chân bus */
+    ok = 1;
+    for (uint16_t v = 0; v < 0x1000U; v += 0x0BDU) {
+        Host_SetInput(GPIOA, BENCH_BUS_MASK_A, Bench_BusPortLevel(v, DIO_PORT_A));
+        Host_SetInput(GPIOB, BENCH_BUS_MASK_B, Bench_BusPortLevel(v, DIO_PORT_B));
+        ok &= (Dio_ReadVirtualGroup(&Dio_Bus12Group) == v);
+    }
+    CHECK(ok);
+
+    Host_SetInput(GPIOA, BENCH_BUS_MASK_A, Bench_BusPortLevel(0xA5C, DIO_PORT_A));
+    Host_SetInput(GPIOB, BENCH_BUS_MASK_B, Bench_BusPortLevel(0xA5C, DIO_PORT_B));
+    BENCH("12x DIO_ReadChannel (bus PA/PB)", (void)Bench_BusReadEach());
+    BENCH("Dio_ReadVirtualGroup (bus PA/PB)", (void)Dio_ReadVirtualGroup(&Dio_Bus12Group));
+    CHECK(Bench_BusReadEach() == 0xA5C);
+    BENCH("12x DIO_WriteChannel (bus PA/PB)", Bench_BusWriteEach(0x3C6));
+    BENCH("Dio_WriteVirtualGroup (bus PA/PB)", Dio_WriteVirtualGroup(&Dio_Bus12Group, 0x3C6));
+    CHECK((Host_Peek(&GPIOB->ODR) & BENCH_BUS_MASK_B) == Bench_BusPortLevel(0x3C6, DIO_PORT_B));
+
+    CHECK(Dio_ReadVirtualGroup(NULL) == 0);
+}
@@ -0,0 +1,686 @@
+/**********************************************************
+ * @file    Host_Model.c
+ * @brief   Mô hình thanh ghi STM32F103 chạy trên máy host (Linux)
+ * @details Vùng ngoại vi được mmap vào đúng địa chỉ thật và để ở
+ *          trạng thái PROT_NONE. Mỗi lệnh truy cập gây SIGSEGV:
+ *          handler ghi nhận load/store, mở khóa vùng nhớ và bật cờ
+ *          TF để CPU chạy đúng một lệnh rồi báo SIGTRAP. Ở SIGTRAP
+ *          mô hình cập nhật side-effect của thanh ghi vừa ghi rồi
+ *          khóa lại vùng nhớ. Nhờ vậy mỗi truy cập volatile được
+ *          đếm đúng một lần mà driver không phải sửa gì.
+ *          Trong khi đếm, cờ TF được giữ bật để đếm luôn số lệnh
+ *          máy đã chạy (không phụ thuộc tải của máy host).
+ *
+ *          Lưu ý: gcc luôn tách `reg |= x` volatile thành load + store
+ *          riêng, nên mỗi lần bẫy tương ứng đúng một truy cập bus.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include "Host_Model.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "Host_Model chi ho tro Linux x86-64 (SIGSEGV + single-step bang co TF)"
+#endif
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define HOST_EFLAGS_TF      0x100UL   /* Trap flag: chạy từng lệnh */
+#define HOST_PF_WRITE       0x2UL     /* Bit W trong mã lỗi page fault */
+
+#define HOST_GPIO_RESET_CR  0x44444444UL  /* Tất cả chân là input floating */
+
+/* Các vùng ngoại vi được mô phỏng */
+typedef struct {
+    uintptr_t Base;
+    size_t    Size;
+} Host_RegionType;
+
+#define HOST_PERIPH_SIZE    0x24000UL     /* APB1, APB2, AHB (DMA, RCC, FLASH, CRC) */
+
+#define HOST_PPB_BASE       0xE0000000UL  /* ITM, DWT, FPB, SCS (NVIC, SysTick, SCB) */
+#define HOST_PPB_SIZE       0xF000UL
+
+static const Host_RegionType Host_Regions[] = {
+    { PERIPH_BASE,    HOST_PERIPH_SIZE },
+    { PERIPH_BB_BASE, HOST_PERIPH_SIZE * 32UL },  /* Alias bit-band: 1 word / bit */
+    { HOST_PPB_BASE,  HOST_PPB_SIZE }
+};
+#define HOST_REGION_COUNT   (sizeof(Host_Regions) / sizeof(Host_Regions[0]))
+
+static GPIO_TypeDef* const Host_GpioPorts[] = { GPIOA, GPIOB, GPIOC, GPIOD, GPIOE };
+#define HOST_GPIO_COUNT     (sizeof(Host_GpioPorts) / sizeof(Host_GpioPorts[0]))
+
+static volatile uint32_t Host_Loads;
+static volatile uint32_t Host_Stores;
+static volatile uint32_t Host_Instrs;
+static volatile uint32_t Host_InstrOverhead;    /* Số lệnh của chính Start/Stop */
+static volatile uint32_t Host_FirstAccess;      /* Host_Instrs ở truy cập bus đầu/cuối */
+static volatile uint32_t Host_LastAccess;
+static volatile uint8_t  Host_Counting;
+static volatile uintptr_t Host_PendingStore;   /* Địa chỉ vừa bị ghi, xử lý ở SIGTRAP */
+static volatile uint32_t Host_IsrAt;            /* Truy cập bus kích hoạt ngắt giả lập */
+static void (*volatile Host_Isr)(void);         /* Ngắt giả lập chạy sau truy cập Host_IsrAt */
+volatile uint32_t Host_Primask;                 /* PRIMASK giả lập (Dio_IrqSave/Dio_IrqRestore) */
+
+static void (*Host_OutputWatch)(GPIO_TypeDef* GPIOx, uint16_t Odr);
+static uint8_t  Host_Watching;                  /* Đang trong Host_OutputWatch */
+static uint8_t  Host_InputDirty;                /* Host_DriveInput gọi từ Watch */
+
+/* DWT->CYCCNT: khi đang đếm là Host_CycleBase + Host_Instrs; khi không
+ * đếm, mỗi lần đọc tăng HOST_IDLE_CYCLES để vòng chờ vẫn kết thúc */
+#define HOST_IDLE_CYCLES    4UL
+static volatile uint32_t Host_CycleBase;
+
+static uint16_t Host_InputMask[HOST_GPIO_COUNT];  /* Chân được kéo từ bên ngoài */
+static uint16_t Host_InputLevel[HOST_GPIO_COUNT]; /* Mức của các chân đó */
+
+/* DMA1: 7 kênh, ngắt DMA1_Channel1_IRQn..DMA1_Channel7_IRQn liên tiếp */
+static DMA_Channel_TypeDef* const Host_DmaChannels[] = {
+    DMA1_Channel1, DMA1_Channel2, DMA1_Channel3, DMA1_Channel4,
+    DMA1_Channel5, DMA1_Channel6, DMA1_Channel7
+};
+#define HOST_DMA_COUNT      (sizeof(Host_DmaChannels) / sizeof(Host_DmaChannels[0]))
+
+static uint8_t  Host_DmaEnabled[HOST_DMA_COUNT];  /* Bit EN lần ghi CCR trước */
+static uint16_t Host_DmaReload[HOST_DMA_COUNT];   /* CNDTR lúc bật kênh */
+static uint16_t Host_DmaPos[HOST_DMA_COUNT];      /* Số phần tử đã chuyển trong vòng */
+
+/* Yêu cầu DMA của timer -> kênh DMA1 (RM0008, bảng 78). Mỗi chu kỳ
+ * timer có một update event và một compare event trên mỗi kênh CC. */
+typedef struct {
+    TIM_TypeDef* TIMx;
+    uint16_t     Source;    /* Bit xDE trong DIER */
+    uint8_t      DmaIdx;    /* Kênh DMA1 - 1 */
+} Host_TimerDmaType;
+
+static const Host_TimerDmaType Host_TimerDma[] = {
+    { TIM1, TIM_DIER_CC1DE, 1 }, { TIM1, TIM_DIER_CC2DE, 2 }, { TIM1, TIM_DIER_CC3DE, 5 },
+    { TIM1, TIM_DIER_CC4DE, 3 }, { TIM1, TIM_DIER_UDE, 4 },
+    { TIM2, TIM_DIER_CC1DE, 4 }, { TIM2, TIM_DIER_CC2DE, 6 }, { TIM2, TIM_DIER_CC3DE, 0 },
+    { TIM2, TIM_DIER_CC4DE, 6 }, { TIM2, TIM_DIER_UDE, 1 },
+    { TIM3, TIM_DIER_CC1DE, 5 }, { TIM3, TIM_DIER_CC3DE, 1 }, { TIM3, TIM_DIER_CC4DE, 2 },
+    { TIM3, TIM_DIER_UDE, 2 },
+    { TIM4, TIM_DIER_CC1DE, 0 }, { TIM4, TIM_DIER_CC2DE, 3 }, { TIM4, TIM_DIER_CC3DE, 4 },
+    { TIM4, TIM_DIER_UDE, 6 }
+};
+#define HOST_TIMER_COUNT    (sizeof(Host_TimerDma) / sizeof(Host_TimerDma[0]))
+
+/* NVIC: ISER đọc về tập ngắt đang bật, ghi 1 để bật, ICER ghi 1 để tắt */
+static uint32_t Host_NvicEnabled[2];
+
+/* EXTI: PR ghi 1 để xóa, giữ bản sao vì lần ghi đã đè lên giá trị */
+static uint32_t Host_ExtiPending;
+
+/* Vector ngắt DMA1: weak để chạy được cả khi driver không định nghĩa */
+extern void DMA1_Channel1_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel2_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel3_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel4_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel5_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel6_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel7_IRQHandler(void) __attribute__((weak));
+
+static void (*const Host_DmaVectors[HOST_DMA_COUNT])(void) = {
+    DMA1_Channel1_IRQHandler, DMA1_Channel2_IRQHandler, DMA1_Channel3_IRQHandler,
+    DMA1_Channel4_IRQHandler, DMA1_Channel5_IRQHandler, DMA1_Channel6_IRQHandler,
+    DMA1_Channel7_IRQHandler
+};
+
+/* Vector ngắt EXTI theo line: line 0..4 riêng, 5..9 và 10..15 dùng chung */
+extern void EXTI0_IRQHandler(void) __attribute__((weak));
+extern void EXTI1_IRQHandler(void) __attribute__((weak));
+extern void EXTI2_IRQHandler(void) __attribute__((weak));
+extern void EXTI3_IRQHandler(void) __attribute__((weak));
+extern void EXTI4_IRQHandler(void) __attribute__((weak));
+extern void EXTI9_5_IRQHandler(void) __attribute__((weak));
+extern void EXTI15_10_IRQHandler(void) __attribute__((weak));
+
+typedef struct {
+    uint32_t  Lines;        /* Các line dùng vector này */
+    IRQn_Type Irq;
+    void    (*Handler)(void);
+} Host_ExtiVectorType;
+
+static const Host_ExtiVectorType Host_ExtiVectors[] = {
+    { 0x0001UL, EXTI0_IRQn,     EXTI0_IRQHandler },
+    { 0x0002UL, EXTI1_IRQn,     EXTI1_IRQHandler },
+    { 0x0004UL, EXTI2_IRQn,     EXTI2_IRQHandler },
+    { 0x0008UL, EXTI3_IRQn,     EXTI3_IRQHandler },
+    { 0x0010UL, EXTI4_IRQn,     EXTI4_IRQHandler },
+    { 0x03E0UL, EXTI9_5_IRQn,   EXTI9_5_IRQHandler },
+    { 0xFC00UL, EXTI15_10_IRQn, EXTI15_10_IRQHandler }
+};
+#define HOST_EXTI_VECTOR_COUNT  (sizeof(Host_ExtiVectors) / sizeof(Host_ExtiVectors[0]))
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+static void Host_Protect(int prot)
+{
+    for (size_t i = 0; i < HOST_REGION_COUNT; i++) {
+        mprotect((void*)Host_Regions[i].Base, Host_Regions[i].Size, prot);
+    }
+}
+
+static int Host_InRegion(uintptr_t addr)
+{
+    for (size_t i = 0; i < HOST_REGION_COUNT; i++) {
+        if (addr - Host_Regions[i].Base < Host_Regions[i].Size) return 1;
+    }
+    return 0;
+}
+
+/**********************************************************
+ * @brief Tạm dừng đếm khi mô hình tự truy cập thanh ghi (DMA, EXTI...)
+ * @details TF tự tắt ở lần bẫy kế tiếp vì Host_Counting = 0.
+ * @return Trạng thái đếm trước đó, truyền lại cho Host_CountResume
+ **********************************************************/
+static uint8_t Host_CountPause(void)
+{
+    uint8_t counting = Host_Counting;
+    Host_Counting = 0;
+    return counting;
+}
+
+static void Host_CountResume(uint8_t counting)
+{
+    if (counting) {
+        Host_Counting = 1;
+        __asm__ volatile ("pushfq\n\torq $0x100, (%%rsp)\n\tpopfq" ::: "memory", "cc");
+    }
+}
+
+static int Host_IrqEnabled(IRQn_Type irq)
+{
+    uint32_t n = (uint32_t)irq;
+    return (Host_NvicEnabled[n >> 5] & (1UL << (n & 0x1FU))) != 0;
+}
+
+/**********************************************************
+ * @brief Bật cờ pending EXTI cho các cạnh trên cổng idx
+ * @details Line n theo dõi chân n của cổng chọn trong AFIO->EXTICR.
+ **********************************************************/
+static void Host_DetectEdges(size_t idx, uint16_t oldIdr, uint16_t newIdr)
+{
+    uint16_t rising = newIdr & (uint16_t)~oldIdr;
+    uint16_t falling = oldIdr & (uint16_t)~newIdr;
+    uint32_t events = (rising & EXTI->RTSR) | (falling & EXTI->FTSR);
+
+    for (uint8_t line = 0; events != 0 && line < 16; line++) {
+        uint32_t source = (AFIO->EXTICR[line >> 2] >> ((line & 3U) * 4U)) & 0xFUL;
+        if (!(events & (1UL << line)) || source != idx) continue;
+        Host_ExtiPending |= 1UL << line;
+    }
+    EXTI->PR = Host_ExtiPending;
+}
+
+/**********************************************************
+ * @brief Tính lại IDR từ ODR, CRL/CRH và tín hiệu bên ngoài
+ * @details Chân output đọc lại ODR; chân output open-drain là
+ *          wired-AND: ODR = 1 (nhả) đọc mức ngoài nếu có, mặc định
+ *          là 1 (điện trở kéo lên); chân input được kéo từ ngoài
+ *          đọc mức ngoài; chân input pull-up/down đọc bit ODR;
+ *          chân floating/analog không được kéo đọc 0.
+ **********************************************************/
+static void Host_UpdateIdr(size_t idx)
+{
+    GPIO_TypeDef* GPIOx = Host_GpioPorts[idx];
+    uint16_t outputs = 0;
+    uint16_t openDrain = 0;
+    uint16_t pulls = 0;
+
+    for (uint8_t pin = 0; pin < 16; pin++) {
+        uint32_t cr = (pin < 8) ? GPIOx->CRL : GPIOx->CRH;
+        uint32_t nibble = (cr >> ((pin % 8) * 4)) & 0xFUL;
+        if ((nibble & 0x3UL) != 0) {
+            outputs |= (uint16_t)(1U << pin);
+            if (nibble & 0x4UL) openDrain |= (uint16_t)(1U << pin);
+        } else if ((nibble >> 2) == 0x2UL) {
+            pulls |= (uint16_t)(1U << pin);
+        }
+    }
+
+    uint16_t odr = (uint16_t)GPIOx->ODR;
+    uint16_t pulledLow = Host_InputMask[idx] & (uint16_t)~Host_InputLevel[idx];
+    uint16_t idr = odr & outputs & (uint16_t)~(openDrain & pulledLow);
+    idr |= Host_InputLevel[idx] & Host_InputMask[idx] & (uint16_t)~outputs;
+    idr |= odr & pulls & (uint16_t)~(outputs | Host_InputMask[idx]);
+    if (idr != (uint16_t)GPIOx->IDR) Host_DetectEdges(idx, (uint16_t)GPIOx->IDR, idr);
+    GPIOx->IDR = idr;
+}
+
+/**********************************************************
+ * @brief Đổi địa chỉ alias bit-band sang word đích và số bit
+ * @return 1 nếu addr thuộc vùng alias
+ **********************************************************/
+static int Host_BitBandTarget(uintptr_t addr, volatile uint32_t** word, uint32_t* bit)
+{
+    uintptr_t offset = addr - PERIPH_BB_BASE;
+    uintptr_t byteOffset;
+
+    if (offset >= HOST_PERIPH_SIZE * 32UL) return 0;
+    byteOffset = offset >> 5;
+    *word = (volatile uint32_t*)(PERIPH_BASE + (byteOffset & ~(uintptr_t)3));
+    *bit = (uint32_t)((byteOffset & 3U) * 8U + ((offset & 0x1FU) >> 2));
+    return 1;
+}
+
+/**********************************************************
+ * @brief Mô phỏng side-effect của một lần ghi thanh ghi
+ * @param[in] addr Địa chỉ vừa bị ghi
+ **********************************************************/
+static void Host_ApplyStore(uintptr_t addr)
+{
+    volatile uint32_t* word;
+    uint32_t bit;
+
+    if (Host_BitBandTarget(addr, &word, &bit)) {
+        /* Ghi alias = đọc-sửa-ghi nguyên tử một bit của word đích */
+        if (*(volatile uint32_t*)addr & 1UL) {
+            *word |= (1UL << bit);
+        } else {
+            *word &= ~(1UL << bit);
+        }
+        *(volatile uint32_t*)addr = 0;
+        Host_ApplyStore((uintptr_t)word);
+        return;
+    }
+
+    if (addr == (uintptr_t)&DWT->CYCCNT) {
+        /* Ghi CYCCNT: đếm tiếp từ giá trị mới */
+        Host_CycleBase = DWT->CYCCNT - (Host_Counting ? Host_Instrs : 0U);
+        return;
+    }
+    if (addr == (uintptr_t)&EXTI->PR) {
+        Host_ExtiPending &= ~EXTI->PR;
+        EXTI->PR = Host_ExtiPending;
+        return;
+    }
+    if (addr == (uintptr_t)&DMA1->IFCR) {
+        DMA1->ISR &= ~DMA1->IFCR;
+        DMA1->IFCR = 0;
+        return;
+    }
+    for (size_t i = 0; i < HOST_DMA_COUNT; i++) {
+        if (addr != (uintptr_t)&Host_DmaChannels[i]->CCR) continue;
+        /* Sườn lên EN: chốt số phần tử để nạp lại ở chế độ circular */
+        uint8_t enabled = (uint8_t)(Host_DmaChannels[i]->CCR & DMA_CCR1_EN);
+        if (enabled && !Host_DmaEnabled[i]) {
+            Host_DmaReload[i] = (uint16_t)Host_DmaChannels[i]->CNDTR;
+            Host_DmaPos[i] = 0;
+        }
+        Host_DmaEnabled[i] = enabled;
+        return;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        if (addr == (uintptr_t)&NVIC->ISER[i]) {
+            Host_NvicEnabled[i] |= NVIC->ISER[i];
+        } else if (addr == (uintptr_t)&NVIC->ICER[i]) {
+            Host_NvicEnabled[i] &= ~NVIC->ICER[i];
+        } else {
+            continue;
+        }
+        NVIC->ISER[i] = Host_NvicEnabled[i];
+        NVIC->ICER[i] = Host_NvicEnabled[i];
+        return;
+    }
+
+    for (size_t i = 0; i < HOST_GPIO_COUNT; i++) {
+        GPIO_TypeDef* GPIOx = Host_GpioPorts[i];
+        uintptr_t base = (uintptr_t)GPIOx;
+        if (addr - base >= sizeof(GPIO_TypeDef)) continue;
+
+        if (addr == (uintptr_t)&GPIOx->BSRR) {
+            uint32_t v = GPIOx->BSRR;
+            /* BSx ưu tiên hơn BRx khi cùng được set */
+            GPIOx->ODR = (GPIOx->ODR & ~(v >> 16)) | (v & 0xFFFFUL);
+            GPIOx->BSRR = 0;   /* Thanh ghi chỉ ghi, đọc về 0 */
+        } else if (addr == (uintptr_t)&GPIOx->BRR) {
+            GPIOx->ODR &= ~(GPIOx->BRR & 0xFFFFUL);
+            GPIOx->BRR = 0;
+        }
+        Host_UpdateIdr(i);
+        if (Host_OutputWatch != NULL) {
+            Host_Watching = 1;
+            Host_OutputWatch(GPIOx, (uint16_t)GPIOx->ODR);
+            Host_Watching = 0;
+            /* Thiết bị ngoài vừa đổi mức chân (vd ACK I2C) */
+            if (Host_InputDirty) {
+                Host_InputDirty = 0;
+                for (size_t k = 0; k < HOST_GPIO_COUNT; k++) Host_UpdateIdr(k);
+            }
+        }
+        return;
+    }
+}
+
+/**********************************************************
+ * @brief Áp dụng các lần ghi BSRR/BRR do code ngoài bẫy thực hiện
+ * @details Dùng sau ngắt giả lập: khi đó vùng nhớ đang mở khóa nên
+ *          các lần ghi không bị bẫy. BSRR/BRR khác 0 nghĩa là vừa ghi.
+ **********************************************************/
+static void Host_SyncGpio(void)
+{
+    for (size_t i = 0; i < HOST_GPIO_COUNT; i++) {
+        GPIO_TypeDef* GPIOx = Host_GpioPorts[i];
+        if (GPIOx->BSRR != 0) Host_ApplyStore((uintptr_t)&GPIOx->BSRR);
+        if (GPIOx->BRR != 0) Host_ApplyStore((uintptr_t)&GPIOx->BRR);
+        Host_UpdateIdr(i);
+    }
+}
+
+/* Chép một phần tử: đọc srcSize byte, ghi dstSize byte (cắt/mở rộng 0) */
+static void Host_DmaCopy(uintptr_t dst, uint32_t dstSize, uintptr_t src, uint32_t srcSize)
+{
+    uint32_t v = (srcSize == 4U) ? *(volatile uint32_t*)src
+               : (srcSize == 2U) ? *(volatile uint16_t*)src
+               : *(volatile uint8_t*)src;
+
+    if (dstSize == 4U) {
+        *(volatile uint32_t*)dst = v;
+    } else if (dstSize == 2U) {
+        *(volatile uint16_t*)dst = (uint16_t)v;
+    } else {
+        *(volatile uint8_t*)dst = (uint8_t)v;
+    }
+    if (Host_InRegion(dst)) Host_ApplyStore(dst);
+}
+
+/**********************************************************
+ * @brief Thực hiện một yêu cầu DMA trên kênh idx (vùng nhớ đang mở)
+ * @details Chuyển một phần tử giữa CPAR và CMAR theo DIR/PINC/MINC/
+ *          PSIZE/MSIZE, giảm CNDTR, bật cờ HT/TC và nạp lại khi
+ *          circular. CMAR là địa chỉ 32 bit nên buffer trên host phải
+ *          nằm dưới 4 GB (biến static, build -no-pie).
+ * @return 1 nếu kênh có ngắt cần phục vụ
+ **********************************************************/
+static int Host_DmaRequest(size_t idx)
+{
+    DMA_Channel_TypeDef* ch = Host_DmaChannels[idx];
+    uint32_t ccr = ch->CCR;
+    uint32_t psize = 1UL << ((ccr >> 8) & 0x3UL);
+    uint32_t msize = 1UL << ((ccr >> 10) & 0x3UL);
+    uintptr_t periph = ch->CPAR + ((ccr & DMA_CCR1_PINC) ? Host_DmaPos[idx] * psize : 0);
+    uintptr_t memory = ch->CMAR + ((ccr & DMA_CCR1_MINC) ? Host_DmaPos[idx] * msize : 0);
+    uint32_t shift = (uint32_t)idx * 4U;
+    uint32_t flags = 0;
+
+    if (!(ccr & DMA_CCR1_EN) || ch->CNDTR == 0) return 0;
+
+    if (ccr & DMA_CCR1_DIR) {
+        Host_DmaCopy(periph, psize, memory, msize);
+    } else {
+        Host_DmaCopy(memory, msize, periph, psize);
+    }
+    Host_DmaPos[idx]++;
+    ch->CNDTR--;
+
+    if (ch->CNDTR == Host_DmaReload[idx] / 2U) flags |= DMA_ISR_HTIF1;
+    if (ch->CNDTR == 0) {
+        flags |= DMA_ISR_TCIF1;
+        if (ccr & DMA_CCR1_CIRC) {
+            ch->CNDTR = Host_DmaReload[idx];
+            Host_DmaPos[idx] = 0;
+        }
+    }
+    if (flags == 0) return 0;
+    DMA1->ISR |= (flags | DMA_ISR_GIF1) << shift;
+    return (flags & ccr & (DMA_CCR1_TCIE | DMA_CCR1_HTIE)) != 0;
+}
+
+static void Host_SegvHandler(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+    uintptr_t addr = (uintptr_t)info->si_addr;
+
+    if (!Host_InRegion(addr)) {
+        /* Lỗi thật: trả về handler mặc định để chương trình dừng */
+        signal(sig, SIG_DFL);
+        return;
+    }
+
+    if (Host_Counting) {
+        if (Host_Loads + Host_Stores == 0) Host_FirstAccess = Host_Instrs;
+        Host_LastAccess = Host_Instrs;
+    }
+    if (uc->uc_mcontext.gregs[REG_ERR] & HOST_PF_WRITE) {
+        if (Host_Counting) Host_Stores++;
+        Host_PendingStore = addr;
+    } else {
+        if (Host_Counting) Host_Loads++;
+    }
+
+    Host_Protect(PROT_READ | PROT_WRITE);
+
+    /* Đọc alias bit-band: nạp sẵn giá trị bit của word đích */
+    volatile uint32_t* word;
+    uint32_t bit;
+    if (!(uc->uc_mcontext.gregs[REG_ERR] & HOST_PF_WRITE) && Host_BitBandTarget(addr, &word, &bit)) {
+        *(volatile uint32_t*)addr = (*word >> bit) & 1UL;
+    }
+    /* DWT->CYCCNT: trên host "chu kỳ" là số lệnh đã chạy khi đang đếm */
+    if (addr == (uintptr_t)&DWT->CYCCNT) {
+        if (!Host_Counting) Host_CycleBase += HOST_IDLE_CYCLES;
+        DWT->CYCCNT = Host_Now();
+    }
+    uc->uc_mcontext.gregs[REG_EFL] |= HOST_EFLAGS_TF;
+}
+
+static void Host_TrapHandler(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+    (void)sig;
+    (void)info;
+
+    if (Host_PendingStore != 0) {
+        Host_ApplyStore(Host_PendingStore);
+        Host_PendingStore = 0;
+    }
+    /* PRIMASK = 1: ngắt giữ pending, chạy ở lệnh đầu tiên sau khi mở lại */
+    if (Host_Isr != NULL && Host_Counting && (Host_Loads + Host_Stores) >= Host_IsrAt && Host_Primask == 0U) {
+        void (*isr)(void) = Host_Isr;
+        Host_Isr = NULL;
+        Host_Protect(PROT_READ | PROT_WRITE);   /* Ngắt bị hoãn: lệnh vừa chạy không phải truy cập bus */
+        isr();
+        Host_SyncGpio();
+    }
+    Host_Protect(PROT_NONE);
+
+    if (Host_Counting) {
+        Host_Instrs++;      /* Giữ TF: tiếp tục chạy từng lệnh */
+    } else {
+        uc->uc_mcontext.gregs[REG_EFL] &= ~HOST_EFLAGS_TF;
+    }
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Host_ModelInit(void)
+{
+    struct sigaction sa;
+
+    for (size_t i = 0; i < HOST_REGION_COUNT; i++) {
+        void* p = mmap((void*)Host_Regions[i].Base, Host_Regions[i].Size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (p != (void*)Host_Regions[i].Base) {
+            fprintf(stderr, "[HOST] Khong the map vung ngoai vi 0x%08lx\n",
+                    (unsigned long)Host_Regions[i].Base);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = Host_SegvHandler;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = Host_TrapHandler;
+    sigaction(SIGTRAP, &sa, NULL);
+
+    Host_ModelReset();
+
+    /* Hiệu chỉnh: số lệnh của một cặp Start/Stop rỗng */
+    Host_BusCountStart();
+    Host_InstrOverhead = Host_BusCountStop().Instrs;
+}
+
+void Host_ModelReset(void)
+{
+    Host_Protect(PROT_READ | PROT_WRITE);
+    for (size_t i = 0; i < HOST_REGION_COUNT; i++) {
+        memset((void*)Host_Regions[i].Base, 0, Host_Regions[i].Size);
+    }
+
+    /* Giá trị reset khác 0 theo RM0008 */
+    RCC->CR = 0x00000083UL;
+    for (size_t i = 0; i < HOST_DMA_COUNT; i++) {
+        Host_DmaEnabled[i] = 0;
+        Host_DmaReload[i] = 0;
+        Host_DmaPos[i] = 0;
+    }
+    Host_NvicEnabled[0] = 0;
+    Host_NvicEnabled[1] = 0;
+    Host_ExtiPending = 0;
+    Host_Primask = 0;
+    for (size_t i = 0; i < HOST_GPIO_COUNT; i++) {
+        Host_GpioPorts[i]->CRL = HOST_GPIO_RESET_CR;
+        Host_GpioPorts[i]->CRH = HOST_GPIO_RESET_CR;
+        Host_InputMask[i] = 0;
+        Host_InputLevel[i] = 0;
+    }
+    Host_Protect(PROT_NONE);
+}
+
+__attribute__((noinline)) void Host_BusCountStart(void)
+{
+    Host_Loads = 0;
+    Host_Stores = 0;
+    Host_Instrs = 0;
+    Host_FirstAccess = 0;
+    Host_LastAccess = 0;
+    Host_Counting = 1;
+    __asm__ volatile ("pushfq\n\torq $0x100, (%%rsp)\n\tpopfq" ::: "memory", "cc");
+}
+
+__attribute__((noinline)) Host_BusCountType Host_BusCountStop(void)
+{
+    Host_BusCountType count;
+
+    Host_Counting = 0;
+    __asm__ volatile ("pushfq\n\tandq $~0x100, (%%rsp)\n\tpopfq" ::: "memory", "cc");
+    count.Loads = Host_Loads;
+    count.Stores = Host_Stores;
+    count.Instrs = Host_Instrs - Host_InstrOverhead;
+    count.Span = Host_LastAccess - Host_FirstAccess;
+    Host_CycleBase += Host_Instrs;      /* CYCCNT không lùi khi đếm lại từ 0 */
+    return count;
+}
+
+void Host_InjectIsr(uint32_t AfterAccess, void (*Isr)(void))
+{
+    Host_IsrAt = AfterAccess;
+    Host_Isr = Isr;
+}
+
+void Host_SetInput(GPIO_TypeDef* GPIOx, uint16_t Mask, uint16_t Level)
+{
+    uint32_t pending = 0;
+
+    for (size_t i = 0; i < HOST_GPIO_COUNT; i++) {
+        if (Host_GpioPorts[i] != GPIOx) continue;
+        uint8_t counting = Host_CountPause();
+        Host_Protect(PROT_READ | PROT_WRITE);
+        Host_InputMask[i] = Mask;
+        Host_InputLevel[i] = Level & Mask;
+        Host_UpdateIdr(i);
+        pending = Host_ExtiPending & EXTI->IMR;
+        Host_Protect(PROT_NONE);
+        Host_CountResume(counting);
+        break;
+    }
+
+    /* Cạnh làm line EXTI pending: gọi vector tương ứng như NVIC */
+    for (size_t v = 0; v < HOST_EXTI_VECTOR_COUNT; v++) {
+        const Host_ExtiVectorType* vec = &Host_ExtiVectors[v];
+        if ((pending & vec->Lines) && Host_IrqEnabled(vec->Irq) && vec->Handler != NULL) {
+            vec->Handler();
+        }
+    }
+}
+
+void Host_TimerUpdate(TIM_TypeDef* TIMx)
+{
+    uint8_t irqs = 0;   /* Bit n: kênh DMA1 n+1 có ngắt */
+    uint8_t counting = Host_CountPause();   /* DMA không đi qua CPU */
+
+    Host_Protect(PROT_READ | PROT_WRITE);
+    if (TIMx->CR1 & TIM_CR1_CEN) {
+        TIMx->SR |= TIM_SR_UIF;
+        for (size_t i = 0; i < HOST_TIMER_COUNT; i++) {
+            if (Host_TimerDma[i].TIMx != TIMx || !(TIMx->DIER & Host_TimerDma[i].Source)) continue;
+            if (Host_DmaRequest(Host_TimerDma[i].DmaIdx)) irqs |= (uint8_t)(1U << Host_TimerDma[i].DmaIdx);
+        }
+    }
+    Host_Protect(PROT_NONE);
+    Host_CountResume(counting);
+
+    /* Ngắt chạy như code thường: truy cập thanh ghi của ISR vẫn bị bẫy */
+    for (size_t i = 0; i < HOST_DMA_COUNT; i++) {
+        if (!(irqs & (1U << i))) continue;
+        if (Host_IrqEnabled((IRQn_Type)(DMA1_Channel1_IRQn + i)) && Host_DmaVectors[i] != NULL) {
+            Host_DmaVectors[i]();
+        }
+    }
+}
+
+void Host_DriveInput(GPIO_TypeDef* GPIOx, uint16_t Mask, uint16_t Level)
+{
+    for (size_t i = 0; i < HOST_GPIO_COUNT; i++) {
+        if (Host_GpioPorts[i] != GPIOx) continue;
+        uint16_t mask = Host_InputMask[i] | Mask;
+        uint16_t level = (uint16_t)((Host_InputLevel[i] & ~Mask) | (Level & Mask));
+        if (Host_Watching) {
+            /* Trong bộ bẫy: chỉ ghi nhớ, IDR tính lại khi Watch trả về */
+            Host_InputMask[i] = mask;
+            Host_InputLevel[i] = level;
+            Host_InputDirty = 1;
+        } else {
+            Host_SetInput(GPIOx, mask, level);
+        }
+        return;
+    }
+}
+
+uint32_t Host_Now(void)
+{
+    return Host_Counting ? Host_CycleBase + Host_Instrs : Host_CycleBase;
+}
+
+void Host_WatchOutputs(void (*Watch)(GPIO_TypeDef* GPIOx, uint16_t Odr))
+{
+    Host_OutputWatch = Watch;
+}
+
+uint32_t Host_Peek(const volatile void* Reg)
+{
+    uint32_t value;
+
+    Host_Protect(PROT_READ | PROT_WRITE);
+    value = *(const volatile uint32_t*)Reg;
+    Host_Protect(PROT_NONE);
+    return value;
+}
@@ -0,0 +1,131 @@
+/**********************************************************
+ * @file    Host_Model.h
+ * @brief   Mô hình thanh ghi STM32F103 chạy trên máy host (Linux)
+ * @details Ánh xạ vùng nhớ RAM vào đúng địa chỉ ngoại vi thật
+ *          (0x40000000...) để Dio.c, Port.c, Pwm.c và SPL biên dịch
+ *          bằng gcc của host mà không cần sửa driver. Mọi lệnh
+ *          load/store vào vùng ngoại vi đều bị bẫy lại để:
+ *          - đếm số lần truy cập bus cho mỗi lần gọi API,
+ *          - mô phỏng hành vi phần cứng (BSRR/BRR -> ODR, ODR -> IDR,
+ *            update event của timer -> yêu cầu DMA1 -> ngắt DMA).
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef HOST_MODEL_H
+#define HOST_MODEL_H
+
+#include "stm32f10x.h"
+
+/**********************************************************
+ * @struct  Host_BusCountType
+ * @brief   Số lần truy cập bus đo được giữa Start/Stop
+ **********************************************************/
+typedef struct {
+    uint32_t Loads;   /**< Số lần đọc thanh ghi (volatile load) */
+    uint32_t Stores;  /**< Số lần ghi thanh ghi (volatile store) */
+    uint32_t Instrs;  /**< Số lệnh máy host đã chạy (độ dài đường code) */
+    uint32_t Span;    /**< Số lệnh từ truy cập bus đầu tiên đến truy cập cuối */
+} Host_BusCountType;
+
+/**********************************************************
+ * @brief   Ánh xạ vùng ngoại vi và cài bộ bẫy truy cập
+ * @details Gọi một lần duy nhất trước mọi API MCAL.
+ **********************************************************/
+void Host_ModelInit(void);
+
+/**********************************************************
+ * @brief   Đưa toàn bộ thanh ghi về giá trị reset
+ **********************************************************/
+void Host_ModelReset(void);
+
+/**********************************************************
+ * @brief   Xóa bộ đếm và bắt đầu đếm truy cập bus
+ * @details Đồng thời chạy từng lệnh (cờ TF) để đếm số lệnh máy,
+ *          là thước đo tất định cho chi phí CPU của API.
+ **********************************************************/
+void Host_BusCountStart(void);
+
+/**********************************************************
+ * @brief   Dừng đếm và trả về số lần truy cập đã đo
+ **********************************************************/
+Host_BusCountType Host_BusCountStop(void);
+
+/**********************************************************
+ * @brief   Giả lập một ngắt chen vào giữa API đang đo
+ * @details Isr được gọi đúng một lần, ngay sau khi truy cập bus
+ *          thứ AfterAccess (tính từ 1, kể từ Host_BusCountStart)
+ *          hoàn tất. Các lần ghi GPIO trong Isr có hiệu lực như
+ *          trên phần cứng nhưng không được tính vào bộ đếm. Khi
+ *          Host_Primask khác 0 (Dio_IrqSave), ngắt chờ đến khi mở lại.
+ * @param[in] AfterAccess  Số thứ tự truy cập bus kích hoạt ngắt
+ * @param[in] Isr          Hàm phục vụ ngắt giả lập
+ **********************************************************/
+void Host_InjectIsr(uint32_t AfterAccess, void (*Isr)(void));
+
+/* PRIMASK giả lập: Dio_IrqSave đặt 1, Dio_IrqRestore trả lại (Dio_Cfg.h) */
+extern volatile uint32_t Host_Primask;
+
+/**********************************************************
+ * @brief   Đặt mức điện áp bên ngoài đưa vào các chân input
+ * @details Cạnh trên chân làm line EXTI pending (theo AFIO->EXTICR,
+ *          RTSR/FTSR); nếu line không bị mask và NVIC cho phép,
+ *          EXTIx_IRQHandler được gọi trước khi hàm trả về. Khi đang
+ *          đếm, chỉ phần ISR được tính, và DWT->CYCCNT đọc ra số lệnh
+ *          đã chạy để đo độ trễ ISR.
+ * @param[in] GPIOx  Cổng GPIO
+ * @param[in] Mask   Các chân được kéo từ bên ngoài
+ * @param[in] Level  Mức logic của các chân đó
+ **********************************************************/
+void Host_SetInput(GPIO_TypeDef* GPIOx, uint16_t Mask, uint16_t Level);
+
+/**********************************************************
+ * @brief   Giả lập một update event của timer
+ * @details Một lần gọi là một chu kỳ timer: nếu timer đang chạy (CEN),
+ *          mỗi yêu cầu DMA đang bật (UDE, CCxDE) cho kênh DMA1 tương
+ *          ứng chuyển một phần tử; kênh nào báo HT/TC có bật ngắt và
+ *          NVIC cho phép thì handler DMA1_ChannelX_IRQHandler được gọi.
+ *          Truy cập của DMA không tính vào bộ đếm (không qua CPU).
+ * @param[in] TIMx  TIM1..TIM4
+ **********************************************************/
+void Host_TimerUpdate(TIM_TypeDef* TIMx);
+
+/**********************************************************
+ * @brief   Đổi mức ngoài của một số chân, giữ nguyên các chân khác
+ * @details Khác Host_SetInput (thay cả cổng), gọi được từ bên trong
+ *          Watch của Host_WatchOutputs để thiết bị giả lập trả lời
+ *          ngay (ACK I2C, presence one-wire). Chân open-drain đang
+ *          nhả đọc mức này; Level = 1 tương đương thiết bị nhả bus.
+ * @param[in] GPIOx  Cổng GPIO
+ * @param[in] Mask   Các chân cần đổi
+ * @param[in] Level  Mức logic mới của các chân đó
+ **********************************************************/
+void Host_DriveInput(GPIO_TypeDef* GPIOx, uint16_t Mask, uint16_t Level);
+
+/**********************************************************
+ * @brief   Giá trị DWT->CYCCNT hiện tại, không truy cập thanh ghi
+ * @details Khi đang đếm, CYCCNT tăng một mỗi lệnh host; ngoài vùng
+ *          đếm, mỗi lần đọc CYCCNT tăng một bước nhỏ để vòng chờ
+ *          theo CYCCNT vẫn kết thúc. Ghi CYCCNT đặt lại giá trị đếm
+ *          như trên phần cứng. Dùng được trong Watch để đóng
+ *          dấu thời gian các cạnh.
+ **********************************************************/
+uint32_t Host_Now(void);
+
+/**********************************************************
+ * @brief   Đăng ký hàm được gọi mỗi khi ODR của một cổng GPIO đổi
+ * @details Dùng để mô phỏng thiết bị ngoài chốt dữ liệu theo cạnh
+ *          strobe. Watch chạy trong bộ bẫy (kể cả khi DMA ghi BSRR),
+ *          không được truy cập thanh ghi ngoại vi. NULL: hủy đăng ký.
+ * @param[in] Watch  Hàm nhận cổng và giá trị ODR mới
+ **********************************************************/
+void Host_WatchOutputs(void (*Watch)(GPIO_TypeDef* GPIOx, uint16_t Odr));
+
+/**********************************************************
+ * @brief   Đọc một thanh ghi mà không đi qua bộ đếm
+ * @param[in] Reg  Địa chỉ thanh ghi (vd &GPIOA->ODR, &TIM2->CCR2)
+ **********************************************************/
+uint32_t Host_Peek(const volatile void* Reg);
+
+#endif /* HOST_MODEL_H */
@@ -0,0 +1,130 @@
+/**********************************************************
+ * @file    Clk.h
+ * @brief   Dịch vụ bật/tắt clock ngoại vi dùng chung (RCC AHB/APB1/APB2)
+ * @details Module không gọi RCC_xxxPeriphClockCmd trực tiếp mà đăng ký
+ *          nhu cầu bằng Clk_Request/Clk_Release rồi gọi Clk_Apply một
+ *          lần: mọi thay đổi của một bus được gom vào một lệnh ghi
+ *          AHBENR/APB1ENR/APB2ENR.
+ *          Mỗi ngoại vi có bộ đếm tham chiếu, nên clock nhiều driver
+ *          cùng dùng (DMA1, AFIO, GPIO...) chỉ bị tắt khi driver cuối
+ *          cùng trả lại. Clk chỉ tắt những bit do chính nó bật; bit đã
+ *          bật sẵn (SRAM, FLITF sau reset) giữ nguyên.
+ *          Timer thì không dùng chung được: Pwm, Dio_Stream và
+ *          Dio_Capture đều ghi lại PSC/ARR. Driver giành timer bằng
+ *          Clk_Claim trước khi cấu hình; timer đã có chủ khác trả về
+ *          E_NOT_OK và thanh ghi của nó không bị đụng.
+ *          Các hàm không tự khóa ngắt: chỉ gọi từ ngữ cảnh task.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef CLK_H
+#define CLK_H
+
+#include "Std_Types.h"
+
+/**********************************************************
+ * Định danh ngoại vi: bus (3 bit cao) và vị trí bit trong xxxENR
+ **********************************************************/
+typedef uint8 Clk_PeripheralType;
+
+#define CLK_BUS_AHB     0U
+#define CLK_BUS_APB1    1U
+#define CLK_BUS_APB2    2U
+#define CLK_BUS_COUNT   3U
+
+#define CLK_ID(Bus, Bit)    ((Clk_PeripheralType)(((Bus) << 5) | (Bit)))
+#define CLK_NONE            ((Clk_PeripheralType)0xFFU)
+
+/* AHB */
+#define CLK_DMA1        CLK_ID(CLK_BUS_AHB, 0)
+#define CLK_SRAM        CLK_ID(CLK_BUS_AHB, 2)
+#define CLK_FLITF       CLK_ID(CLK_BUS_AHB, 4)
+#define CLK_CRC         CLK_ID(CLK_BUS_AHB, 6)
+
+/* APB1 */
+#define CLK_TIM2        CLK_ID(CLK_BUS_APB1, 0)
+#define CLK_TIM3        CLK_ID(CLK_BUS_APB1, 1)
+#define CLK_TIM4        CLK_ID(CLK_BUS_APB1, 2)
+#define CLK_WWDG        CLK_ID(CLK_BUS_APB1, 11)
+#define CLK_SPI2        CLK_ID(CLK_BUS_APB1, 14)
+#define CLK_USART2      CLK_ID(CLK_BUS_APB1, 17)
+#define CLK_USART3      CLK_ID(CLK_BUS_APB1, 18)
+#define CLK_I2C1        CLK_ID(CLK_BUS_APB1, 21)
+#define CLK_I2C2        CLK_ID(CLK_BUS_APB1, 22)
+#define CLK_USB         CLK_ID(CLK_BUS_APB1, 23)
+#define CLK_CAN1        CLK_ID(CLK_BUS_APB1, 25)
+#define CLK_BKP         CLK_ID(CLK_BUS_APB1, 27)
+#define CLK_PWR         CLK_ID(CLK_BUS_APB1, 28)
+
+/* APB2 */
+#define CLK_AFIO        CLK_ID(CLK_BUS_APB2, 0)
+#define CLK_GPIOA       CLK_ID(CLK_BUS_APB2, 2)
+#define CLK_GPIOB       CLK_ID(CLK_BUS_APB2, 3)
+#define CLK_GPIOC       CLK_ID(CLK_BUS_APB2, 4)
+#define CLK_GPIOD       CLK_ID(CLK_BUS_APB2, 5)
+#define CLK_ADC1        CLK_ID(CLK_BUS_APB2, 9)
+#define CLK_ADC2        CLK_ID(CLK_BUS_APB2, 10)
+#define CLK_TIM1        CLK_ID(CLK_BUS_APB2, 11)
+#define CLK_SPI1        CLK_ID(CLK_BUS_APB2, 12)
+#define CLK_USART1      CLK_ID(CLK_BUS_APB2, 14)
+
+/* GPIO theo chỉ số cổng 0=A..3=D (PORT_ID_x / DIO_PORT_x) */
+#define CLK_GPIO(PortNum)   ((Clk_PeripheralType)(CLK_GPIOA + (PortNum)))
+
+/**********************************************************
+ * Chủ sở hữu độc quyền của ngoại vi (timer)
+ **********************************************************/
+typedef uint8 Clk_OwnerType;
+
+#define CLK_OWNER_NONE          0U
+#define CLK_OWNER_PWM           1U
+#define CLK_OWNER_DIO_STREAM    2U
+#define CLK_OWNER_DIO_CAPTURE   3U
+
+/**********************************************************
+ * @brief   Tăng bộ đếm tham chiếu của ngoại vi
+ * @details Chỉ ghi nhận; clock thật sự bật ở lần Clk_Apply kế tiếp.
+ *          CLK_NONE và định danh ngoài bảng bị bỏ qua.
+ **********************************************************/
+void Clk_Request(Clk_PeripheralType Periph);
+
+/**********************************************************
+ * @brief   Giảm bộ đếm tham chiếu, về 0 thì tắt clock ở lần Clk_Apply
+ **********************************************************/
+void Clk_Release(Clk_PeripheralType Periph);
+
+/**********************************************************
+ * @brief   Đưa các yêu cầu đang chờ ra thanh ghi RCC
+ * @details Mỗi bus có thay đổi tốn một lần đọc và một lần ghi xxxENR;
+ *          bus không đổi không bị truy cập.
+ **********************************************************/
+void Clk_Apply(void);
+
+/**********************************************************
+ * @brief   Số driver đang giữ clock của ngoại vi (chẩn đoán)
+ **********************************************************/
+uint8 Clk_GetRefCount(Clk_PeripheralType Periph);
+
+/**********************************************************
+ * @brief   Giành quyền dùng độc quyền ngoại vi cho Owner
+ * @details Gọi lại với cùng Owner vẫn E_OK (nhiều kênh Pwm trên một
+ *          timer, Start lại một stream). Không đụng clock: driver vẫn
+ *          Clk_Request/Clk_Release như cũ.
+ * @return  E_NOT_OK nếu ngoại vi đang thuộc driver khác hoặc định
+ *          danh ngoài bảng
+ **********************************************************/
+Std_ReturnType Clk_Claim(Clk_PeripheralType Periph, Clk_OwnerType Owner);
+
+/**********************************************************
+ * @brief   Trả quyền dùng ngoại vi; bỏ qua nếu Owner không giữ nó
+ **********************************************************/
+void Clk_Unclaim(Clk_PeripheralType Periph, Clk_OwnerType Owner);
+
+/**********************************************************
+ * @brief   Driver đang giữ ngoại vi, CLK_OWNER_NONE nếu còn trống
+ **********************************************************/
+Clk_OwnerType Clk_GetOwner(Clk_PeripheralType Periph);
+
+#endif /* CLK_H */
@@ -9,8 +9,32 @@
 #define DIO_WRITECHANNEL_ID           0x01
 #define DIO_READCHANNEL_ID            0x02
 #define DIO_WRITEPORT_ID              0x03
+#define DIO_STAGECHANNEL_ID           0x10
+#define DIO_STAGECHANNELGROUP_ID      0x11
+#define DIO_STREAMSTART_ID            0x12
+#define DIO_CAPTURESTART_ID           0x13
+#define DIO_GETDEBOUNCEDPORT_ID       0x14
+#define DIO_EDGEINIT_ID               0x15
+#define DIO_EDGENOTIFICATION_ID       0x16
+#define DIO_READALLPORTS_ID           0x17
+#define DIO_WRITEALLPORTS_ID          0x18
+#define DIO_READVIRTUALGROUP_ID       0x19
+#define DIO_WRITEVIRTUALGROUP_ID      0x1A
+#define DIO_BUSWRITE_ID               0x1B
+#define DIO_BUSREAD_ID                0x1C
+#define DIO_BITBANGINIT_ID            0x1D
+#define DIO_BITBANGTRANSFER_ID        0x1E
+#define DIO_DEBOUNCEINIT_ID           0x1F
 #define DIO_E_PARAM_INVALID_CHANNEL   0x0A
 #define DIO_E_PARAM_INVALID_PORT      0x0B
+#define DIO_E_PARAM_INVALID_GROUP     0x0C
+#define DIO_E_PARAM_POINTER           0x0D
+#define DIO_E_PARAM_INVALID_TIMER     0x0E
+#define DIO_E_PARAM_INVALID_LENGTH    0x0F
+#define DIO_E_PARAM_INVALID_BUS       0x10
+#define DIO_E_PARAM_INVALID_BITRATE   0x11
+#define DIO_E_TIMER_IN_USE            0x12
+#define DIO_E_PARAM_CONFIG            0x13
 
 static inline void Det_ReportError(uint16_t module_id, uint8_t instance_id,
                                    uint8_t api_id, uint8_t error_id)
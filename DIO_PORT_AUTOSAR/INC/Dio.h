@@ -11,40 +11,18 @@
 
 // This file is part of the AUTOSAR standard.
 #include "Std_Types.h"
-
-/******************************************************* 
- * ========================================================
- * DIO Port Definitions
- * ========================================================
- * Macro xác định cổng GPIO dựa trên ID kênh.
- ********************************************************/
-
-#define GPIO_GetPort(ChannelId) \
-    ((ChannelId) < 16 ? GPIOA : \
-    (ChannelId) < 32 ? GPIOB : \
-    (ChannelId) < 48 ? GPIOC : \
-    (ChannelId) < 64 ? GPIOD : \
-    (ChannelId) < 80 ? GPIOE : \
-    (ChannelId) < 96 ? GPIOF : \
-    (ChannelId) < 112 ? GPIOG : NULL)
-    
-    /**********************************************************
-     * ========================================================
-     * DIO Pin Definitions
-     * ========================================================
-     * Macro xác định chân GPIO dựa trên ID kênh
-     **********************************************************/
-
-#define GPIO_GetPin(ChannelId) (1<<(ChannelId) % 16)
+#include "Dio_Cfg.h"     /* Bảng tra kênh/cổng tính sẵn */
 
     /**************************************************** 
      * ========================================================
      * DIO Channel Definitions
      * ========================================================
      * Macro xác định ID kênh DIO dựa trên cổng GPIO và chân.
+     * DIO_CHANNEL nhận con trỏ GPIOx, DIO_CHANNEL_ID nhận DIO_PORT_x.
      ********************************************************/
 
 #define DIO_CHANNEL(GPIOX, PIN)   (((GPIOX) == GPIOA ? 0 : (GPIOX) == GPIOB ? 1 : (GPIOX) == GPIOC ? 2 : 3) * 16 + (PIN))
+#define DIO_CHANNEL_ID(PORT, PIN) ((PORT) * DIO_PINS_PER_PORT + (PIN))
 
     /**********************************************************
      * ========================================================
@@ -65,74 +43,78 @@
      * Các định nghĩa kênh DIO cụ thể cho từng chân GPIO.
      ********************************************************/
 
-#define DIO_CHANNEL_A0 (DIO_CHANNEL(DIO_PORT_A, 0))
-#define DIO_CHANNEL_A1 (DIO_CHANNEL(DIO_PORT_A, 1))
-#define DIO_CHANNEL_A2 (DIO_CHANNEL(DIO_PORT_A, 2))
-#define DIO_CHANNEL_A3 (DIO_CHANNEL(DIO_PORT_A, 3))
-#define DIO_CHANNEL_A4 (DIO_CHANNEL(DIO_PORT_A, 4))
-#define DIO_CHANNEL_A5 (DIO_CHANNEL(DIO_PORT_A, 5))
-#define DIO_CHANNEL_A6 (DIO_CHANNEL(DIO_PORT_A, 6))
-#define DIO_CHANNEL_A7 (DIO_CHANNEL(DIO_PORT_A, 7))
-#define DIO_CHANNEL_A8 (DIO_CHANNEL(DIO_PORT_A, 8))
-#define DIO_CHANNEL_A9 (DIO_CHANNEL(DIO_PORT_A, 9))
-#define DIO_CHANNEL_A10 (DIO_CHANNEL(DIO_PORT_A, 10))
-#define DIO_CHANNEL_A11 (DIO_CHANNEL(DIO_PORT_A, 11))
-#define DIO_CHANNEL_A12 (DIO_CHANNEL(DIO_PORT_A, 12))
-#define DIO_CHANNEL_A13 (DIO_CHANNEL(DIO_PORT_A, 13))
-#define DIO_CHANNEL_A14 (DIO_CHANNEL(DIO_PORT_A, 14))
-#define DIO_CHANNEL_A15 (DIO_CHANNEL(DIO_PORT_A, 15))
-
-#define DIO_CHANNEL_B0 (DIO_CHANNEL(DIO_PORT_B, 0))
-#define DIO_CHANNEL_B1 (DIO_CHANNEL(DIO_PORT_B, 1))
-#define DIO_CHANNEL_B2 (DIO_CHANNEL(DIO_PORT_B, 2))
-#define DIO_CHANNEL_B3 (DIO_CHANNEL(DIO_PORT_B, 3))
-#define DIO_CHANNEL_B4 (DIO_CHANNEL(DIO_PORT_B, 4))
-#define DIO_CHANNEL_B5 (DIO_CHANNEL(DIO_PORT_B, 5))
-#define DIO_CHANNEL_B6 (DIO_CHANNEL(DIO_PORT_B, 6))
-#define DIO_CHANNEL_B7 (DIO_CHANNEL(DIO_PORT_B, 7))
-#define DIO_CHANNEL_B8 (DIO_CHANNEL(DIO_PORT_B, 8))
-#define DIO_CHANNEL_B9 (DIO_CHANNEL(DIO_PORT_B, 9))
-#define DIO_CHANNEL_B10 (DIO_CHANNEL(DIO_PORT_B, 10))
-#define DIO_CHANNEL_B11 (DIO_CHANNEL(DIO_PORT_B, 11))
-#define DIO_CHANNEL_B12 (DIO_CHANNEL(DIO_PORT_B, 12))
-#define DIO_CHANNEL_B13 (DIO_CHANNEL(DIO_PORT_B, 13))
-#define DIO_CHANNEL_B14 (DIO_CHANNEL(DIO_PORT_B, 14))
-#define DIO_CHANNEL_B15 (DIO_CHANNEL(DIO_PORT_B, 15))
-
-#define DIO_CHANNEL_C0 (DIO_CHANNEL(DIO_PORT_C, 0))
-#define DIO_CHANNEL_C1 (DIO_CHANNEL(DIO_PORT_C, 1))
-#define DIO_CHANNEL_C2 (DIO_CHANNEL(DIO_PORT_C, 2))
-#define DIO_CHANNEL_C3 (DIO_CHANNEL(DIO_PORT_C, 3))
-#define DIO_CHANNEL_C4 (DIO_CHANNEL(DIO_PORT_C, 4))
-#define DIO_CHANNEL_C5 (DIO_CHANNEL(DIO_PORT_C, 5))
-#define DIO_CHANNEL_C6 (DIO_CHANNEL(DIO_PORT_C, 6))
-#define DIO_CHANNEL_C7 (DIO_CHANNEL(DIO_PORT_C, 7))
-#define DIO_CHANNEL_C8 (DIO_CHANNEL(DIO_PORT_C, 8))
-#define DIO_CHANNEL_C9 (DIO_CHANNEL(DIO_PORT_C, 9))
-#define DIO_CHANNEL_C10 (DIO_CHANNEL(DIO_PORT_C, 10))
-#define DIO_CHANNEL_C11 (DIO_CHANNEL(DIO_PORT_C, 11))
-#define DIO_CHANNEL_C12 (DIO_CHANNEL(DIO_PORT_C, 12))
-#define DIO_CHANNEL_C13 (DIO_CHANNEL(DIO_PORT_C, 13))
-#define DIO_CHANNEL_C14 (DIO_CHANNEL(DIO_PORT_C, 14))
-#define DIO_CHANNEL_C15 (DIO_CHANNEL(DIO_PORT_C, 15))
-
-
-#define DIO_CHANNEL_D0 (DIO_CHANNEL(DIO_PORT_D, 0))
-#define DIO_CHANNEL_D1 (DIO_CHANNEL(DIO_PORT_D, 1))
-#define DIO_CHANNEL_D2 (DIO_CHANNEL(DIO_PORT_D, 2))
-#define DIO_CHANNEL_D3 (DIO_CHANNEL(DIO_PORT_D, 3))
-#define DIO_CHANNEL_D4 (DIO_CHANNEL(DIO_PORT_D, 4))
-#define DIO_CHANNEL_D5 (DIO_CHANNEL(DIO_PORT_D, 5))
-#define DIO_CHANNEL_D6 (DIO_CHANNEL(DIO_PORT_D, 6))
-#define DIO_CHANNEL_D7 (DIO_CHANNEL(DIO_PORT_D, 7))
-#define DIO_CHANNEL_D8 (DIO_CHANNEL(DIO_PORT_D, 8))
-#define DIO_CHANNEL_D9 (DIO_CHANNEL(DIO_PORT_D, 9))
-#define DIO_CHANNEL_D10 (DIO_CHANNEL(DIO_PORT_D, 10))
-#define DIO_CHANNEL_D11 (DIO_CHANNEL(DIO_PORT_D, 11))
-#define DIO_CHANNEL_D12 (DIO_CHANNEL(DIO_PORT_D, 12))
-#define DIO_CHANNEL_D13 (DIO_CHANNEL(DIO_PORT_D, 13))
-#define DIO_CHANNEL_D14 (DIO_CHANNEL(DIO_PORT_D, 14))
-#define DIO_CHANNEL_D15 (DIO_CHANNEL(DIO_PORT_D, 15))
+#define DIO_CHANNEL_A0 (DIO_CHANNEL_ID(DIO_PORT_A, 0))
+#define DIO_CHANNEL_A1 (DIO_CHANNEL_ID(DIO_PORT_A, 1))
+#define DIO_CHANNEL_A2 (DIO_CHANNEL_ID(DIO_PORT_A, 2))
+#define DIO_CHANNEL_A3 (DIO_CHANNEL_ID(DIO_PORT_A, 3))
+#define DIO_CHANNEL_A4 (DIO_CHANNEL_ID(DIO_PORT_A, 4))
+#define DIO_CHANNEL_A5 (DIO_CHANNEL_ID(DIO_PORT_A, 5))
+#define DIO_CHANNEL_A6 (DIO_CHANNEL_ID(DIO_PORT_A, 6))
+#define DIO_CHANNEL_A7 (DIO_CHANNEL_ID(DIO_PORT_A, 7))
+#define DIO_CHANNEL_A8 (DIO_CHANNEL_ID(DIO_PORT_A, 8))
+#define DIO_CHANNEL_A9 (DIO_CHANNEL_ID(DIO_PORT_A, 9))
+#define DIO_CHANNEL_A10 (DIO_CHANNEL_ID(DIO_PORT_A, 10))
+#define DIO_CHANNEL_A11 (DIO_CHANNEL_ID(DIO_PORT_A, 11))
+#define DIO_CHANNEL_A12 (DIO_CHANNEL_ID(DIO_PORT_A, 12))
+#define DIO_CHANNEL_A13 (DIO_CHANNEL_ID(DIO_PORT_A, 13))
+#define DIO_CHANNEL_A14 (DIO_CHANNEL_ID(DIO_PORT_A, 14))
+#define DIO_CHANNEL_A15 (DIO_CHANNEL_ID(DIO_PORT_A, 15))
+
+#define DIO_CHANNEL_B0 (DIO_CHANNEL_ID(DIO_PORT_B, 0))
+#define DIO_CHANNEL_B1 (DIO_CHANNEL_ID(DIO_PORT_B, 1))
+#define DIO_CHANNEL_B2 (DIO_CHANNEL_ID(DIO_PORT_B, 2))
+#define DIO_CHANNEL_B3 (DIO_CHANNEL_ID(DIO_PORT_B, 3))
+#define DIO_CHANNEL_B4 (DIO_CHANNEL_ID(DIO_PORT_B, 4))
+#define DIO_CHANNEL_B5 (DIO_CHANNEL_ID(DIO_PORT_B, 5))
+#define DIO_CHANNEL_B6 (DIO_CHANNEL_ID(DIO_PORT_B, 6))
+#define DIO_CHANNEL_B7 (DIO_CHANNEL_ID(DIO_PORT_B, 7))
+#define DIO_CHANNEL_B8 (DIO_CHANNEL_ID(DIO_PORT_B, 8))
+#define DIO_CHANNEL_B9 (DIO_CHANNEL_ID(DIO_PORT_B, 9))
+#define DIO_CHANNEL_B10 (DIO_CHANNEL_ID(DIO_PORT_B, 10))
+#define DIO_CHANNEL_B11 (DIO_CHANNEL_ID(DIO_PORT_B, 11))
+#define DIO_CHANNEL_B12 (DIO_CHANNEL_ID(DIO_PORT_B, 12))
+#define DIO_CHANNEL_B13 (DIO_CHANNEL_ID(DIO_PORT_B, 13))
+#define DIO_CHANNEL_B14 (DIO_CHANNEL_ID(DIO_PORT_B, 14))
+#define DIO_CHANNEL_B15 (DIO_CHANNEL_ID(DIO_PORT_B, 15))
+
+#define DIO_CHANNEL_C0 (DIO_CHANNEL_ID(DIO_PORT_C, 0))
+#define DIO_CHANNEL_C1 (DIO_CHANNEL_ID(DIO_PORT_C, 1))
+#define DIO_CHANNEL_C2 (DIO_CHANNEL_ID(DIO_PORT_C, 2))
+#define DIO_CHANNEL_C3 (DIO_CHANNEL_ID(DIO_PORT_C, 3))
+#define DIO_CHANNEL_C4 (DIO_CHANNEL_ID(DIO_PORT_C, 4))
+#define DIO_CHANNEL_C5 (DIO_CHANNEL_ID(DIO_PORT_C, 5))
+#define DIO_CHANNEL_C6 (DIO_CHANNEL_ID(DIO_PORT_C, 6))
+#define DIO_CHANNEL_C7 (DIO_CHANNEL_ID(DIO_PORT_C, 7))
+#define DIO_CHANNEL_C8 (DIO_CHANNEL_ID(DIO_PORT_C, 8))
+#define DIO_CHANNEL_C9 (DIO_CHANNEL_ID(DIO_PORT_C, 9))
+#define DIO_CHANNEL_C10 (DIO_CHANNEL_ID(DIO_PORT_C, 10))
+#define DIO_CHANNEL_C11 (DIO_CHANNEL_ID(DIO_PORT_C, 11))
+#define DIO_CHANNEL_C12 (DIO_CHANNEL_ID(DIO_PORT_C, 12))
+#define DIO_CHANNEL_C13 (DIO_CHANNEL_ID(DIO_PORT_C, 13))
+#define DIO_CHANNEL_C14 (DIO_CHANNEL_ID(DIO_PORT_C, 14))
+#define DIO_CHANNEL_C15 (DIO_CHANNEL_ID(DIO_PORT_C, 15))
+
+
+#define DIO_CHANNEL_D0 (DIO_CHANNEL_ID(DIO_PORT_D, 0))
+#define DIO_CHANNEL_D1 (DIO_CHANNEL_ID(DIO_PORT_D, 1))
+#define DIO_CHANNEL_D2 (DIO_CHANNEL_ID(DIO_PORT_D, 2))
+#define DIO_CHANNEL_D3 (DIO_CHANNEL_ID(DIO_PORT_D, 3))
+#define DIO_CHANNEL_D4 (DIO_CHANNEL_ID(DIO_PORT_D, 4))
+#define DIO_CHANNEL_D5 (DIO_CHANNEL_ID(DIO_PORT_D, 5))
+#define DIO_CHANNEL_D6 (DIO_CHANNEL_ID(DIO_PORT_D, 6))
+#define DIO_CHANNEL_D7 (DIO_CHANNEL_ID(DIO_PORT_D, 7))
+#define DIO_CHANNEL_D8 (DIO_CHANNEL_ID(DIO_PORT_D, 8))
+#define DIO_CHANNEL_D9 (DIO_CHANNEL_ID(DIO_PORT_D, 9))
+#define DIO_CHANNEL_D10 (DIO_CHANNEL_ID(DIO_PORT_D, 10))
+#define DIO_CHANNEL_D11 (DIO_CHANNEL_ID(DIO_PORT_D, 11))
+#define DIO_CHANNEL_D12 (DIO_CHANNEL_ID(DIO_PORT_D, 12))
+#define DIO_CHANNEL_D13 (DIO_CHANNEL_ID(DIO_PORT_D, 13))
+#define DIO_CHANNEL_D14 (DIO_CHANNEL_ID(DIO_PORT_D, 14))
+#define DIO_CHANNEL_D15 (DIO_CHANNEL_ID(DIO_PORT_D, 15))
+
+/* Tên kênh theo chức năng (DioConf_DioChannel_xxx) và bảng Dio của ứng
+ * dụng nằm trong Dio_Lcfg.h (sinh từ TOOLS/mcal_config.json), ứng dụng
+ * tự include; thư viện không phụ thuộc cấu hình của dự án */
 
 /**********************************************************
  * ========================================================
@@ -174,11 +156,12 @@ typedef uint8 Dio_LevelType;
  * @typedef Dio_ChannelGroupType
  * @brief kiểu dữ liệu đại diện cho một nhóm kênh DIO.
  * @details kiểu này được sử dụng để xác định một nhóm các kênh DIO trong cùng một cổng.
+ *          port lưu sẵn con trỏ GPIO (vd GPIOB) để không phải tra cổng khi gọi API.
  **********************************************************/
 
 typedef struct 
 {
-    Dio_PortType port;
+    GPIO_TypeDef* port;
     uint16 mask;
     uint8 offset;
 } Dio_ChannelGroupType;
@@ -205,5 +188,55 @@ void DIO_GetVersionInfo(Std_VersionInfoType* versioninfo);
 Dio_LevelType DIO_FlipChannel(Dio_ChannelType ChannelId);
 void DIO_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask);
 
+/**********************************************************
+ * ========================================================
+ * Ghi đệm (staging) và commit theo lô
+ * ========================================================
+ * Dio_StageChannel/Dio_StageChannelGroup chỉ ghi vào bản đệm set/reset
+ * của từng cổng trong RAM. Dio_Commit() đẩy mỗi cổng có thay đổi ra
+ * bằng đúng một lần ghi BSRR: mọi output cùng cổng đổi trên cùng một
+ * chu kỳ bus. Gọi từ cùng một task (không reentrant).
+ **********************************************************/
+void Dio_StageChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
+void Dio_StageChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level);
+void Dio_Commit(void);
+
+/**********************************************************
+ * ========================================================
+ * Chụp/ghi đồng thời mọi cổng
+ * ========================================================
+ * Dio_ReadAllPorts đọc IDR của DIO_PORT_COUNT cổng bằng các lệnh load
+ * liền nhau (địa chỉ nạp sẵn từ Dio_PortIdrMap, không có logic xen
+ * giữa), Levels[n] là mức của cổng n. Dio_WriteAllPorts tính trước
+ * mọi word BSRR rồi ghi bằng DIO_PORT_COUNT lệnh store liền nhau;
+ * mỗi cổng nhận đúng Levels[n] như DIO_WritePort (kể cả bit ODR chọn
+ * pull-up/pull-down của chân input).
+ *
+ * Độ lệch (skew) giữa cổng đầu và cổng cuối, Cortex-M3 @ 72 MHz,
+ * APB2 = HCLK: mỗi truy cập GPIO qua cầu AHB-APB mất khoảng 2-3 HCLK
+ * và các load/store liền nhau được pipeline, nên lệch tối đa
+ * (DIO_PORT_COUNT - 1) x 3 = 9 HCLK (~125 ns) khi không có ngắt.
+ * So với 4 lần gọi DIO_ReadPort (gọi hàm + kiểm tra + tra bảng cho
+ * mỗi cổng, ~15 HCLK/cổng) độ lệch giảm khoảng 5 lần. Ngắt xảy ra
+ * giữa hai lệnh load sẽ cộng thêm toàn bộ thời gian ISR: cần ảnh
+ * chụp chặt chẽ tuyệt đối thì gọi trong vùng tắt ngắt.
+ * Host bench in ra khoảng cách lệnh giữa truy cập đầu và cuối (span):
+ * 3 lệnh cho Dio_ReadAllPorts/Dio_WriteAllPorts, 39 lệnh cho 4 lần gọi
+ * DIO_ReadPort/DIO_WritePort.
+ **********************************************************/
+void Dio_ReadAllPorts(Dio_PortLevelType Levels[]);
+void Dio_WriteAllPorts(const Dio_PortLevelType Levels[]);
+
+/**********************************************************
+ * ========================================================
+ * Nhóm kênh ảo nhiều cổng (Dio_VirtualGroupType, xem Dio_Cfg.h)
+ * ========================================================
+ * Đọc: một load IDR mỗi cổng rồi một lần tra bảng cho mỗi nibble IDR
+ * có chân của nhóm. Ghi: một lần tra bảng cho mỗi nibble giá trị rồi
+ * đúng một store BSRR mỗi cổng, không vòng lặp theo từng bit.
+ **********************************************************/
+Dio_PortLevelType Dio_ReadVirtualGroup(const Dio_VirtualGroupType* GroupPtr);
+void Dio_WriteVirtualGroup(const Dio_VirtualGroupType* GroupPtr, Dio_PortLevelType Level);
+
 
 #endif
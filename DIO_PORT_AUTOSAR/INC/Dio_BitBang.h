@@ -0,0 +1,206 @@
+/**********************************************************
+ * @file    Dio_BitBang.h
+ * @brief   SPI / I2C / one-wire bằng phần mềm trên các kênh DIO
+ * @details Lúc Init, mỗi chân được phân giải thành con trỏ BSRR/IDR và
+ *          word BSRR set/reset, nên vòng lặp bit chỉ còn store word
+ *          có sẵn và load IDR. Nhịp không dùng vòng __NOP() mà đặt
+ *          từng cạnh ở một mốc tuyệt đối của DWT->CYCCNT (mốc trước
+ *          + nửa chu kỳ bit): thời gian chạy code giữa hai cạnh nằm
+ *          trong nửa chu kỳ đó, không cộng dồn thành sai số. Số chu
+ *          kỳ tính từ SystemCoreClock nên đổi tần số lõi chỉ cần gọi
+ *          lại Init (sau SystemCoreClockUpdate()).
+ *
+ *          Tốc độ tối đa được đo ngay trong Init: chạy vòng lặp bit
+ *          với mọi word BSRR = 0 (ghi 0 vào BSRR không đổi chân) và
+ *          nửa chu kỳ = 0, số chu kỳ CYCCNT mỗi bit cho ra maxBitrate.
+ *          Tốc độ yêu cầu lớn hơn bị giới hạn về maxBitrate; bitrate
+ *          trong handle là tốc độ thực (làm tròn xuống).
+ *
+ *          Cấu hình chân do Port đảm nhiệm: SPI dùng output push-pull
+ *          (SCK, MOSI) và input (MISO); I2C và one-wire dùng output
+ *          open-drain có điện trở kéo lên, đọc lại mức bus qua IDR.
+ *          Ngắt dài hơn nửa chu kỳ bit làm giãn bit đó (SPI/I2C chịu
+ *          được vì slave chạy theo clock), nhưng phá slot one-wire:
+ *          nên che ngắt quanh các lệnh one-wire.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_BITBANG_H
+#define DIO_BITBANG_H
+
+#include "Dio.h"
+
+#define DIO_BITBANG_NO_PIN      0xFFFFU     /**< Không dùng chân (MOSI/MISO) */
+
+/**********************************************************
+ * @struct  Dio_BitBangPinType
+ * @brief   Một chân đã phân giải sẵn
+ **********************************************************/
+typedef struct {
+    volatile uint32_t* bsrr;    /**< BSRR của cổng chứa chân */
+    volatile uint32_t* idr;     /**< IDR của cổng chứa chân */
+    uint32             high;    /**< Word BSRR đưa chân lên 1 (nhả nếu open-drain) */
+    uint32             low;     /**< Word BSRR kéo chân xuống 0 */
+    uint16             mask;    /**< Bit của chân trong IDR */
+} Dio_BitBangPinType;
+
+/* ===============================
+ *              SPI
+ * =============================== */
+
+/**********************************************************
+ * @struct  Dio_BitBangSpiConfigType
+ * @brief   Cấu hình SPI master (MSB trước, CS do người gọi điều khiển)
+ **********************************************************/
+typedef struct {
+    Dio_ChannelType Sck;
+    Dio_ChannelType Mosi;       /**< DIO_BITBANG_NO_PIN: chỉ nhận */
+    Dio_ChannelType Miso;       /**< DIO_BITBANG_NO_PIN: chỉ phát */
+    uint8           Mode;       /**< 0..3: bit 1 = CPOL, bit 0 = CPHA */
+    uint32          Bitrate;    /**< Tốc độ mong muốn (bit/s) */
+} Dio_BitBangSpiConfigType;
+
+/**********************************************************
+ * @struct  Dio_BitBangSpiType
+ * @brief   SPI đã biên dịch thành word BSRR
+ * @details Mỗi bit là 2 nửa chu kỳ: store firstWord[bit] (MOSI, kèm
+ *          cạnh SCK nếu MOSI cùng cổng SCK), chờ, store secondWord
+ *          (cạnh SCK còn lại), lấy mẫu MISO, chờ. MOSI khác cổng
+ *          (mosi.bsrr != sck.bsrr) tốn thêm store firstSck.
+ **********************************************************/
+typedef struct {
+    Dio_BitBangPinType sck;
+    Dio_BitBangPinType mosi;
+    Dio_BitBangPinType miso;
+    uint32             firstWord[2];    /**< Chỉ số: giá trị bit MOSI */
+    uint32             firstSck;        /**< Cạnh SCK khi MOSI khác cổng (không gộp) */
+    uint32             secondWord;
+    uint32             endWord;         /**< Đưa SCK về mức nghỉ sau bit cuối (CPHA = 0) */
+    uint32             halfCycles;      /**< Nửa chu kỳ bit, đơn vị chu kỳ CYCCNT */
+    uint32             bitrate;         /**< Tốc độ thực (bit/s) */
+    uint32             maxBitrate;      /**< Tốc độ tối đa đo được lúc Init */
+} Dio_BitBangSpiType;
+
+/* ===============================
+ *              I2C
+ * =============================== */
+
+/**********************************************************
+ * @struct  Dio_BitBangI2cConfigType
+ * @brief   Cấu hình I2C master (SCL/SDA open-drain, địa chỉ 7 bit)
+ **********************************************************/
+typedef struct {
+    Dio_ChannelType Scl;
+    Dio_ChannelType Sda;
+    uint32          Bitrate;            /**< 100000, 400000... (bit/s) */
+    uint32          StretchTimeoutUs;   /**< Thời gian tối đa slave được giữ SCL thấp */
+} Dio_BitBangI2cConfigType;
+
+/**********************************************************
+ * @struct  Dio_BitBangI2cType
+ * @brief   I2C đã biên dịch thành word BSRR
+ **********************************************************/
+typedef struct {
+    Dio_BitBangPinType scl;
+    Dio_BitBangPinType sda;
+    uint32             halfCycles;
+    uint32             stretchCycles;
+    uint32             bitrate;
+    uint32             maxBitrate;
+} Dio_BitBangI2cType;
+
+/* ===============================
+ *            One-wire
+ * =============================== */
+
+/**********************************************************
+ * @struct  Dio_BitBangOneWireType
+ * @brief   One-wire tốc độ chuẩn, thời gian slot đổi sẵn ra chu kỳ
+ * @details Tên theo Maxim AN126 (µs): A = 6, C = 60, D = 10, E = 9,
+ *          F = 55, H = 480, I = 70, J = 410. Slot bit dài cố định
+ *          A + E + F = C + D = 70 µs nên bitrate do giao thức quyết định.
+ **********************************************************/
+typedef struct {
+    Dio_BitBangPinType pin;
+    uint32             a, c, d, e, f, h, i, j;
+    uint32             bitrate;
+    uint32             maxBitrate;
+} Dio_BitBangOneWireType;
+
+/**********************************************************
+ * @brief   Phân giải chân, tính nhịp và đo tốc độ tối đa của SPI
+ * @param[out] Spi     Handle (RAM)
+ * @param[in]  Config  Cấu hình
+ * @return  E_OK, E_NOT_OK nếu kênh, mode hoặc bitrate không hợp lệ
+ **********************************************************/
+Std_ReturnType Dio_BitBangSpiInit(Dio_BitBangSpiType* Spi, const Dio_BitBangSpiConfigType* Config);
+
+/**********************************************************
+ * @brief   Trao đổi Length byte full-duplex
+ * @param[in]  Spi     Handle đã Init
+ * @param[in]  Tx      Dữ liệu phát, NULL: phát 0xFF
+ * @param[out] Rx      Dữ liệu nhận, NULL: bỏ qua
+ * @param[in]  Length  Số byte
+ **********************************************************/
+void Dio_BitBangSpiTransfer(const Dio_BitBangSpiType* Spi, const uint8* Tx, uint8* Rx,
+                            uint32 Length);
+
+/**********************************************************
+ * @brief   Phân giải chân, tính nhịp và đo tốc độ tối đa của I2C
+ * @param[out] I2c     Handle (RAM)
+ * @param[in]  Config  Cấu hình
+ * @return  E_OK, E_NOT_OK nếu kênh hoặc bitrate không hợp lệ
+ **********************************************************/
+Std_ReturnType Dio_BitBangI2cInit(Dio_BitBangI2cType* I2c, const Dio_BitBangI2cConfigType* Config);
+
+/**********************************************************
+ * @brief   START, địa chỉ + W, Length byte, STOP
+ * @param[in] I2c      Handle đã Init
+ * @param[in] Address  Địa chỉ 7 bit
+ * @param[in] Data     Dữ liệu ghi
+ * @param[in] Length   Số byte
+ * @return  E_OK nếu mọi byte được ACK, E_NOT_OK nếu NACK hoặc hết
+ *          thời gian chờ clock stretching (STOP vẫn được phát)
+ **********************************************************/
+Std_ReturnType Dio_BitBangI2cWrite(const Dio_BitBangI2cType* I2c, uint8 Address,
+                                   const uint8* Data, uint32 Length);
+
+/**********************************************************
+ * @brief   START, địa chỉ + R, đọc Length byte (NACK byte cuối), STOP
+ * @param[in]  I2c      Handle đã Init
+ * @param[in]  Address  Địa chỉ 7 bit
+ * @param[out] Data     Buffer nhận
+ * @param[in]  Length   Số byte (>= 1)
+ * @return  E_OK, E_NOT_OK nếu địa chỉ bị NACK hoặc hết thời gian chờ
+ **********************************************************/
+Std_ReturnType Dio_BitBangI2cRead(const Dio_BitBangI2cType* I2c, uint8 Address,
+                                  uint8* Data, uint32 Length);
+
+/**********************************************************
+ * @brief   Phân giải chân và đổi thời gian slot ra chu kỳ CYCCNT
+ * @param[out] OneWire  Handle (RAM)
+ * @param[in]  Pin      Kênh DIO (open-drain, có kéo lên)
+ * @return  E_OK, E_NOT_OK nếu kênh không hợp lệ
+ **********************************************************/
+Std_ReturnType Dio_BitBangOneWireInit(Dio_BitBangOneWireType* OneWire, Dio_ChannelType Pin);
+
+/**********************************************************
+ * @brief   Xung reset 480 µs và dò xung presence
+ * @return  E_OK nếu có thiết bị trả lời presence
+ **********************************************************/
+Std_ReturnType Dio_BitBangOneWireReset(const Dio_BitBangOneWireType* OneWire);
+
+/**********************************************************
+ * @brief   Ghi Length byte, LSB trước
+ **********************************************************/
+void Dio_BitBangOneWireWrite(const Dio_BitBangOneWireType* OneWire, const uint8* Data,
+                             uint32 Length);
+
+/**********************************************************
+ * @brief   Đọc Length byte (mỗi bit là một slot ghi 1), LSB trước
+ **********************************************************/
+void Dio_BitBangOneWireRead(const Dio_BitBangOneWireType* OneWire, uint8* Data, uint32 Length);
+
+#endif /* DIO_BITBANG_H */
@@ -0,0 +1,195 @@
+/**********************************************************
+ * @file    Dio_Bus.h
+ * @brief   Bus song song 8 bit kiểu 8080 (WR/RD) và 6800 (E, R/W) trên GPIO
+ * @details Thay cho 8 lần DIO_WriteChannel + strobe cho mỗi byte: bảng
+ *          256 phần tử (tính lúc biên dịch, nằm trong flash) đổi giá trị
+ *          byte thành word BSRR của 8 chân data. Nếu chân strobe ghi
+ *          (WR/E) nằm cùng cổng với data, cạnh kích strobe được gộp sẵn
+ *          vào word đó, nên mỗi byte chỉ tốn 2 lệnh store:
+ *          - 8080: data + WR = 0, rồi WR = 1 (thiết bị chốt ở cạnh lên WR)
+ *          - 6800: data + E = 1, rồi E = 0 (thiết bị chốt ở cạnh xuống E)
+ *          Strobe ở cổng khác: 3 store/byte (data, kích, nhả).
+ *          Đọc: kích RD/E, một load IDR, nhả, đổi IDR -> byte bằng bảng
+ *          gather theo nibble. Chân data được chuyển sang input trong
+ *          lúc Dio_BusRead và trả lại output khi xong.
+ *
+ *          Chu kỳ ước tính (Cortex-M3 72 MHz, APB2 = HCLK, flash 2 WS,
+ *          mỗi store GPIO ~3 HCLK): ghi gộp strobe ~12 HCLK/byte
+ *          (~6 MB/s), strobe khác cổng ~15 HCLK/byte. Chỉ đúng khi
+ *          thiết bị chịu được độ rộng xung strobe ~40 ns; thiết bị
+ *          chậm hơn dùng Dio_BusWriteDma với timer làm nhịp.
+ *
+ *          Chế độ DMA (chỉ khi strobe ghi gộp được): CPU mở rộng mỗi
+ *          byte thành 2 word BSRR vào buffer của người gọi, Dio_Stream
+ *          phát buffer (one-shot) lên BSRR theo nhịp timer.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_BUS_H
+#define DIO_BUS_H
+
+#include "Dio.h"
+#include "Dio_Stream.h"
+#include <stddef.h>
+
+/**********************************************************
+ * @struct  Dio_BusStrobeType
+ * @brief   Chân strobe: word BSRR để kích và nhả
+ **********************************************************/
+typedef struct {
+    volatile uint32_t* bsrr;        /**< BSRR của cổng chứa chân strobe */
+    uint32             assertWord;  /**< 0: đã gộp vào bảng ghi (cùng cổng data) */
+    uint32             releaseWord;
+} Dio_BusStrobeType;
+
+/**********************************************************
+ * @struct  Dio_BusType
+ * @brief   Một bus song song đã biên dịch thành bảng tra
+ * @details Khởi tạo bằng DIO_BUS_8080 / DIO_BUS_6800.
+ **********************************************************/
+typedef struct {
+    GPIO_TypeDef*      dataPort;         /**< Cổng chứa 8 chân data */
+    Dio_PortType       dataPortId;       /**< DIO_PORT_x của dataPort (chế độ DMA) */
+    uint16             dataMask;         /**< Chân data trên dataPort */
+    uint32             crMask[2];        /**< Nibble CRL/CRH của chân data */
+    uint32             crOutput[2];      /**< Output push-pull 50 MHz */
+    uint32             crInput[2];       /**< Input floating */
+    Dio_BusStrobeType  write;            /**< WR (8080) / E (6800) */
+    Dio_BusStrobeType  read;             /**< RD (8080) / E (6800) */
+    volatile uint32_t* dirBsrr;          /**< R/W (6800), NULL với 8080 */
+    uint32             dirWrite;         /**< Word BSRR chọn chiều ghi */
+    uint32             dirRead;          /**< Word BSRR chọn chiều đọc */
+    uint8              gather[4][16];    /**< Nibble IDR -> bit data */
+    uint32             writeTable[256];  /**< Byte -> word BSRR (kèm kích strobe nếu gộp) */
+} Dio_BusType;
+
+/* ==== Macro sinh bảng (D0..D7 là DIO_CHANNEL_xx trên cùng một cổng, sai cổng là lỗi biên dịch) ==== */
+
+#define DIO_BUS_PIN(Ch)             ((Ch) % DIO_PINS_PER_PORT)
+#define DIO_BUS_SET(Ch)             (1UL << DIO_BUS_PIN(Ch))
+#define DIO_BUS_RESET(Ch)           (1UL << (DIO_BUS_PIN(Ch) + 16U))
+#define DIO_BUS_LEVEL(Ch, High)     ((High) ? DIO_BUS_SET(Ch) : DIO_BUS_RESET(Ch))
+#define DIO_BUS_BSRR(Ch)            ((volatile uint32_t*)(DIO_GPIO_BASE(Ch) + 0x10UL))
+#define DIO_BUS_SAME_PORT(A, B)     (((A) / DIO_PINS_PER_PORT) == ((B) / DIO_PINS_PER_PORT))
+
+/* Word BSRR của bit b trong byte v */
+#define DIO_BUS_BIT(v, b, Ch)       ((((v) >> (b)) & 1U) ? DIO_BUS_SET(Ch) : DIO_BUS_RESET(Ch))
+
+#define DIO_BUS_ENTRY(v, A, D0, D1, D2, D3, D4, D5, D6, D7) \
+    ((A) | DIO_BUS_BIT(v, 0U, D0) | DIO_BUS_BIT(v, 1U, D1) | DIO_BUS_BIT(v, 2U, D2) | \
+     DIO_BUS_BIT(v, 3U, D3) | DIO_BUS_BIT(v, 4U, D4) | DIO_BUS_BIT(v, 5U, D5) | \
+     DIO_BUS_BIT(v, 6U, D6) | DIO_BUS_BIT(v, 7U, D7))
+
+#define DIO_BUS_R4(v, ...) \
+    DIO_BUS_ENTRY((v) + 0U, __VA_ARGS__), DIO_BUS_ENTRY((v) + 1U, __VA_ARGS__), \
+    DIO_BUS_ENTRY((v) + 2U, __VA_ARGS__), DIO_BUS_ENTRY((v) + 3U, __VA_ARGS__)
+#define DIO_BUS_R16(v, ...) \
+    DIO_BUS_R4((v) + 0U, __VA_ARGS__), DIO_BUS_R4((v) + 4U, __VA_ARGS__), \
+    DIO_BUS_R4((v) + 8U, __VA_ARGS__), DIO_BUS_R4((v) + 12U, __VA_ARGS__)
+#define DIO_BUS_R64(v, ...) \
+    DIO_BUS_R16((v) + 0U, __VA_ARGS__), DIO_BUS_R16((v) + 16U, __VA_ARGS__), \
+    DIO_BUS_R16((v) + 32U, __VA_ARGS__), DIO_BUS_R16((v) + 48U, __VA_ARGS__)
+#define DIO_BUS_TABLE(A, ...) { \
+    DIO_BUS_R64(0U, A, __VA_ARGS__), DIO_BUS_R64(64U, A, __VA_ARGS__), \
+    DIO_BUS_R64(128U, A, __VA_ARGS__), DIO_BUS_R64(192U, A, __VA_ARGS__) }
+
+/* Bit data của chân vật lý Pin (0..15) trên cổng data */
+#define DIO_BUS_FIND(Pin, D0, D1, D2, D3, D4, D5, D6, D7) \
+    ((DIO_BUS_PIN(D0) == (Pin) ? 0x01U : 0U) | (DIO_BUS_PIN(D1) == (Pin) ? 0x02U : 0U) | \
+     (DIO_BUS_PIN(D2) == (Pin) ? 0x04U : 0U) | (DIO_BUS_PIN(D3) == (Pin) ? 0x08U : 0U) | \
+     (DIO_BUS_PIN(D4) == (Pin) ? 0x10U : 0U) | (DIO_BUS_PIN(D5) == (Pin) ? 0x20U : 0U) | \
+     (DIO_BUS_PIN(D6) == (Pin) ? 0x40U : 0U) | (DIO_BUS_PIN(D7) == (Pin) ? 0x80U : 0U))
+
+#define DIO_BUS_GATHER_NIBBLE(N, ...) DIO_VG_NIBBLE_TABLE( \
+    DIO_BUS_FIND((N) * 4U + 0U, __VA_ARGS__), DIO_BUS_FIND((N) * 4U + 1U, __VA_ARGS__), \
+    DIO_BUS_FIND((N) * 4U + 2U, __VA_ARGS__), DIO_BUS_FIND((N) * 4U + 3U, __VA_ARGS__))
+
+/* Nibble cấu hình Nib của chân Ch nếu chân nằm trong CRL (Half 0) / CRH (Half 1) */
+#define DIO_BUS_CR_PIN(Half, Nib, Ch) \
+    ((DIO_BUS_PIN(Ch) / 8U == (Half)) ? ((uint32)(Nib) << (4U * (DIO_BUS_PIN(Ch) % 8U))) : 0UL)
+#define DIO_BUS_CR(Half, Nib, D0, D1, D2, D3, D4, D5, D6, D7) \
+    (DIO_BUS_CR_PIN(Half, Nib, D0) | DIO_BUS_CR_PIN(Half, Nib, D1) | DIO_BUS_CR_PIN(Half, Nib, D2) | \
+     DIO_BUS_CR_PIN(Half, Nib, D3) | DIO_BUS_CR_PIN(Half, Nib, D4) | DIO_BUS_CR_PIN(Half, Nib, D5) | \
+     DIO_BUS_CR_PIN(Half, Nib, D6) | DIO_BUS_CR_PIN(Half, Nib, D7))
+
+/* Strobe ghi kích ở mức AssertHigh, gộp vào bảng nếu cùng cổng với D0 */
+#define DIO_BUS_WRITE_ASSERT(Wr, AssertHigh, D0) \
+    (DIO_BUS_SAME_PORT(Wr, D0) ? DIO_BUS_LEVEL(Wr, AssertHigh) : 0UL)
+
+#define DIO_BUS_BUILD(Wr, WrHigh, Rd, RdHigh, Dir, DirWrite, DirRead, D0, D1, D2, D3, D4, D5, D6, D7) { \
+    .dataPort = (GPIO_TypeDef*)DIO_GPIO_BASE(D0), \
+    .dataPortId = (Dio_PortType)DIO_CFG_CHECK((D0) / DIO_PINS_PER_PORT, \
+        DIO_BUS_SAME_PORT(D0, D1) && DIO_BUS_SAME_PORT(D0, D2) && DIO_BUS_SAME_PORT(D0, D3) && \
+        DIO_BUS_SAME_PORT(D0, D4) && DIO_BUS_SAME_PORT(D0, D5) && DIO_BUS_SAME_PORT(D0, D6) && \
+        DIO_BUS_SAME_PORT(D0, D7), "bus D0..D7 must share one port"), \
+    .dataMask = (uint16)(DIO_BUS_SET(D0) | DIO_BUS_SET(D1) | DIO_BUS_SET(D2) | DIO_BUS_SET(D3) | \
+                         DIO_BUS_SET(D4) | DIO_BUS_SET(D5) | DIO_BUS_SET(D6) | DIO_BUS_SET(D7)), \
+    .crMask   = { DIO_BUS_CR(0U, 0xFU, D0, D1, D2, D3, D4, D5, D6, D7), \
+                  DIO_BUS_CR(1U, 0xFU, D0, D1, D2, D3, D4, D5, D6, D7) }, \
+    .crOutput = { DIO_BUS_CR(0U, 0x3U, D0, D1, D2, D3, D4, D5, D6, D7), \
+                  DIO_BUS_CR(1U, 0x3U, D0, D1, D2, D3, D4, D5, D6, D7) }, \
+    .crInput  = { DIO_BUS_CR(0U, 0x4U, D0, D1, D2, D3, D4, D5, D6, D7), \
+                  DIO_BUS_CR(1U, 0x4U, D0, D1, D2, D3, D4, D5, D6, D7) }, \
+    .write = { DIO_BUS_BSRR(Wr), \
+               DIO_BUS_SAME_PORT(Wr, D0) ? 0UL : DIO_BUS_LEVEL(Wr, WrHigh), \
+               DIO_BUS_LEVEL(Wr, !(WrHigh)) }, \
+    .read  = { DIO_BUS_BSRR(Rd), DIO_BUS_LEVEL(Rd, RdHigh), DIO_BUS_LEVEL(Rd, !(RdHigh)) }, \
+    .dirBsrr = (Dir), \
+    .dirWrite = (DirWrite), \
+    .dirRead = (DirRead), \
+    .gather = { DIO_BUS_GATHER_NIBBLE(0U, D0, D1, D2, D3, D4, D5, D6, D7), \
+                DIO_BUS_GATHER_NIBBLE(1U, D0, D1, D2, D3, D4, D5, D6, D7), \
+                DIO_BUS_GATHER_NIBBLE(2U, D0, D1, D2, D3, D4, D5, D6, D7), \
+                DIO_BUS_GATHER_NIBBLE(3U, D0, D1, D2, D3, D4, D5, D6, D7) }, \
+    .writeTable = DIO_BUS_TABLE(DIO_BUS_WRITE_ASSERT(Wr, WrHigh, D0), D0, D1, D2, D3, D4, D5, D6, D7) }
+
+/**********************************************************
+ * Bus 8080: WR, RD tích cực mức thấp
+ * @param Wr, Rd   DIO_CHANNEL_xx của WR và RD
+ * @param ...      D0..D7 (DIO_CHANNEL_xx, cùng một cổng)
+ **********************************************************/
+#define DIO_BUS_8080(Wr, Rd, ...) \
+    DIO_BUS_BUILD(Wr, 0U, Rd, 0U, NULL, 0UL, 0UL, __VA_ARGS__)
+
+/**********************************************************
+ * Bus 6800: E tích cực mức cao, R/W = 0 khi ghi, 1 khi đọc
+ * @param E, Rw    DIO_CHANNEL_xx của E và R/W
+ * @param ...      D0..D7 (DIO_CHANNEL_xx, cùng một cổng)
+ **********************************************************/
+#define DIO_BUS_6800(E, Rw, ...) \
+    DIO_BUS_BUILD(E, 1U, E, 1U, DIO_BUS_BSRR(Rw), DIO_BUS_RESET(Rw), DIO_BUS_SET(Rw), __VA_ARGS__)
+
+/**********************************************************
+ * @brief   Ghi Length byte lên bus, mỗi byte một chu kỳ strobe ghi
+ * @param[in] Bus     Bus (DIO_BUS_8080 / DIO_BUS_6800)
+ * @param[in] Data    Dữ liệu cần ghi
+ * @param[in] Length  Số byte
+ **********************************************************/
+void Dio_BusWrite(const Dio_BusType* Bus, const uint8* Data, uint32 Length);
+
+/**********************************************************
+ * @brief   Đọc Length byte từ bus, mỗi byte một chu kỳ strobe đọc
+ * @param[in]  Bus     Bus (DIO_BUS_8080 / DIO_BUS_6800)
+ * @param[out] Data    Buffer nhận dữ liệu
+ * @param[in]  Length  Số byte
+ **********************************************************/
+void Dio_BusRead(const Dio_BusType* Bus, uint8* Data, uint32 Length);
+
+/**********************************************************
+ * @brief   Ghi bằng DMA: timer quyết định nhịp của từng nửa chu kỳ strobe
+ * @details Words nhận 2 word BSRR mỗi byte (phải tồn tại tới khi
+ *          Dio_StreamIsBusy(Timer->TIMx) trả về FALSE). Một byte mất
+ *          2 chu kỳ timer. Timer->mode phải là DIO_STREAM_ONESHOT.
+ * @param[in]  Bus     Bus có strobe ghi cùng cổng data
+ * @param[in]  Data    Dữ liệu cần ghi
+ * @param[in]  Length  Số byte (1..32767)
+ * @param[out] Words   Buffer 2 * Length word
+ * @param[in]  Timer   Timer tạo nhịp (xem Dio_StreamStart)
+ * @return  E_OK nếu đã bắt đầu, E_NOT_OK nếu bus/tham số không hợp lệ
+ **********************************************************/
+Std_ReturnType Dio_BusWriteDma(const Dio_BusType* Bus, const uint8* Data, uint16 Length,
+                               uint32* Words, const Dio_StreamTimerType* Timer);
+
+#endif /* DIO_BUS_H */
@@ -0,0 +1,95 @@
+/**********************************************************
+ * @file    Dio_Capture.h
+ * @brief   Lấy mẫu cả cổng GPIO bằng DMA (kiểu logic analyzer)
+ * @details Mỗi compare event của timer yêu cầu DMA1 chép GPIOx->IDR
+ *          (16 bit) vào một ring buffer trong RAM, chạy vòng tròn
+ *          liên tục. CPU chỉ tham gia ở ngắt nửa/cả buffer.
+ *
+ *          Dấu thời gian: DMA lấy mẫu đúng mỗi chu kỳ timer, nên mẫu
+ *          thứ n (tính từ lúc start) nằm ở thời điểm
+ *          n * (prescaler + 1) * (period + 1) xung clock timer
+ *          (DIO_CAPTURE_TICKS). Callback nhận chỉ số tuyệt đối của mẫu
+ *          đầu chunk để dựng lại cạnh xung mà không phải chép thêm
+ *          TIMx->CNT cho từng mẫu.
+ *
+ *          Ánh xạ timer -> yêu cầu DMA1 (RM0008, bảng 78), chọn để
+ *          không trùng kênh với Dio_Stream (TIMx_UP):
+ *          TIM2_CH3 -> Ch1, TIM3_CH1 -> Ch6, TIM4_CH2 -> Ch4.
+ *          Timer đang capture thuộc Dio_Capture (Clk_Claim) đến
+ *          Dio_CaptureStop; Pwm/Dio_Stream không giành được nó.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_CAPTURE_H
+#define DIO_CAPTURE_H
+
+#include "Dio.h"
+
+/* Chưa gặp mẫu trigger */
+#define DIO_CAPTURE_NO_TRIGGER      0xFFFFFFFFUL
+
+/* Thời điểm của mẫu Sample, tính bằng xung clock timer từ lúc start */
+#define DIO_CAPTURE_TICKS(TimerPtr, Sample) \
+    ((uint64_t)(Sample) * ((uint32_t)(TimerPtr)->prescaler + 1U) * ((uint32_t)(TimerPtr)->period + 1U))
+
+/**********************************************************
+ * @typedef Dio_CaptureNotificationType
+ * @brief   Callback khi nửa ring buffer vừa được ghi đầy
+ * @details Gọi trong ngắt DMA. Chunk chỉ hợp lệ đến khi DMA quay lại
+ *          ghi đè (nửa chu kỳ buffer), nên cần xử lý/chép ngay.
+ * @param[in] Chunk        Các mẫu IDR vừa lấy
+ * @param[in] Length       Số mẫu trong chunk
+ * @param[in] FirstSample  Chỉ số tuyệt đối của Chunk[0]
+ **********************************************************/
+typedef void (*Dio_CaptureNotificationType)(const uint16* Chunk, uint16 Length, uint32 FirstSample);
+
+/**********************************************************
+ * @struct  Dio_CaptureTimerType
+ * @brief   Timer tạo nhịp lấy mẫu và điều kiện trigger
+ * @details Tần số lấy mẫu = f_TIM / ((prescaler + 1) * (period + 1)).
+ *          TriggerMask = 0: báo mọi chunk. Khác 0: chỉ báo từ chunk
+ *          chứa mẫu đầu tiên có (mẫu & TriggerMask) == TriggerValue.
+ **********************************************************/
+typedef struct {
+    TIM_TypeDef*                TIMx;             /**< TIM2..TIM4 */
+    uint16                      prescaler;        /**< PSC */
+    uint16                      period;           /**< ARR */
+    uint16                      TriggerMask;      /**< Chân tham gia trigger */
+    uint16                      TriggerValue;     /**< Mức cần khớp */
+    Dio_CaptureNotificationType HalfCallback;     /**< Nửa đầu buffer đầy (NULL: tắt) */
+    Dio_CaptureNotificationType CompleteCallback; /**< Nửa sau buffer đầy (NULL: tắt) */
+} Dio_CaptureTimerType;
+
+/**********************************************************
+ * @brief   Bắt đầu lấy mẫu IDR của một cổng vào ring buffer
+ * @details Nếu timer đang capture, lần capture cũ bị dừng trước.
+ * @param[in]  PortId      Cổng cần lấy mẫu (DIO_PORT_x)
+ * @param[out] RingBuffer  Buffer vòng nhận mẫu
+ * @param[in]  Samples     Số mẫu của buffer (chẵn, >= 2)
+ * @param[in]  Timer       Timer lấy mẫu (phải tồn tại suốt capture)
+ * @return  E_OK nếu đã bắt đầu, E_NOT_OK nếu tham số sai hoặc timer
+ *          đang thuộc Pwm/Dio_Stream
+ **********************************************************/
+Std_ReturnType Dio_CaptureStart(Dio_PortType PortId, uint16* RingBuffer, uint16 Samples,
+                                const Dio_CaptureTimerType* Timer);
+
+/**********************************************************
+ * @brief   Dừng capture trên timer
+ * @details Trả clock DMA1 và timer cho Clk (timer không còn driver
+ *          nào giữ sẽ bị tắt clock) và nhả quyền dùng timer.
+ **********************************************************/
+void Dio_CaptureStop(TIM_TypeDef* TIMx);
+
+/**********************************************************
+ * @brief   Số mẫu đã lấy từ lúc start (chỉ số của mẫu kế tiếp)
+ **********************************************************/
+uint32 Dio_CaptureGetSampleCount(TIM_TypeDef* TIMx);
+
+/**********************************************************
+ * @brief   Chỉ số mẫu khớp trigger, DIO_CAPTURE_NO_TRIGGER nếu chưa có
+ **********************************************************/
+uint32 Dio_CaptureGetTriggerSample(TIM_TypeDef* TIMx);
+
+#endif /* DIO_CAPTURE_H */
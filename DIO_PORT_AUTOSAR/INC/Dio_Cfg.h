@@ -0,0 +1,326 @@
+/**********************************************************
+ * @file    Dio_Cfg.h
+ * @brief   DIO Driver Configuration Header File
+ * @details Khai báo bảng tra kênh/cổng DIO đã được tính sẵn
+ *          (nằm trong flash). Mỗi lần truy cập kênh chỉ cần một
+ *          lần đọc bảng theo chỉ số thay cho chuỗi so sánh.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_CFG_H
+#define DIO_CFG_H
+
+#include "Std_Types.h"
+#include "stm32f10x.h"
+
+/**********************************************************
+ * Số cổng và số kênh DIO được hỗ trợ (GPIOA..GPIOD, 16 chân/cổng)
+ **********************************************************/
+#define DIO_PORT_COUNT          4U
+#define DIO_PINS_PER_PORT       16U
+#define DIO_CHANNEL_COUNT       (DIO_PORT_COUNT * DIO_PINS_PER_PORT)
+
+/**********************************************************
+ * Đường truy cập kênh đơn (DIO_ReadChannel/DIO_WriteChannel)
+ * - STD_OFF: đọc IDR & mask, ghi BSRR (mặc định)
+ * - STD_ON : dùng vùng bit-band (0x42000000) của IDR/ODR, mỗi lần
+ *            đọc/ghi kênh là đúng một lệnh load/store vào alias
+ **********************************************************/
+#ifndef DIO_USE_BITBAND
+#define DIO_USE_BITBAND         STD_OFF
+#endif
+
+/**********************************************************
+ * Tính địa chỉ alias bit-band của IDR/ODR từ DIO_CHANNEL_xx
+ * alias = PERIPH_BB_BASE + (offset thanh ghi * 32) + (bit * 4)
+ * GPIOA..GPIOD nằm liên tiếp, cách nhau 0x400.
+ **********************************************************/
+#define DIO_GPIO_BASE(ChannelId) \
+    (GPIOA_BASE + ((uint32_t)(ChannelId) / DIO_PINS_PER_PORT) * 0x400UL)
+
+#define DIO_BITBAND_ALIAS(ChannelId, RegOffset) \
+    (PERIPH_BB_BASE + ((DIO_GPIO_BASE(ChannelId) + (RegOffset) - PERIPH_BASE) * 32UL) + \
+     (((uint32_t)(ChannelId) % DIO_PINS_PER_PORT) * 4UL))
+
+#define DIO_BITBAND_IDR(ChannelId)  DIO_BITBAND_ALIAS((ChannelId), 0x08UL)
+#define DIO_BITBAND_ODR(ChannelId)  DIO_BITBAND_ALIAS((ChannelId), 0x0CUL)
+
+/**********************************************************
+ * Vùng khóa ngắt ngắn qua PRIMASK: Dio_IrqSave trả về trạng thái cũ,
+ * Dio_IrqRestore đặt lại đúng trạng thái đó nên gọi lồng nhau được.
+ * Host build: PRIMASK là biến của mô hình thanh ghi (HOST/Host_Model.c),
+ * ngắt giả lập bị hoãn đến khi mở lại.
+ **********************************************************/
+#if defined(__arm__)
+static inline uint32 Dio_IrqSave(void)
+{
+    uint32 primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void Dio_IrqRestore(uint32 Primask)
+{
+    __set_PRIMASK(Primask);
+}
+#else
+extern volatile uint32_t Host_Primask;
+
+static inline uint32 Dio_IrqSave(void)
+{
+    uint32 primask = Host_Primask;
+    Host_Primask = 1U;
+    __asm__ volatile ("" ::: "memory");
+    return primask;
+}
+
+static inline void Dio_IrqRestore(uint32 Primask)
+{
+    __asm__ volatile ("" ::: "memory");
+    Host_Primask = Primask;
+}
+#endif
+
+/**********************************************************
+ * @struct  Dio_ChannelMapType
+ * @brief   Thông tin đã phân giải sẵn của một kênh DIO
+ **********************************************************/
+typedef struct {
+    GPIO_TypeDef* port;     /**< Con trỏ thanh ghi GPIO của kênh */
+    uint16        mask;     /**< Mặt nạ chân (1 << pin) */
+} Dio_ChannelMapType;
+
+/**********************************************************
+ * Bảng tra kênh: chỉ số là Dio_ChannelType (0..DIO_CHANNEL_COUNT-1)
+ **********************************************************/
+extern const Dio_ChannelMapType Dio_ChannelMap[DIO_CHANNEL_COUNT];
+
+#if (DIO_USE_BITBAND == STD_ON)
+/**********************************************************
+ * @struct  Dio_ChannelBitBandType
+ * @brief   Địa chỉ alias bit-band của một kênh DIO
+ **********************************************************/
+typedef struct {
+    volatile uint32* idr;   /**< Alias bit IDR: đọc ra 0/1 */
+    volatile uint32* odr;   /**< Alias bit ODR: ghi 0/1 */
+} Dio_ChannelBitBandType;
+
+/**********************************************************
+ * Bảng alias bit-band: chỉ số là Dio_ChannelType
+ **********************************************************/
+extern const Dio_ChannelBitBandType Dio_ChannelBitBand[DIO_CHANNEL_COUNT];
+#endif
+
+/**********************************************************
+ * Bảng tra cổng: chỉ số là Dio_PortType (DIO_PORT_A..DIO_PORT_D)
+ **********************************************************/
+extern GPIO_TypeDef* const Dio_PortMap[DIO_PORT_COUNT];
+
+/**********************************************************
+ * Địa chỉ IDR/BSRR tính sẵn của mọi cổng, theo thứ tự Dio_PortType,
+ * cho Dio_ReadAllPorts/Dio_WriteAllPorts (đọc/ghi liên tiếp)
+ **********************************************************/
+extern volatile uint32_t* const Dio_PortIdrMap[DIO_PORT_COUNT];
+extern volatile uint32_t* const Dio_PortBsrrMap[DIO_PORT_COUNT];
+
+/**********************************************************
+ * Chống dội (Dio_Debounce): các cổng được lọc và độ sâu lọc
+ * - mask : chân được lọc, chân ngoài mask luôn đọc ra 0
+ * - depth: số lần đọc liên tiếp khác trạng thái ổn định để lật
+ *          (1..DIO_DEBOUNCE_MAX_DEPTH; 1 = không lọc)
+ **********************************************************/
+#define DIO_DEBOUNCE_PLANES     4U
+#define DIO_DEBOUNCE_MAX_DEPTH  ((1U << DIO_DEBOUNCE_PLANES) - 1U)
+
+/**********************************************************
+ * Kiểm tra bảng config lúc biên dịch: DIO_CFG_xxx có giá trị hằng
+ * số, tham số ngoài miền làm dừng biên dịch.
+ * - DIO_CFG_DEBOUNCE(Port, Mask, Depth): một phần tử Dio_DebounceConfig;
+ *   depth 0 hoặc > DIO_DEBOUNCE_MAX_DEPTH (bộ đếm 4 bit bị tràn về 0)
+ *   làm chân không bao giờ lật
+ **********************************************************/
+#define DIO_CFG_CHECK(Value, Cond, Msg) \
+    ((Value) + 0U * sizeof(struct { _Static_assert(Cond, Msg); int dummy; }))
+
+#define DIO_CFG_DEBOUNCE(Port, Mask, Depth) { \
+    .port  = (uint8)DIO_CFG_CHECK(Port, (Port) < DIO_PORT_COUNT, "debounce port must be DIO_PORT_A..D"), \
+    .mask  = (uint16)DIO_CFG_CHECK(Mask, (Mask) != 0U && (Mask) <= 0xFFFFU, "debounce mask must be 0x0001..0xFFFF"), \
+    .depth = (uint8)DIO_CFG_CHECK(Depth, (Depth) >= 1U && (Depth) <= DIO_DEBOUNCE_MAX_DEPTH, \
+                                  "debounce depth must be 1..DIO_DEBOUNCE_MAX_DEPTH") }
+
+/**********************************************************
+ * @struct  Dio_DebounceConfigType
+ * @brief   Cấu hình chống dội của một cổng
+ **********************************************************/
+typedef struct {
+    uint8   port;       /**< DIO_PORT_x */
+    uint16  mask;       /**< Chân được lọc */
+    uint8   depth;      /**< Số mẫu liên tiếp để chấp nhận mức mới */
+} Dio_DebounceConfigType;
+
+/* Bảng của ứng dụng (Dio_Lcfg.c, sinh từ TOOLS/mcal_config.json), mỗi
+ * cổng tối đa một phần tử; thư viện chỉ biết số phần tử lúc link */
+extern const Dio_DebounceConfigType Dio_DebounceConfig[];
+extern const uint8 Dio_DebounceConfigCount;
+
+/**********************************************************
+ * Nhóm kênh ảo (Dio_ReadVirtualGroup/Dio_WriteVirtualGroup)
+ * Nhóm dựng từ danh sách chân có thứ tự (bit logic i = chân thứ i),
+ * trải trên tối đa 2 cổng, chân không cần liền nhau. Bảng tra theo
+ * nibble được tính lúc biên dịch bằng DIO_VIRTUAL_GROUP:
+ * - scatter: nibble n của giá trị -> bit set của cổng 0 (16 bit thấp)
+ *            và cổng 1 (16 bit cao), OR các nibble rồi ghi BSRR
+ * - gather : nibble n của IDR mỗi cổng -> bit logic, OR lại
+ * Mỗi nhóm tốn 512 byte flash.
+ **********************************************************/
+#define DIO_VGROUP_MAX_PINS     16U
+#define DIO_VGROUP_MAX_PORTS    2U
+#define DIO_VGROUP_NIBBLES      (DIO_VGROUP_MAX_PINS / 4U)
+#define DIO_VGROUP_NO_PIN       0xFFFFU     /* Đệm danh sách chân */
+
+/**********************************************************
+ * @struct  Dio_VirtualGroupType
+ * @brief   Nhóm kênh ảo đã biên dịch thành bảng tra
+ **********************************************************/
+typedef struct {
+    GPIO_TypeDef* port[DIO_VGROUP_MAX_PORTS];   /**< Cổng 0 và cổng 1 của nhóm */
+    uint16        mask[DIO_VGROUP_MAX_PORTS];   /**< Chân của nhóm trên mỗi cổng (0: không dùng) */
+    uint8         width;                        /**< Số bit logic */
+    uint32        scatter[DIO_VGROUP_NIBBLES][16];
+    uint16        gather[DIO_VGROUP_MAX_PORTS][DIO_VGROUP_NIBBLES][16];
+} Dio_VirtualGroupType;
+
+/* Một phần tử bảng nibble: OR trọng số của các bit đang bật trong v */
+#define DIO_VG_NIBBLE_ENTRY(v, w0, w1, w2, w3) \
+    ((((v) & 1U) ? (w0) : 0U) | (((v) & 2U) ? (w1) : 0U) | \
+     (((v) & 4U) ? (w2) : 0U) | (((v) & 8U) ? (w3) : 0U))
+
+#define DIO_VG_NIBBLE_TABLE(w0, w1, w2, w3) { \
+    DIO_VG_NIBBLE_ENTRY(0U,  w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(1U,  w0, w1, w2, w3), \
+    DIO_VG_NIBBLE_ENTRY(2U,  w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(3U,  w0, w1, w2, w3), \
+    DIO_VG_NIBBLE_ENTRY(4U,  w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(5U,  w0, w1, w2, w3), \
+    DIO_VG_NIBBLE_ENTRY(6U,  w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(7U,  w0, w1, w2, w3), \
+    DIO_VG_NIBBLE_ENTRY(8U,  w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(9U,  w0, w1, w2, w3), \
+    DIO_VG_NIBBLE_ENTRY(10U, w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(11U, w0, w1, w2, w3), \
+    DIO_VG_NIBBLE_ENTRY(12U, w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(13U, w0, w1, w2, w3), \
+    DIO_VG_NIBBLE_ENTRY(14U, w0, w1, w2, w3), DIO_VG_NIBBLE_ENTRY(15U, w0, w1, w2, w3) }
+
+/* Bit của chân Ch trong word scatter (cổng P0 -> nửa thấp, cổng còn lại -> nửa cao) */
+#define DIO_VG_SCATTER_BIT(Ch, P0) \
+    (((Ch) == DIO_VGROUP_NO_PIN) ? 0UL : \
+     ((1UL << ((Ch) % DIO_PINS_PER_PORT)) << ((((Ch) / DIO_PINS_PER_PORT) == (P0)) ? 0U : 16U)))
+
+/* Mặt nạ chân của nhóm trên cổng P */
+#define DIO_VG_PIN_MASK(Ch, P) \
+    ((((Ch) / DIO_PINS_PER_PORT) == (P)) ? (1U << ((Ch) % DIO_PINS_PER_PORT)) : 0U)
+
+/* Bit logic của chân vật lý Ch (0 nếu chân không thuộc nhóm) */
+#define DIO_VG_FIND(Ch, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15) \
+    (((L0)  == (Ch) ? 0x0001U : 0U) | ((L1)  == (Ch) ? 0x0002U : 0U) | \
+     ((L2)  == (Ch) ? 0x0004U : 0U) | ((L3)  == (Ch) ? 0x0008U : 0U) | \
+     ((L4)  == (Ch) ? 0x0010U : 0U) | ((L5)  == (Ch) ? 0x0020U : 0U) | \
+     ((L6)  == (Ch) ? 0x0040U : 0U) | ((L7)  == (Ch) ? 0x0080U : 0U) | \
+     ((L8)  == (Ch) ? 0x0100U : 0U) | ((L9)  == (Ch) ? 0x0200U : 0U) | \
+     ((L10) == (Ch) ? 0x0400U : 0U) | ((L11) == (Ch) ? 0x0800U : 0U) | \
+     ((L12) == (Ch) ? 0x1000U : 0U) | ((L13) == (Ch) ? 0x2000U : 0U) | \
+     ((L14) == (Ch) ? 0x4000U : 0U) | ((L15) == (Ch) ? 0x8000U : 0U))
+
+/* Bảng gather nibble N của cổng P */
+#define DIO_VG_GATHER_NIBBLE(P, N, ...) DIO_VG_NIBBLE_TABLE( \
+    DIO_VG_FIND((P) * DIO_PINS_PER_PORT + (N) * 4U + 0U, __VA_ARGS__), \
+    DIO_VG_FIND((P) * DIO_PINS_PER_PORT + (N) * 4U + 1U, __VA_ARGS__), \
+    DIO_VG_FIND((P) * DIO_PINS_PER_PORT + (N) * 4U + 2U, __VA_ARGS__), \
+    DIO_VG_FIND((P) * DIO_PINS_PER_PORT + (N) * 4U + 3U, __VA_ARGS__))
+
+#define DIO_VG_GATHER_PORT(P, ...) { \
+    DIO_VG_GATHER_NIBBLE(P, 0U, __VA_ARGS__), DIO_VG_GATHER_NIBBLE(P, 1U, __VA_ARGS__), \
+    DIO_VG_GATHER_NIBBLE(P, 2U, __VA_ARGS__), DIO_VG_GATHER_NIBBLE(P, 3U, __VA_ARGS__) }
+
+#define DIO_VG_MASK(P, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15) \
+    (uint16)(DIO_VG_PIN_MASK(L0, P)  | DIO_VG_PIN_MASK(L1, P)  | DIO_VG_PIN_MASK(L2, P)  | \
+             DIO_VG_PIN_MASK(L3, P)  | DIO_VG_PIN_MASK(L4, P)  | DIO_VG_PIN_MASK(L5, P)  | \
+             DIO_VG_PIN_MASK(L6, P)  | DIO_VG_PIN_MASK(L7, P)  | DIO_VG_PIN_MASK(L8, P)  | \
+             DIO_VG_PIN_MASK(L9, P)  | DIO_VG_PIN_MASK(L10, P) | DIO_VG_PIN_MASK(L11, P) | \
+             DIO_VG_PIN_MASK(L12, P) | DIO_VG_PIN_MASK(L13, P) | DIO_VG_PIN_MASK(L14, P) | \
+             DIO_VG_PIN_MASK(L15, P))
+
+#define DIO_VG_WIDTH(L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15) \
+    (uint8)(((L0)  != DIO_VGROUP_NO_PIN) + ((L1)  != DIO_VGROUP_NO_PIN) + \
+            ((L2)  != DIO_VGROUP_NO_PIN) + ((L3)  != DIO_VGROUP_NO_PIN) + \
+            ((L4)  != DIO_VGROUP_NO_PIN) + ((L5)  != DIO_VGROUP_NO_PIN) + \
+            ((L6)  != DIO_VGROUP_NO_PIN) + ((L7)  != DIO_VGROUP_NO_PIN) + \
+            ((L8)  != DIO_VGROUP_NO_PIN) + ((L9)  != DIO_VGROUP_NO_PIN) + \
+            ((L10) != DIO_VGROUP_NO_PIN) + ((L11) != DIO_VGROUP_NO_PIN) + \
+            ((L12) != DIO_VGROUP_NO_PIN) + ((L13) != DIO_VGROUP_NO_PIN) + \
+            ((L14) != DIO_VGROUP_NO_PIN) + ((L15) != DIO_VGROUP_NO_PIN))
+
+/* Chân Ch là chỗ trống hoặc thuộc cổng P0/P1 */
+#define DIO_VG_ON_PORTS(Ch, P0, P1) \
+    (((Ch) == DIO_VGROUP_NO_PIN) || (((Ch) / DIO_PINS_PER_PORT) == (P0)) || \
+     (((Ch) / DIO_PINS_PER_PORT) == (P1)))
+
+#define DIO_VG_ALL_ON_PORTS(P0, P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15) \
+    (DIO_VG_ON_PORTS(L0, P0, P1)  && DIO_VG_ON_PORTS(L1, P0, P1)  && DIO_VG_ON_PORTS(L2, P0, P1)  && \
+     DIO_VG_ON_PORTS(L3, P0, P1)  && DIO_VG_ON_PORTS(L4, P0, P1)  && DIO_VG_ON_PORTS(L5, P0, P1)  && \
+     DIO_VG_ON_PORTS(L6, P0, P1)  && DIO_VG_ON_PORTS(L7, P0, P1)  && DIO_VG_ON_PORTS(L8, P0, P1)  && \
+     DIO_VG_ON_PORTS(L9, P0, P1)  && DIO_VG_ON_PORTS(L10, P0, P1) && DIO_VG_ON_PORTS(L11, P0, P1) && \
+     DIO_VG_ON_PORTS(L12, P0, P1) && DIO_VG_ON_PORTS(L13, P0, P1) && DIO_VG_ON_PORTS(L14, P0, P1) && \
+     DIO_VG_ON_PORTS(L15, P0, P1))
+
+/* Số bit logic, kèm kiểm tra lúc biên dịch: cổng hợp lệ, 1..16 chân
+ * (L16 là phần tử thứ 17 sau khi đệm, phải còn là chỗ trống), mọi chân
+ * thuộc P0/P1 và không chân nào lặp lại (số bit mặt nạ = số chân) */
+#define DIO_VG_CHECKED_WIDTH(P0, P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15, L16) \
+    (uint8)DIO_CFG_CHECK(DIO_CFG_CHECK(DIO_CFG_CHECK(DIO_CFG_CHECK( \
+        DIO_VG_WIDTH(L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15), \
+        (P0) < DIO_PORT_COUNT && (P1) < DIO_PORT_COUNT, \
+        "virtual group ports must be DIO_PORT_A..D"), \
+        (L0) != DIO_VGROUP_NO_PIN && (L16) == DIO_VGROUP_NO_PIN, \
+        "virtual group takes 1..DIO_VGROUP_MAX_PINS pins"), \
+        DIO_VG_ALL_ON_PORTS(P0, P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15), \
+        "virtual group pin is not on Port0/Port1"), \
+        DIO_VG_WIDTH(L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15) == \
+        __builtin_popcount(DIO_VG_MASK(P0, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15)) + \
+        (((P1) == (P0)) ? 0 : \
+         __builtin_popcount(DIO_VG_MASK(P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15))), \
+        "virtual group pin listed twice")
+
+#define DIO_VG_BUILD(P0, P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15, L16, ...) { \
+    .port = { (GPIO_TypeDef*)DIO_GPIO_BASE((P0) * DIO_PINS_PER_PORT), \
+              (GPIO_TypeDef*)DIO_GPIO_BASE((P1) * DIO_PINS_PER_PORT) }, \
+    .mask = { DIO_VG_MASK(P0, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15), \
+              ((P1) == (P0)) ? (uint16)0U : \
+              DIO_VG_MASK(P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15) }, \
+    .width = DIO_VG_CHECKED_WIDTH(P0, P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, \
+                                  L13, L14, L15, L16), \
+    .scatter = { \
+        DIO_VG_NIBBLE_TABLE(DIO_VG_SCATTER_BIT(L0, P0),  DIO_VG_SCATTER_BIT(L1, P0), \
+                            DIO_VG_SCATTER_BIT(L2, P0),  DIO_VG_SCATTER_BIT(L3, P0)), \
+        DIO_VG_NIBBLE_TABLE(DIO_VG_SCATTER_BIT(L4, P0),  DIO_VG_SCATTER_BIT(L5, P0), \
+                            DIO_VG_SCATTER_BIT(L6, P0),  DIO_VG_SCATTER_BIT(L7, P0)), \
+        DIO_VG_NIBBLE_TABLE(DIO_VG_SCATTER_BIT(L8, P0),  DIO_VG_SCATTER_BIT(L9, P0), \
+                            DIO_VG_SCATTER_BIT(L10, P0), DIO_VG_SCATTER_BIT(L11, P0)), \
+        DIO_VG_NIBBLE_TABLE(DIO_VG_SCATTER_BIT(L12, P0), DIO_VG_SCATTER_BIT(L13, P0), \
+                            DIO_VG_SCATTER_BIT(L14, P0), DIO_VG_SCATTER_BIT(L15, P0)) }, \
+    .gather = { \
+        DIO_VG_GATHER_PORT(P0, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15), \
+        DIO_VG_GATHER_PORT(P1, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15) } }
+
+/**********************************************************
+ * Khởi tạo một Dio_VirtualGroupType từ danh sách chân
+ * @param Port0, Port1  Hai cổng của nhóm (DIO_PORT_x); nhóm một cổng: Port1 = Port0
+ * @param ...           1..16 kênh DIO_CHANNEL_xx theo thứ tự bit logic,
+ *                      mọi kênh phải thuộc Port0 hoặc Port1
+ * Sai cổng, quá 16 chân hoặc lặp chân là lỗi biên dịch (_Static_assert).
+ **********************************************************/
+#define DIO_VIRTUAL_GROUP(Port0, Port1, ...) \
+    DIO_VG_BUILD(Port0, Port1, __VA_ARGS__, \
+                 DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, \
+                 DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, \
+                 DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, \
+                 DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, DIO_VGROUP_NO_PIN, \
+                 DIO_VGROUP_NO_PIN)
+
+#endif /* DIO_CFG_H */
@@ -0,0 +1,60 @@
+/**********************************************************
+ * @file    Dio_Debounce.h
+ * @brief   Chống dội cho cả cổng input bằng bộ đếm dọc (SWAR)
+ * @details Mỗi chu kỳ Dio_DebounceMainFunction() đọc mỗi cổng cấu hình
+ *          đúng một lần (DIO_ReadPort) và lọc cả 16 chân song song:
+ *          bộ đếm của 16 chân được lưu theo "mặt phẳng bit" (bit b của
+ *          16 bộ đếm nằm chung một uint16), nên tăng/xóa/so sánh chỉ là
+ *          vài phép AND/XOR trên word. Chi phí là hằng số cho mỗi cổng,
+ *          không phụ thuộc số chân được lọc.
+ *
+ *          Một chân lật trạng thái ổn định khi đọc được mức khác
+ *          trạng thái hiện tại depth lần liên tiếp (Dio_DebounceConfig).
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_DEBOUNCE_H
+#define DIO_DEBOUNCE_H
+
+#include "Dio.h"
+
+/**********************************************************
+ * @struct  Dio_DebouncedPortType
+ * @brief   Trạng thái đã lọc của một cổng
+ **********************************************************/
+typedef struct {
+    Dio_PortLevelType State;    /**< Mức ổn định của các chân được lọc */
+    Dio_PortLevelType Rising;   /**< Chân lên 1 kể từ lần đọc trước */
+    Dio_PortLevelType Falling;  /**< Chân xuống 0 kể từ lần đọc trước */
+} Dio_DebouncedPortType;
+
+/**********************************************************
+ * @brief   Lấy mức hiện tại làm trạng thái ổn định ban đầu
+ * @details Gọi sau Port_Init, trước chu kỳ đầu của main function.
+ *          Dio_DebounceConfig có quá DIO_PORT_COUNT phần tử, cổng ngoài
+ *          miền hoặc trùng cổng: báo Det DIO_E_PARAM_CONFIG và không lọc
+ *          cổng nào.
+ **********************************************************/
+void Dio_DebounceInit(void);
+
+/**********************************************************
+ * @brief   Một bước lọc cho mọi cổng cấu hình (gọi theo chu kỳ, vd 1 ms)
+ **********************************************************/
+void Dio_DebounceMainFunction(void);
+
+/**********************************************************
+ * @brief   Đọc trạng thái đã lọc của một cổng
+ * @details Cạnh lên/xuống được tích lũy giữa hai lần gọi nên không
+ *          bị mất khi task đọc chậm hơn main function; gọi hàm này
+ *          sẽ xóa chúng. Đọc và xóa nằm trong một vùng khóa ngắt ngắn
+ *          nên main function chạy ở task/ngắt khác cũng không làm mất
+ *          cạnh.
+ * @param[in]  PortId  Cổng đã cấu hình trong Dio_DebounceConfig
+ * @param[out] Result  Trạng thái và cạnh
+ * @return  E_OK, hoặc E_NOT_OK nếu cổng không được lọc
+ **********************************************************/
+Std_ReturnType Dio_GetDebouncedPort(Dio_PortType PortId, Dio_DebouncedPortType* Result);
+
+#endif /* DIO_DEBOUNCE_H */
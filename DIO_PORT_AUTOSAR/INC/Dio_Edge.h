@@ -0,0 +1,93 @@
+/**********************************************************
+ * @file    Dio_Edge.h
+ * @brief   Báo cạnh lên/xuống của kênh input DIO bằng ngắt EXTI
+ * @details Thay cho việc poll DIO_ReadChannel trong vòng lặp chính:
+ *          mỗi EXTI line n (n = số chân) gắn với đúng một kênh DIO
+ *          (chân n của một cổng, chọn qua GPIO_EXTILineConfig). Bảng
+ *          dispatch là const (nằm trong flash), tra trực tiếp theo số
+ *          line. Vector dùng chung EXTI9_5/EXTI15_10 giải mã các line
+ *          pending bằng vòng lặp CLZ, mỗi vòng một line.
+ *
+ *          DIO_EDGE_MEASURE_LATENCY = STD_ON: đo số chu kỳ DWT từ đầu
+ *          ISR đến ngay trước callback (không gồm 12 chu kỳ vào ngắt
+ *          của lõi Cortex-M3), đọc bằng Dio_EdgeGetLatency().
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_EDGE_H
+#define DIO_EDGE_H
+
+#include "Dio.h"
+
+#define DIO_EDGE_LINE_COUNT     16U
+
+#ifndef DIO_EDGE_MEASURE_LATENCY
+#define DIO_EDGE_MEASURE_LATENCY    STD_OFF
+#endif
+
+/**********************************************************
+ * @enum    Dio_EdgeType
+ * @brief   Cạnh cần báo
+ **********************************************************/
+typedef enum {
+    DIO_EDGE_RISING  = 1,
+    DIO_EDGE_FALLING = 2,
+    DIO_EDGE_BOTH    = 3
+} Dio_EdgeType;
+
+/**********************************************************
+ * @typedef Dio_EdgeNotificationType
+ * @brief   Callback khi có cạnh, gọi trong ngữ cảnh ngắt EXTI
+ * @param[in] ChannelId  Kênh có cạnh
+ * @param[in] Level      Mức sau cạnh (STD_HIGH: cạnh lên)
+ **********************************************************/
+typedef void (*Dio_EdgeNotificationType)(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/**********************************************************
+ * @struct  Dio_EdgeLineConfigType
+ * @brief   Cấu hình một EXTI line
+ **********************************************************/
+typedef struct {
+    Dio_ChannelType          Channel;       /**< Kênh có số chân = số line */
+    Dio_EdgeType             Edge;          /**< Cạnh cần báo */
+    Dio_EdgeNotificationType Notification;  /**< NULL: line không dùng */
+} Dio_EdgeLineConfigType;
+
+/**********************************************************
+ * @struct  Dio_EdgeConfigType
+ * @brief   Bảng dispatch, chỉ số là số EXTI line (0..15)
+ **********************************************************/
+typedef struct {
+    Dio_EdgeLineConfigType Lines[DIO_EDGE_LINE_COUNT];
+} Dio_EdgeConfigType;
+
+/**********************************************************
+ * @brief   Cấu hình AFIO/EXTI/NVIC cho mọi line có Notification
+ * @details Các line được bật ngắt ngay (như Pwm_Init). Bảng cấu hình
+ *          phải tồn tại suốt thời gian chạy.
+ * @param[in] ConfigPtr  Bảng dispatch (const, trong flash)
+ **********************************************************/
+void Dio_EdgeInit(const Dio_EdgeConfigType* ConfigPtr);
+
+/**********************************************************
+ * @brief   Bật lại báo cạnh cho kênh (gỡ mask EXTI_IMR)
+ **********************************************************/
+void Dio_EdgeEnableNotification(Dio_ChannelType ChannelId);
+
+/**********************************************************
+ * @brief   Tạm tắt báo cạnh cho kênh (mask EXTI_IMR)
+ **********************************************************/
+void Dio_EdgeDisableNotification(Dio_ChannelType ChannelId);
+
+#if (DIO_EDGE_MEASURE_LATENCY == STD_ON)
+/**********************************************************
+ * @brief   Độ trễ từ đầu ISR đến callback (chu kỳ DWT)
+ * @param[out] Last  Lần báo gần nhất
+ * @param[out] Max   Lớn nhất từ lúc Dio_EdgeInit
+ **********************************************************/
+void Dio_EdgeGetLatency(uint32* Last, uint32* Max);
+#endif
+
+#endif /* DIO_EDGE_H */
@@ -0,0 +1,128 @@
+/**********************************************************
+ * @file    Dio_Inline.h
+ * @brief   Phiên bản inline (header-only) của các API DIO thường dùng
+ * @details Opt-in: file nào include Dio_Inline.h thì các lời gọi
+ *          DIO_WriteChannel, DIO_ReadChannel, DIO_FlipChannel và
+ *          DIO_WritePort được thay bằng hàm static inline. Địa chỉ
+ *          thanh ghi được tính trực tiếp từ ID (không tra bảng), nên
+ *          với tham số là hằng số, -O2 gộp mỗi lời gọi thành đúng một
+ *          lệnh truy cập thanh ghi (FlipChannel: một load + một store).
+ *
+ *          Kiểm tra Det: nếu ID là hằng số, ID sai bị chặn ngay lúc
+ *          biên dịch bằng _Static_assert; nếu không, kiểm tra lúc chạy
+ *          như Dio.c.
+ *
+ *          Muốn gọi bản trong Dio.c ở file đã include header này thì
+ *          đặt tên hàm trong ngoặc: (DIO_WriteChannel)(ch, level).
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_INLINE_H
+#define DIO_INLINE_H
+
+#include "Dio.h"
+#include "Det.h"
+
+/**********************************************************
+ * Kiểm tra lúc biên dịch: chỉ áp dụng khi Value là hằng số,
+ * ngược lại điều kiện luôn đúng và kiểm tra lúc chạy đảm nhận.
+ **********************************************************/
+#define DIO_INLINE_STATIC_CHECK(Value, Limit, Msg) \
+    ((void)sizeof(struct { \
+        _Static_assert(__builtin_choose_expr(__builtin_constant_p(Value), (Value), 0) < (Limit), Msg); \
+        int dummy; }))
+
+/* Địa chỉ cổng GPIO theo Dio_PortType (GPIOA..GPIOD cách nhau 0x400) */
+#define DIO_INLINE_PORT(PortId) \
+    ((GPIO_TypeDef*)(GPIOA_BASE + (uint32_t)(PortId) * 0x400UL))
+
+/**********************************************************
+ * @brief Ghi mức cho một kênh (inline)
+ **********************************************************/
+static inline void Dio_WriteChannelInline(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    if (ChannelId >= DIO_CHANNEL_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_WRITECHANNEL_ID, DIO_E_PARAM_INVALID_CHANNEL);
+        return;
+    }
+#if (DIO_USE_BITBAND == STD_ON)
+    *(volatile uint32*)DIO_BITBAND_ODR(ChannelId) = (Level == STD_HIGH);
+#else
+    uint32 mask = 1UL << (ChannelId % DIO_PINS_PER_PORT);
+    ((GPIO_TypeDef*)DIO_GPIO_BASE(ChannelId))->BSRR = (Level == STD_HIGH) ? mask : (mask << 16);
+#endif
+}
+
+/**********************************************************
+ * @brief Đọc mức của một kênh (inline)
+ **********************************************************/
+static inline Dio_LevelType Dio_ReadChannelInline(Dio_ChannelType ChannelId)
+{
+    if (ChannelId >= DIO_CHANNEL_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_READCHANNEL_ID, DIO_E_PARAM_INVALID_CHANNEL);
+        return STD_LOW;
+    }
+#if (DIO_USE_BITBAND == STD_ON)
+    return (Dio_LevelType)*(volatile uint32*)DIO_BITBAND_IDR(ChannelId);
+#else
+    return (Dio_LevelType)((((GPIO_TypeDef*)DIO_GPIO_BASE(ChannelId))->IDR
+                            >> (ChannelId % DIO_PINS_PER_PORT)) & 1UL);
+#endif
+}
+
+/**********************************************************
+ * @brief Đảo mức của một kênh output (inline)
+ * @return Mức mới của kênh
+ **********************************************************/
+static inline Dio_LevelType Dio_FlipChannelInline(Dio_ChannelType ChannelId)
+{
+    GPIO_TypeDef* port;
+    uint32 mask;
+
+    if (ChannelId >= DIO_CHANNEL_COUNT) {
+        return STD_LOW;
+    }
+    port = (GPIO_TypeDef*)DIO_GPIO_BASE(ChannelId);
+    mask = 1UL << (ChannelId % DIO_PINS_PER_PORT);
+    if ((port->ODR & mask) != 0) {
+        port->BSRR = mask << 16;
+        return STD_LOW;
+    }
+    port->BSRR = mask;
+    return STD_HIGH;
+}
+
+/**********************************************************
+ * @brief Ghi mức cho cả cổng (inline)
+ **********************************************************/
+static inline void Dio_WritePortInline(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+    if (PortId >= DIO_PORT_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_WRITEPORT_ID, DIO_E_PARAM_INVALID_PORT);
+        return;
+    }
+    DIO_INLINE_PORT(PortId)->ODR = Level;
+}
+
+/**********************************************************
+ * Chuyển hướng API sang bản inline, kèm kiểm tra lúc biên dịch
+ **********************************************************/
+#define DIO_WriteChannel(ChannelId, Level) \
+    (DIO_INLINE_STATIC_CHECK((ChannelId), DIO_CHANNEL_COUNT, "DIO: invalid channel"), \
+     Dio_WriteChannelInline((ChannelId), (Level)))
+
+#define DIO_ReadChannel(ChannelId) \
+    (DIO_INLINE_STATIC_CHECK((ChannelId), DIO_CHANNEL_COUNT, "DIO: invalid channel"), \
+     Dio_ReadChannelInline(ChannelId))
+
+#define DIO_FlipChannel(ChannelId) \
+    (DIO_INLINE_STATIC_CHECK((ChannelId), DIO_CHANNEL_COUNT, "DIO: invalid channel"), \
+     Dio_FlipChannelInline(ChannelId))
+
+#define DIO_WritePort(PortId, Level) \
+    (DIO_INLINE_STATIC_CHECK((PortId), DIO_PORT_COUNT, "DIO: invalid port"), \
+     Dio_WritePortInline((PortId), (Level)))
+
+#endif /* DIO_INLINE_H */
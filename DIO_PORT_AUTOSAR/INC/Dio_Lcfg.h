@@ -0,0 +1,41 @@
+/**********************************************************
+ * @file    Dio_Lcfg.h
+ * @brief   DIO Driver Configuration Header File
+ * @details File sinh bởi TOOLS/mcal_gen.py từ TOOLS/mcal_config.json,
+ *          không sửa tay: sửa file JSON rồi chạy make config.
+ *          Tên kênh theo chức năng cho các chân DIO có "name", số cổng
+ *          chống dội và khai báo các bảng cấu hình của ứng dụng.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_LCFG_H
+#define DIO_LCFG_H
+
+#include "Dio.h"
+#include "Dio_Bus.h"
+#include "Dio_Debounce.h"
+#include "Dio_Edge.h"
+
+#define DioConf_DioChannel_LedExt   DIO_CHANNEL_A0
+#define DioConf_DioChannel_Relay    DIO_CHANNEL_B0
+#define DioConf_DioChannel_LedBoard DIO_CHANNEL_C13
+
+/* Số phần tử của Dio_DebounceConfig (mỗi cổng tối đa một) */
+#define DIO_DEBOUNCE_PORT_COUNT 2U
+
+/* Nhóm kênh ảo (Dio_ReadVirtualGroup/Dio_WriteVirtualGroup) */
+extern const Dio_VirtualGroupType Dio_Bus12Group;  /* 12 bit, cổng A/B */
+
+/* Bus song song 8 bit (Dio_BusWrite/Dio_BusRead) */
+extern const Dio_BusType Dio_LcdBus;    /* 8080, WR = PC8, RD = PC9 */
+extern const Dio_BusType Dio_LatchBus;  /* 6800, E = PA4, R/W = PA5 */
+
+/* Bảng dispatch EXTI cho Dio_EdgeInit */
+extern const Dio_EdgeConfigType DioEdgeConfig;
+
+/* Callback báo cạnh (ngữ cảnh ngắt EXTI), hiện thực ở Dio_Cbk.c */
+void Dio_Button_Notification(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+#endif /* DIO_LCFG_H */
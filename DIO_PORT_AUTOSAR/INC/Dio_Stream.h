@@ -0,0 +1,88 @@
+/**********************************************************
+ * @file    Dio_Stream.h
+ * @brief   Phát dạng sóng GPIO bằng DMA, nhịp do timer quyết định
+ * @details Mỗi update event của timer yêu cầu DMA1 chép một word
+ *          BSRR từ buffer (RAM/flash) vào GPIOx->BSRR. CPU chỉ tham
+ *          gia khi bắt đầu/dừng và khi có callback nửa/cả buffer.
+ *
+ *          Mỗi word trong buffer là giá trị BSRR đầy đủ: 16 bit thấp
+ *          set chân, 16 bit cao reset chân; chân không có trong word
+ *          giữ nguyên mức, nên các chân khác của cổng vẫn dùng Dio
+ *          bình thường được.
+ *
+ *          Ánh xạ timer -> kênh DMA1 (RM0008, bảng 78):
+ *          TIM1_UP -> Ch5, TIM2_UP -> Ch2, TIM3_UP -> Ch3, TIM4_UP -> Ch7.
+ *          Timer đang chạy stream không dùng được cho Pwm cùng lúc.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef DIO_STREAM_H
+#define DIO_STREAM_H
+
+#include "Dio.h"
+
+/**********************************************************
+ * @typedef Dio_StreamModeType
+ * @brief   Chế độ phát buffer
+ **********************************************************/
+typedef enum {
+    DIO_STREAM_ONESHOT = 0,     /**< Phát hết buffer một lần rồi tự dừng */
+    DIO_STREAM_CIRCULAR,        /**< Lặp lại buffer liên tục */
+    DIO_STREAM_DOUBLE_BUFFER    /**< Lặp liên tục, hai nửa buffer thay phiên:
+                                     nửa vừa phát xong được báo để nạp lại */
+} Dio_StreamModeType;
+
+/**********************************************************
+ * @typedef Dio_StreamNotificationType
+ * @brief   Callback khi một phần buffer đã phát xong
+ * @details Gọi trong ngữ cảnh ngắt DMA. Chunk/Length là phần buffer
+ *          vừa phát xong, có thể ghi đè ngay (chế độ double buffer).
+ **********************************************************/
+typedef void (*Dio_StreamNotificationType)(const uint32* Chunk, uint16 Length);
+
+/**********************************************************
+ * @struct  Dio_StreamTimerType
+ * @brief   Timer tạo nhịp và cách phát của một stream
+ * @details Tần số phát = f_TIM / ((prescaler + 1) * (period + 1)).
+ **********************************************************/
+typedef struct {
+    TIM_TypeDef*               TIMx;             /**< TIM1..TIM4 */
+    uint16                     prescaler;        /**< PSC */
+    uint16                     period;           /**< ARR */
+    Dio_StreamModeType         mode;             /**< Chế độ phát */
+    Dio_StreamNotificationType HalfCallback;     /**< Nửa đầu phát xong (NULL: tắt) */
+    Dio_StreamNotificationType CompleteCallback; /**< Nửa sau/cả buffer phát xong (NULL: tắt) */
+} Dio_StreamTimerType;
+
+/**********************************************************
+ * @brief   Bắt đầu phát buffer BSRR ra một cổng
+ * @details Nếu timer đang chạy stream khác, stream đó bị dừng trước.
+ *          Buffer phải còn tồn tại đến khi stream dừng. Chế độ double
+ *          buffer yêu cầu Length chẵn. Timer được Clk_Claim cho
+ *          Dio_Stream đến Dio_StreamStop (kể cả oneshot đã tự dừng).
+ * @param[in] PortId  Cổng đích (DIO_PORT_x)
+ * @param[in] Buffer  Mảng giá trị BSRR
+ * @param[in] Length  Số word trong buffer (1..65535)
+ * @param[in] Timer   Timer và chế độ phát (phải tồn tại suốt stream)
+ * @return  E_OK nếu đã bắt đầu, E_NOT_OK nếu tham số sai hoặc timer
+ *          đang thuộc Pwm/Dio_Capture
+ **********************************************************/
+Std_ReturnType Dio_StreamStart(Dio_PortType PortId, const uint32* Buffer, uint16 Length,
+                               const Dio_StreamTimerType* Timer);
+
+/**********************************************************
+ * @brief   Dừng stream đang chạy trên timer
+ * @details Chân giữ mức của word cuối cùng đã phát.
+ *          Trả clock DMA1 và timer cho Clk (timer không còn driver
+ *          nào giữ sẽ bị tắt clock) và nhả quyền dùng timer.
+ **********************************************************/
+void Dio_StreamStop(TIM_TypeDef* TIMx);
+
+/**********************************************************
+ * @brief   Kiểm tra timer có đang chạy stream không
+ **********************************************************/
+boolean Dio_StreamIsBusy(TIM_TypeDef* TIMx);
+
+#endif /* DIO_STREAM_H */
@@ -24,12 +24,32 @@
 #define PORT_ID_C   2   /* GPIOC */
 #define PORT_ID_D   3   /* GPIOD */
 
+#define PORT_COUNT  4U  /* Số cổng Port quản lý (A..D) */
+
+/* Số dòng config tối đa Port_Init chép vào bảng trạng thái RAM */
+#ifndef PORT_MAX_PINS
+#define PORT_MAX_PINS   (PORT_COUNT * 16U)
+#endif
+
 /**********************************************************
  *  * Định nghĩa tần số hoạt động của chân GPIO 
  **********************************************************/
 #define PORT_SPEED_2Mhz     0 
 #define PORT_SPEED_10Mhz    1  
 #define PORT_SPEED_50Mhz    2   
+
+/**********************************************************
+ * Bit CNF[1:0] trong nibble CRL/CRH của một pin (MODE[1:0] = tốc độ
+ * với output, 0 với input)
+ **********************************************************/
+#define PORT_CNF_IN_ANALOG      0x0U
+#define PORT_CNF_IN_FLOATING    0x4U
+#define PORT_CNF_IN_PULL        0x8U    /* Hướng pull chọn bằng ODR */
+#define PORT_CNF_OUT_PP         0x0U
+#define PORT_CNF_OUT_OD         0x4U
+#define PORT_CNF_AF_PP          0x8U
+#define PORT_CNF_AF_OD          0xCU
+
 /**********************************************************
  * Macro xác định con trỏ PORT theo PortNum
  **********************************************************/
@@ -54,6 +74,8 @@
 #define PORT_PIN_MODE_SPI       3
 #define PORT_PIN_MODE_CAN       4
 #define PORT_PIN_MODE_LIN       5
+#define PORT_PIN_MODE_AF_OD     6       /* AF open-drain (I2C, bus wired-AND) */
+#define PORT_PIN_MODE_COUNT     7U
 
 #define PORT_PIN_PULL_NONE      0
 #define PORT_PIN_PULL_UP        1
@@ -63,6 +85,93 @@
 #define PORT_PIN_LEVEL_HIGH     1
 
 #define PORT_PIN_MODE_AF_PP     1
+
+/**********************************************************
+ * Remap AFIO: OR các giá trị vào Port_ConfigType::Remap, mỗi ngoại vi
+ * một giá trị. Port_Init ghi cả thanh ghi AFIO_MAPR một lần.
+ **********************************************************/
+#define PORT_REMAP_NONE             0x00000000UL
+#define PORT_REMAP_SPI1             AFIO_MAPR_SPI1_REMAP
+#define PORT_REMAP_I2C1             AFIO_MAPR_I2C1_REMAP
+#define PORT_REMAP_USART1           AFIO_MAPR_USART1_REMAP
+#define PORT_REMAP_USART2           AFIO_MAPR_USART2_REMAP
+#define PORT_REMAP_USART3_PARTIAL   AFIO_MAPR_USART3_REMAP_PARTIALREMAP
+#define PORT_REMAP_USART3_FULL      AFIO_MAPR_USART3_REMAP_FULLREMAP
+#define PORT_REMAP_TIM1_PARTIAL     AFIO_MAPR_TIM1_REMAP_PARTIALREMAP
+#define PORT_REMAP_TIM1_FULL        AFIO_MAPR_TIM1_REMAP_FULLREMAP
+#define PORT_REMAP_TIM2_PARTIAL1    AFIO_MAPR_TIM2_REMAP_PARTIALREMAP1
+#define PORT_REMAP_TIM2_PARTIAL2    AFIO_MAPR_TIM2_REMAP_PARTIALREMAP2
+#define PORT_REMAP_TIM2_FULL        AFIO_MAPR_TIM2_REMAP_FULLREMAP
+#define PORT_REMAP_TIM3_PARTIAL     AFIO_MAPR_TIM3_REMAP_PARTIALREMAP
+#define PORT_REMAP_TIM3_FULL        AFIO_MAPR_TIM3_REMAP_FULLREMAP
+#define PORT_REMAP_TIM4             AFIO_MAPR_TIM4_REMAP
+#define PORT_REMAP_CAN_PB8_PB9      AFIO_MAPR_CAN_REMAP_REMAP2
+#define PORT_REMAP_CAN_PD0_PD1      AFIO_MAPR_CAN_REMAP_REMAP3
+#define PORT_REMAP_PD01             AFIO_MAPR_PD01_REMAP
+#define PORT_REMAP_MASK             0x001FFFFFUL    /* Các trường remap, không gồm SWJ_CFG */
+
+/**********************************************************
+ * SWJ_CFG (trường chỉ ghi của AFIO_MAPR): nhả chân debug làm GPIO
+ **********************************************************/
+#define PORT_SWJ_FULL           0U  /* Reset: JTAG + SWD */
+#define PORT_SWJ_NOJNTRST       1U  /* Nhả PB4 */
+#define PORT_SWJ_SWD            2U  /* Chỉ SWD: nhả PA15, PB3, PB4 */
+#define PORT_SWJ_DISABLED       4U  /* Nhả cả PA13, PA14 */
+
+/**********************************************************
+ * Profile cấu hình chân (Port_SetProfile). Chỉ cổng có trong config
+ * bị đổi; pin không có trong config thành analog ở SLEEP/SAFE.
+ **********************************************************/
+#define PORT_PROFILE_ACTIVE     0U  /* Cấu hình Port_Init (kể cả thay đổi runtime) */
+#define PORT_PROFILE_SLEEP      1U  /* Trước STOP: pin không SleepKeep -> analog */
+#define PORT_PROFILE_SAFE       2U  /* Trạng thái an toàn theo SafeState */
+#define PORT_PROFILE_COUNT      3U
+
+#define PORT_SAFE_ANALOG        0   /* Analog input: hi-Z, dòng rò nhỏ nhất */
+#define PORT_SAFE_KEEP          1   /* Giữ cấu hình active */
+#define PORT_SAFE_LOW           2   /* Output push-pull 2MHz, mức thấp */
+#define PORT_SAFE_HIGH          3   /* Output push-pull 2MHz, mức cao */
+
+
+/**********************************************************
+ * Phát hiện lỗi phát triển (Det)
+ * - STD_ON : API runtime kiểm tra init/tham số và báo Det
+ * - STD_OFF: bỏ các kiểm tra đó khỏi bản release; pin không cho đổi
+ *            chiều/mode vẫn bị giữ nguyên
+ **********************************************************/
+#ifndef PORT_DEV_ERROR_DETECT
+#define PORT_DEV_ERROR_DETECT   STD_ON
+#endif
+
+/* Service ID và mã lỗi Det (AUTOSAR SWS Port) */
+#define PORT_SETPINDIRECTION_ID         0x01U
+#define PORT_REFRESHPORTDIRECTION_ID    0x02U
+#define PORT_SETPINMODE_ID              0x04U
+
+#define PORT_E_PARAM_PIN                0x0AU
+#define PORT_E_DIRECTION_UNCHANGEABLE   0x0BU
+#define PORT_E_PARAM_INVALID_MODE       0x0DU
+#define PORT_E_MODE_UNCHANGEABLE        0x0EU
+#define PORT_E_UNINIT                   0x0FU
+
+/**********************************************************
+ * Kiểm tra bảng config lúc biên dịch: PORT_CFG_xxx(v) có giá trị v
+ * (hằng số), v ngoài miền làm dừng biên dịch. Dùng trong config sinh
+ * bởi TOOLS/mcal_gen.py; Port_Init vẫn chuẩn hóa config viết tay.
+ **********************************************************/
+#define PORT_CFG_CHECK(Value, Cond, Msg) \
+    ((Value) + 0U * sizeof(struct { _Static_assert(Cond, Msg); int dummy; }))
+
+#define PORT_CFG_PORT(p)    PORT_CFG_CHECK(p, (p) < PORT_COUNT, "PortNum must be PORT_ID_A..PORT_ID_D")
+#define PORT_CFG_PIN(n)     PORT_CFG_CHECK(n, (n) <= 15, "PinNum must be 0..15")
+#define PORT_CFG_MODE(m)    PORT_CFG_CHECK(m, (m) < PORT_PIN_MODE_COUNT, "Mode must be a PORT_PIN_MODE_xxx")
+#define PORT_CFG_SPEED(s)   PORT_CFG_CHECK(s, (s) <= PORT_SPEED_50Mhz, "Speed must be a PORT_SPEED_xxx")
+#define PORT_CFG_PULL(p)    PORT_CFG_CHECK(p, (p) <= PORT_PIN_PULL_DOWN, "Pull must be a PORT_PIN_PULL_xxx")
+#define PORT_CFG_SAFE(s)    PORT_CFG_CHECK(s, (s) <= PORT_SAFE_HIGH, "SafeState must be a PORT_SAFE_xxx")
+
+/* Số phần tử của một mảng config (chỉ dùng trong file định nghĩa mảng) */
+#define PORT_ARRAY_SIZE(a)  (sizeof(a) / sizeof((a)[0]))
+
 /**********************************************************
  * Định nghĩa kiểu dữ liệu của Port Driver AUTOSAR
  **********************************************************/
@@ -88,6 +197,12 @@ typedef enum {
  */
 typedef uint8_t Port_PinModeType;
 
+/**
+ * @typedef Port_ProfileType
+ * @brief   Định danh profile cấu hình chân (PORT_PROFILE_xxx)
+ */
+typedef uint8_t Port_ProfileType;
+
 /**
  * @struct Port_PinConfigType
  * @brief  Cấu hình cho từng chân pin (phần mềm sẽ sinh theo tool/hoặc config tay)
@@ -102,8 +217,50 @@ typedef struct {
     uint8_t  Pull;               /**< Kiểu pull: none, up, down */
     uint8_t  ModeChangeable;     /**< 1=cho phép đổi mode runtime */
     uint8_t Speed;
+    uint8_t  SleepKeep;          /**< 1=giữ cấu hình active ở PORT_PROFILE_SLEEP (chân đánh thức, output giữ mức) */
+    uint8_t  SafeState;          /**< PORT_SAFE_xxx: trạng thái ở PORT_PROFILE_SAFE */
 } Port_PinConfigType;
 
+/**
+ * @struct Port_ProfileImageType
+ * @brief  Ảnh CRL/CRH/ODR của một cổng ở một profile khác ACTIVE
+ * @details
+ * - CrlKeep/CrhKeep: nibble giữ giá trị active (đọc lúc rời ACTIVE)
+ * - Crl/Crh:         nibble còn lại, 0 = analog input
+ * - Bsrr:            mức ra của pin bị lái trong profile
+ */
+typedef struct {
+    uint32_t CrlKeep;
+    uint32_t CrhKeep;
+    uint32_t Crl;
+    uint32_t Crh;
+    uint32_t Bsrr;
+} Port_ProfileImageType;
+
+/**
+ * @struct Port_ImageType
+ * @brief  Ảnh thanh ghi của một cổng, dựng từ bảng config
+ * @details
+ * - Crl/Crh:           nibble CNF/MODE của các pin đã cấu hình
+ * - CrlMask/CrhMask:   nibble nào thuộc cấu hình (pin khác giữ nguyên)
+ * - CrlCheck/CrhCheck: nibble của pin không cho đổi chiều, được
+ *                      Port_RefreshPortDirection so và sửa
+ * - Bsrr:              mức ODR ban đầu (nửa thấp set, nửa cao reset)
+ * - Pins:              mask pin đã cấu hình, 0 = cổng không dùng
+ * - Profiles:          ảnh PORT_PROFILE_SLEEP, PORT_PROFILE_SAFE
+ */
+typedef struct {
+    uint32_t Crl;
+    uint32_t CrlMask;
+    uint32_t CrlCheck;
+    uint32_t Crh;
+    uint32_t CrhMask;
+    uint32_t CrhCheck;
+    uint32_t Bsrr;
+    uint16_t Pins;
+    Port_ProfileImageType Profiles[PORT_PROFILE_COUNT - 1U];
+} Port_ImageType;
+
 /**
  * @struct Port_ConfigType
  * @brief  Cấu trúc tổng hợp cấu hình tất cả các pin (gán khi init)
@@ -111,6 +268,9 @@ typedef struct {
 typedef struct {
     const Port_PinConfigType* PinConfigs; /**< Con trỏ tới mảng cấu hình pin */
     uint16_t PinCount;                      /**< Số lượng chân cấu hình */
+    const Port_ImageType* Images;           /**< PORT_COUNT ảnh sinh sẵn (TOOLS/mcal_gen.py), NULL: Port_Init tự dựng */
+    uint32_t Remap;                         /**< PORT_REMAP_xxx OR lại, 0 = không remap */
+    uint8_t  SwjCfg;                        /**< PORT_SWJ_xxx */
 } Port_ConfigType;
 
 /**********************************************************
@@ -134,16 +294,46 @@ void Port_Init(const Port_ConfigType* ConfigPtr);
 
 /**
  * @brief   Đổi chiều một chân Port (nếu được phép)
- * @param[in] Pin        Số hiệu pin
+ * @param[in] Pin        Số hiệu pin (chỉ số trong bảng config của Port_Init)
  * @param[in] Direction  Chiều cần đặt
  */
 void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
 
 /**
  * @brief   Làm tươi lại chiều tất cả các pin không cho đổi chiều runtime
+ * @details Chỉ sửa nibble CRL/CRH bị lệch so với ảnh cấu hình; pin đã
+ *          khóa bằng Port_LockConfig bị bỏ qua.
  */
 void Port_RefreshPortDirection(void);
 
+/**
+ * @brief   Khóa LCKR các pin không cho đổi chiều lẫn mode (gọi sau Port_Init)
+ * @details Khóa giữ đến khi reset; refresh bỏ qua pin đã khóa.
+ *          Chỉ chạy ở PORT_PROFILE_ACTIVE.
+ * @return  E_OK hoặc E_NOT_OK
+ */
+Std_ReturnType Port_LockConfig(void);
+
+/**
+ * @brief   Chuyển tất cả cổng có trong config sang một profile chân
+ * @details Vài lệnh ghi mỗi cổng; về PORT_PROFILE_ACTIVE khôi phục đúng
+ *          CRL/CRH/ODR lúc rời ACTIVE.
+ * @param[in] Profile  PORT_PROFILE_xxx
+ * @return  E_OK hoặc E_NOT_OK
+ */
+Std_ReturnType Port_SetProfile(Port_ProfileType Profile);
+
+/**
+ * @brief   Profile chân hiện tại (PORT_PROFILE_xxx)
+ */
+Port_ProfileType Port_GetProfile(void);
+
+/**
+ * @brief   Số nibble CRL/CRH refresh đã phải sửa trên một cổng (chẩn đoán)
+ * @param[in] PortNum  Cổng (PORT_ID_A..PORT_ID_D)
+ */
+uint32_t Port_GetDriftCount(uint8_t PortNum);
+
 /**
  * @brief   Lấy thông tin version của Port Driver
  * @param[out] versioninfo  Con trỏ tới cấu trúc Std_VersionInfoType để nhận version
@@ -1,12 +1,11 @@
 /**********************************************************
- * @file    Port_cfg.h
+ * @file    Portconfig.h
  * @brief   Port Driver Configuration Header File
- * @details File này chứa các định nghĩa cấu hình các chân Port 
- *          cho driver Port theo chuẩn AUTOSAR, dùng trên 
- *          STM32F103 với thư viện SPL.
- *
+ * @details File sinh bởi TOOLS/mcal_gen.py từ TOOLS/mcal_config.json,
+ *          không sửa tay: sửa file JSON rồi chạy make config.
+ *          Bảng pin và ảnh thanh ghi từng cổng cho Port_Init.
  * @version 1.0
- * @date    2024-06-19
+ * @date    2026-10-18
  * @author  HALA Academy
  **********************************************************/
 
@@ -15,15 +14,13 @@
 
 #include "Port.h"   /* Bao gồm các kiểu dữ liệu chuẩn của Port Driver */
 
-/**********************************************************
- * Số lượng chân Port được cấu hình (tùy chỉnh theo dự án)
- **********************************************************/
+/* Số lượng chân Port được cấu hình */
 #define PortCfg_PinsCount    6U
 
-/**********************************************************
- * Mảng cấu hình chi tiết cho từng chân GPIO
- * (khai báo extern, định nghĩa cụ thể ở port_cfg.c)
- **********************************************************/
-extern const Port_PinConfigType PortCfg_Pins[PortCfg_PinsCount];
+extern const Port_PinConfigType PortCfg_Pins[];
+extern const Port_ImageType PortCfg_Images[PORT_COUNT];
+
+/* Cấu hình tổng truyền cho Port_Init (kèm ảnh sinh sẵn) */
+extern const Port_ConfigType PortCfg_Config;
 
 #endif /* PORT_CFG_H */
@@ -16,6 +16,55 @@
 #include "Std_Types.h"          /* Các kiểu dữ liệu chuẩn AUTOSAR */
 #include "stm32f10x_tim.h"      /* Thư viện SPL: Timer PWM cho STM32F103 */
 
+/**********************************************************
+ * Phát hiện lỗi phát triển (Det)
+ * - STD_ON : API runtime kiểm tra init/số kênh và báo Det
+ * - STD_OFF: bỏ các kiểm tra đó khỏi bản release; kênh chu kỳ cố
+ *            định vẫn không đổi được period
+ **********************************************************/
+#ifndef PWM_DEV_ERROR_DETECT
+#define PWM_DEV_ERROR_DETECT    STD_ON
+#endif
+
+#define PWM_MODULE_ID           121U
+
+/* Service ID và mã lỗi Det (AUTOSAR SWS Pwm) */
+#define PWM_INIT_ID                 0x00U
+#define PWM_SETDUTYCYCLE_ID         0x02U
+#define PWM_SETPERIODANDDUTY_ID     0x03U
+#define PWM_SETOUTPUTTOIDLE_ID      0x04U
+#define PWM_GETOUTPUTSTATE_ID       0x05U
+#define PWM_DISABLENOTIFICATION_ID  0x06U
+#define PWM_ENABLENOTIFICATION_ID   0x07U
+
+#define PWM_E_INIT_FAILED           0x10U   /* Config sai: TIMx không phải TIM1..TIM4 */
+#define PWM_E_UNINIT                0x11U
+#define PWM_E_PARAM_CHANNEL         0x12U
+#define PWM_E_PERIOD_UNCHANGEABLE   0x13U
+#define PWM_E_TIMER_IN_USE          0x14U   /* Timer đang thuộc Dio_Stream/Dio_Capture */
+
+/**********************************************************
+ * Kiểm tra bảng config lúc biên dịch (Pwm_Lcfg.c sinh bởi
+ * TOOLS/mcal_gen.py): PWM_CFG_xxx có giá trị hằng số, tham số ngoài
+ * miền làm dừng biên dịch.
+ * - PWM_CFG_CH(n, c):     .TIMx = TIMn, .channel = c, .ccr = &TIMn->CCRc
+ *                         từ cùng một cặp số, ba trường không thể lệch
+ *                         nhau; chỉ TIM1..TIM4, channel 1..4
+ * - PWM_CFG_COUNT(a):     số kênh lấy từ kích thước mảng
+ **********************************************************/
+#define PWM_CFG_CHECK(Value, Cond, Msg) \
+    ((Value) + 0U * sizeof(struct { _Static_assert(Cond, Msg); int dummy; }))
+
+#define PWM_CFG_TIMER(n) \
+    ((TIM_TypeDef*)PWM_CFG_CHECK(TIM##n##_BASE, (n) >= 1 && (n) <= 4, "PWM timer must be TIM1..TIM4"))
+#define PWM_CFG_CHANNEL(c)  PWM_CFG_CHECK(c, (c) >= 1 && (c) <= 4, "PWM channel must be 1..4")
+#define PWM_CFG_CCR(n, c)   (&PWM_CFG_TIMER(n)->CCR##c)
+#define PWM_CFG_CH(n, c) \
+    .TIMx = PWM_CFG_TIMER(n), .channel = PWM_CFG_CHANNEL(c), .ccr = PWM_CFG_CCR(n, c)
+#define PWM_CFG_DUTY(d)     PWM_CFG_CHECK(d, (d) <= 0x8000, "duty cycle must be 0x0000..0x8000")
+#define PWM_CFG_COUNT(a) \
+    PWM_CFG_CHECK(sizeof(a) / sizeof((a)[0]), sizeof(a) / sizeof((a)[0]) <= 255U, "too many PWM channels")
+
 
 /**********************************************************
  * Định nghĩa các kiểu dữ liệu của PWM Driver
@@ -70,6 +119,7 @@ typedef enum {
 typedef struct {
     TIM_TypeDef*              TIMx;             /**< Timer sử dụng (TIM1, TIM2, ...) */
     uint8                     channel;          /**< Channel số (1, 2, 3, 4) */
+    volatile uint16_t*        ccr;              /**< &TIMx->CCRn của channel (sinh sẵn bởi TOOLS/mcal_gen.py) */
     uint16                    prescaler;
     Pwm_ChannelClassType      classType;        /**< Loại kênh */
     Pwm_PeriodType            defaultPeriod;    /**< Chu kỳ mặc định */
@@ -1,16 +1,26 @@
 /**********************************************************
  * @file    Pwm_Lcfg.h
  * @brief   PWM Driver Configuration Header File (AUTOSAR)
- * @details Khai báo extern biến cấu hình tổng của PWM Driver cho STM32F103.
+ * @details File sinh bởi TOOLS/mcal_gen.py từ TOOLS/mcal_config.json,
+ *          không sửa tay: sửa file JSON rồi chạy make config.
+ *          Khai báo cấu hình tổng, tên kênh và callback của PWM Driver.
  * @version 1.0
- * @date    2024-06-27
+ * @date    2026-10-18
  * @author  HALA Academy
  **********************************************************/
+
 #ifndef PWM_LCFG_H
 #define PWM_LCFG_H
 
 #include "Pwm.h"
 
+/* Chỉ số kênh cho Pwm_SetDutyCycle... */
+#define PwmConf_PwmChannel_Dimmer 0U  /* TIM2_CH2, PA1 */
+#define PwmConf_PwmChannel_Fan    1U  /* TIM3_CH2, PA7 */
+
+/* Callback notification, hiện thực ở Pwm_Cbk.c */
+void Pwm_Channel0_Notification(void);
+
 /**********************************************************
  * @brief   Biến cấu hình tổng cho PWM Driver
  **********************************************************/
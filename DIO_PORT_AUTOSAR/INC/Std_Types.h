@@ -43,6 +43,10 @@ typedef uint8_t Std_ReturnType;
 *************************************************************/
 #define STD_HIGH 0x01U // trạng thái logic cao
 #define STD_LOW  0x00U // trạng thái logic cao
+
+/* Công tắc bật/tắt tính năng trong file cấu hình */
+#define STD_ON      0x01U
+#define STD_OFF     0x00U
 /* Null Pointer Definition */
 #define NULL_PTR    ((void*)0)
 
@@ -0,0 +1,101 @@
+/**********************************************************
+ * @file    Tm.h
+ * @brief   Đo thời gian và chờ bận dùng chung (DWT CYCCNT + SysTick)
+ * @details Thay cho vòng __NOP() (phụ thuộc mức -O và SYSCLK) và cho
+ *          việc poll một timer riêng: mọi khoảng thời gian được tính
+ *          bằng chu kỳ lõi đọc từ DWT->CYCCNT, đổi sang µs theo
+ *          SystemCoreClock.
+ *          - Chờ ngắn: Tm_BusyWaitCycles / Tm_WaitUntil (inline), sai
+ *            số bằng một vòng poll (vài chu kỳ), không trôi theo -O.
+ *          - Mốc thời gian: CYCCNT 32 bit tràn sau ~59 s ở 72 MHz;
+ *            SysTick_Handler (TM_SYSTICK_HZ lần/giây) đếm số lần tràn
+ *            để tạo trục thời gian 64 bit đơn điệu.
+ *          Tm_Init gọi một lần sau SystemInit (và gọi lại sau mỗi lần
+ *          đổi SystemCoreClock). Driver cần CYCCNT trước Tm_Init dùng
+ *          Tm_StartCycleCounter.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#ifndef TM_H
+#define TM_H
+
+#include "stm32f10x.h"
+#include "Std_Types.h"
+
+/* Tần số ngắt SysTick: chu kỳ phải ngắn hơn thời gian tràn CYCCNT */
+#define TM_SYSTICK_HZ           100U
+
+/* Số chu kỳ lõi trong 1 µs */
+#define TM_CYCLES_PER_US()      (SystemCoreClock / 1000000UL)
+
+/**********************************************************
+ * @brief   Bật DWT CYCCNT (TRCENA + CYCCNTENA), không đụng SysTick
+ **********************************************************/
+void Tm_StartCycleCounter(void);
+
+/**********************************************************
+ * @brief   Bật CYCCNT, cấu hình SysTick TM_SYSTICK_HZ và xóa trục 64 bit
+ **********************************************************/
+void Tm_Init(void);
+
+/**********************************************************
+ * @brief   Số chu kỳ lõi hiện tại (32 bit, tràn vòng)
+ **********************************************************/
+static inline uint32 Tm_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**********************************************************
+ * @brief   Đổi µs sang chu kỳ lõi theo SystemCoreClock hiện tại
+ **********************************************************/
+static inline uint32 Tm_UsToCycles(uint32 Us)
+{
+    return TM_CYCLES_PER_US() * Us;
+}
+
+/**********************************************************
+ * @brief   Chờ đến mốc tuyệt đối Deadline của CYCCNT
+ * @details So sánh có dấu nên đúng cả khi CYCCNT tràn, với điều kiện
+ *          mốc nằm trong vòng 2^31 chu kỳ (~29 s ở 72 MHz).
+ **********************************************************/
+static inline void Tm_WaitUntil(uint32 Deadline)
+{
+    while ((sint32)(DWT->CYCCNT - Deadline) < 0) {
+    }
+}
+
+/**********************************************************
+ * @brief   Chờ bận đúng Cycles chu kỳ lõi (tối đa 2^31)
+ **********************************************************/
+static inline void Tm_BusyWaitCycles(uint32 Cycles)
+{
+    Tm_WaitUntil(DWT->CYCCNT + Cycles);
+}
+
+/**********************************************************
+ * @brief   Chờ bận Us micro giây, không giới hạn độ dài
+ * @details Khoảng chờ dài được chia thành các đoạn ngắn hơn nửa vòng
+ *          CYCCNT; mỗi đoạn nối tiếp mốc của đoạn trước nên không trôi.
+ **********************************************************/
+void Tm_BusyWaitUs(uint32 Us);
+
+/**********************************************************
+ * @brief   Trục thời gian 64 bit tính bằng chu kỳ lõi
+ **********************************************************/
+uint64_t Tm_GetCycles64(void);
+
+/**********************************************************
+ * @brief   Thời gian từ Tm_Init, đơn vị µs (64 bit, không tràn)
+ **********************************************************/
+uint64_t Tm_GetTimeUs64(void);
+
+/**********************************************************
+ * @brief   Mốc thời gian µs 32 bit (tràn sau ~71 phút)
+ * @details Hiệu hai mốc (phép trừ không dấu) đúng qua điểm tràn.
+ **********************************************************/
+uint32 Tm_GetTimestampUs(void);
+
+#endif /* TM_H */
@@ -0,0 +1,107 @@
+/**********************************************************
+ * @file    Clk.c
+ * @brief   Dịch vụ bật/tắt clock ngoại vi dùng chung (RCC AHB/APB1/APB2)
+ * @details Clk_Wanted là tập bit có bộ đếm > 0, Clk_Applied là tập đã
+ *          đưa ra thanh ghi ở lần Clk_Apply trước: hai tập bằng nhau
+ *          thì không cần đụng RCC. Clk_Owned là các bit do Clk bật.
+ *          Clk_Owner ghi driver đang giữ độc quyền từng ngoại vi.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Clk.h"
+#include "stm32f10x.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+#define CLK_BUS(Periph)     ((Periph) >> 5)
+#define CLK_BIT(Periph)     ((Periph) & 0x1FU)
+
+static volatile uint32* const Clk_EnableReg[CLK_BUS_COUNT] = {
+    &RCC->AHBENR, &RCC->APB1ENR, &RCC->APB2ENR
+};
+
+static uint8  Clk_RefCount[CLK_BUS_COUNT][32];
+static uint32 Clk_Wanted[CLK_BUS_COUNT];
+static uint32 Clk_Applied[CLK_BUS_COUNT];
+static uint32 Clk_Owned[CLK_BUS_COUNT];
+static Clk_OwnerType Clk_Owner[CLK_BUS_COUNT][32];
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Clk_Request(Clk_PeripheralType Periph)
+{
+    uint8 bus = CLK_BUS(Periph);
+    uint8 bit = CLK_BIT(Periph);
+
+    if (bus >= CLK_BUS_COUNT || Clk_RefCount[bus][bit] == 0xFFU) return;
+    if (Clk_RefCount[bus][bit]++ == 0U) {
+        Clk_Wanted[bus] |= 1UL << bit;
+    }
+}
+
+void Clk_Release(Clk_PeripheralType Periph)
+{
+    uint8 bus = CLK_BUS(Periph);
+    uint8 bit = CLK_BIT(Periph);
+
+    if (bus >= CLK_BUS_COUNT || Clk_RefCount[bus][bit] == 0U) return;
+    if (--Clk_RefCount[bus][bit] == 0U) {
+        Clk_Wanted[bus] &= ~(1UL << bit);
+    }
+}
+
+void Clk_Apply(void)
+{
+    for (uint8 bus = 0; bus < CLK_BUS_COUNT; bus++) {
+        uint32 reg, on, off;
+
+        if (Clk_Wanted[bus] == Clk_Applied[bus]) continue;
+
+        reg = *Clk_EnableReg[bus];
+        on = Clk_Wanted[bus] & ~reg;
+        off = Clk_Owned[bus] & ~Clk_Wanted[bus];
+        if ((on | off) != 0U) {
+            *Clk_EnableReg[bus] = (reg | on) & ~off;
+        }
+        Clk_Owned[bus] = (Clk_Owned[bus] | on) & ~off;
+        Clk_Applied[bus] = Clk_Wanted[bus];
+    }
+}
+
+uint8 Clk_GetRefCount(Clk_PeripheralType Periph)
+{
+    if (CLK_BUS(Periph) >= CLK_BUS_COUNT) return 0;
+    return Clk_RefCount[CLK_BUS(Periph)][CLK_BIT(Periph)];
+}
+
+Std_ReturnType Clk_Claim(Clk_PeripheralType Periph, Clk_OwnerType Owner)
+{
+    uint8 bus = CLK_BUS(Periph);
+    uint8 bit = CLK_BIT(Periph);
+
+    if (bus >= CLK_BUS_COUNT || Owner == CLK_OWNER_NONE) return E_NOT_OK;
+    if (Clk_Owner[bus][bit] != CLK_OWNER_NONE && Clk_Owner[bus][bit] != Owner) return E_NOT_OK;
+    Clk_Owner[bus][bit] = Owner;
+    return E_OK;
+}
+
+void Clk_Unclaim(Clk_PeripheralType Periph, Clk_OwnerType Owner)
+{
+    uint8 bus = CLK_BUS(Periph);
+    uint8 bit = CLK_BIT(Periph);
+
+    if (bus >= CLK_BUS_COUNT || Clk_Owner[bus][bit] != Owner) return;
+    Clk_Owner[bus][bit] = CLK_OWNER_NONE;
+}
+
+Clk_OwnerType Clk_GetOwner(Clk_PeripheralType Periph)
+{
+    if (CLK_BUS(Periph) >= CLK_BUS_COUNT) return CLK_OWNER_NONE;
+    return Clk_Owner[CLK_BUS(Periph)][CLK_BIT(Periph)];
+}
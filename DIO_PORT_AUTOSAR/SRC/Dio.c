@@ -8,9 +8,19 @@
 #include "stm32f10x.h"
 #include "stm32f10x_gpio.h"
 #include "stm32f10x_rcc.h"
-#include "DIO.h"
+#include "Dio.h"
 #include <stddef.h>  // để dùng NULL
 #include "Det.h"
+
+/* Bản đệm BSRR của từng cổng cho Dio_Stage.../Dio_Commit */
+static uint32_t Dio_StagedBsrr[DIO_PORT_COUNT];
+static uint8_t Dio_StagedPorts;    /* Bit n = 1: cổng n có thay đổi chờ commit */
+
+/* Dio_ReadAllPorts/Dio_WriteAllPorts được viết tay cho GPIOA..GPIOD */
+#if (DIO_PORT_COUNT != 4U)
+#error "Dio_ReadAllPorts/Dio_WriteAllPorts: cập nhật lại cho DIO_PORT_COUNT"
+#endif
+
 /***************************************************************************
  * @brief Hàm để ghi mức độ của một kênh DIO.
  * @details Hàm này nhận vào ID của kênh và mức độ cần ghi (STD_HIGH hoặc STD_LOW).
@@ -21,25 +31,28 @@
 
 void DIO_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-    GPIO_TypeDef *GPIO_Port;
-    uint16_t GIPO_Pin;
-
-    GPIO_Port = GPIO_GetPort(ChannelId);
-    if(GPIO_Port == NULL)
+    if(ChannelId >= DIO_CHANNEL_COUNT)
     {
         Det_ReportError(DIO_MODULE_ID, 0, DIO_WRITECHANNEL_ID, DIO_E_PARAM_INVALID_CHANNEL);
         return; // Handle error appropriately
     }
-    GIPO_Pin = GPIO_GetPin(ChannelId);
-    
+
+#if (DIO_USE_BITBAND == STD_ON)
+    /* Một lệnh store vào alias bit ODR */
+    *Dio_ChannelBitBand[ChannelId].odr = (Level == STD_HIGH);
+#else
+    const Dio_ChannelMapType *channel = &Dio_ChannelMap[ChannelId];
+
+    /* BSRR: 16 bit thấp = set, 16 bit cao = reset */
     if(Level == STD_HIGH)
     {
-        GPIO_SetBits(GPIO_Port, GIPO_Pin);
+        channel->port->BSRR = channel->mask;
     }
     else
     {
-        GPIO_ResetBits(GPIO_Port, GIPO_Pin);
+        channel->port->BSRR = (uint32_t)channel->mask << 16;
     }
+#endif
 }
 
 /***************************************************************************
@@ -51,19 +64,19 @@ void DIO_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 
 Dio_LevelType DIO_ReadChannel(Dio_ChannelType ChannelId)
 {
-    GPIO_TypeDef *GPIO_Port;
-    uint16_t GIPO_Pin;
-
-    GPIO_Port = GPIO_GetPort(ChannelId);
-    if(GPIO_Port == NULL)
+    if(ChannelId >= DIO_CHANNEL_COUNT)
     {
         Det_ReportError(DIO_MODULE_ID, 0, DIO_READCHANNEL_ID, DIO_E_PARAM_INVALID_CHANNEL);
         return STD_LOW; // Trả về mặc định khi lỗi
     }
 
-    GIPO_Pin = GPIO_GetPin(ChannelId);
+#if (DIO_USE_BITBAND == STD_ON)
+    /* Một lệnh load từ alias bit IDR, giá trị đã là 0/1 */
+    return (Dio_LevelType)*Dio_ChannelBitBand[ChannelId].idr;
+#else
+    const Dio_ChannelMapType *channel = &Dio_ChannelMap[ChannelId];
 
-    if(GPIO_ReadInputDataBit(GPIO_Port, GIPO_Pin) == Bit_SET)
+    if((channel->port->IDR & channel->mask) != 0)
     {
         return STD_HIGH;
     }
@@ -71,6 +84,7 @@ Dio_LevelType DIO_ReadChannel(Dio_ChannelType ChannelId)
     {
         return STD_LOW;
     }
+#endif
 }
 /***************************************************************************
  * @brief Hàm để đọc mức độ của một cổng DIO.
@@ -81,15 +95,12 @@ Dio_LevelType DIO_ReadChannel(Dio_ChannelType ChannelId)
 
 Dio_PortLevelType DIO_ReadPort(Dio_PortType PortId)
 {
-    GPIO_TypeDef *GPIO_Port;
-
-    GPIO_Port = GPIO_GetPort(PortId);
-    if(GPIO_Port == NULL)
+    if(PortId >= DIO_PORT_COUNT)
     {
         return 0; // Return a default value or handle error appropriately
     }
     
-    return (Dio_PortLevelType)GPIO_ReadInputData(GPIO_Port);
+    return (Dio_PortLevelType)Dio_PortMap[PortId]->IDR;
 }
 /***************************************************************************
  * @brief Hàm để ghi mức độ của một cổng DIO.
@@ -101,16 +112,13 @@ Dio_PortLevelType DIO_ReadPort(Dio_PortType PortId)
 
 void DIO_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 {
-    GPIO_TypeDef *GPIO_Port;
-
-    GPIO_Port = GPIO_GetPort(PortId);
-    if(GPIO_Port == NULL)
+    if(PortId >= DIO_PORT_COUNT)
     {
         Det_ReportError(DIO_MODULE_ID, 0, DIO_WRITEPORT_ID, DIO_E_PARAM_INVALID_PORT);
         return; // Handle error appropriately
     }
     
-    GPIO_Write(GPIO_Port, Level);
+    Dio_PortMap[PortId]->ODR = Level;
 }
 
 /*************************************************************************** 
@@ -131,7 +139,7 @@ Dio_PortLevelType DIO_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
         return 0; // Return a default value or handle error appropriately
     }
 
-    GPIO_Port = GPIO_GetPort(ChannelGroupIdPtr->port);
+    GPIO_Port = ChannelGroupIdPtr->port;
     if(GPIO_Port == NULL)
     {
         return 0; // Return a default value or handle error appropriately
@@ -140,12 +148,13 @@ Dio_PortLevelType DIO_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
     mask = ChannelGroupIdPtr->mask;
     offset = ChannelGroupIdPtr->offset;
 
-    return (Dio_PortLevelType)((GPIO_ReadInputData(GPIO_Port) & mask) >> offset);
+    return (Dio_PortLevelType)((GPIO_Port->IDR & mask) >> offset);
 }
 /**************************************************************************** 
  * @brief Hàm để ghi mức độ của một nhóm kênh DIO.
  * @details Hàm này nhận vào một con trỏ đến cấu trúc Dio_ChannelGroupType, xác định cổng GPIO, mặt nạ và độ lệch của nhóm kênh.
  *          Nó sẽ ghi mức độ vào các kênh trong nhóm theo mặt nạ và độ lệch đã chỉ định.
+ *          Chỉ dùng một lần ghi 32-bit vào BSRR nên an toàn với ngắt mà không cần tắt IRQ.
  * @param[in] ChannelGroupIdPtr Con trỏ đến cấu trúc Dio_ChannelGroupType chứa thông tin về nhóm kênh.
  * @param[in] Level Mức độ cần ghi (Dio_PortLevelType).
  * ****************************************************************************/
@@ -161,7 +170,7 @@ void DIO_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
         return; // Handle error appropriately
     }
 
-    GPIO_Port = GPIO_GetPort(ChannelGroupIdPtr->port);
+    GPIO_Port = ChannelGroupIdPtr->port;
     if(GPIO_Port == NULL)
     {
         return; // Handle error appropriately
@@ -170,10 +179,12 @@ void DIO_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
     mask = ChannelGroupIdPtr->mask;
     offset = ChannelGroupIdPtr->offset;
 
-    Dio_PortLevelType currentLevel = GPIO_ReadInputData(GPIO_Port) & ~mask;
-    currentLevel |= (Level << offset) & mask;
+    /* Một lần ghi BSRR: bit 1 -> set (nửa thấp), bit 0 -> reset (nửa cao).
+       Không đọc-sửa-ghi ODR nên ngắt ghi chân khác cùng cổng không bị mất. */
+    uint16_t setBits = (uint16_t)(Level << offset) & mask;
+    uint16_t resetBits = (uint16_t)~setBits & mask;
 
-    GPIO_Write(GPIO_Port, currentLevel);
+    GPIO_Port->BSRR = ((uint32_t)resetBits << 16) | setBits;
 }
 
 /***************************************************************************
@@ -205,24 +216,23 @@ void DIO_GetVersionInfo(Std_VersionInfoType* versioninfo)
 
 Dio_LevelType DIO_FlipChannel(Dio_ChannelType ChannelId)
 {
-    GPIO_TypeDef *GPIO_Port;
-    uint16_t GIPO_Pin;
+    const Dio_ChannelMapType *channel;
 
-    GPIO_Port = GPIO_GetPort(ChannelId);
-    if(GPIO_Port == NULL)
+    if(ChannelId >= DIO_CHANNEL_COUNT)
     {
         return STD_LOW; // Return a default value or handle error appropriately
     }
-    GIPO_Pin = GPIO_GetPin(ChannelId);
+    channel = &Dio_ChannelMap[ChannelId];
 
-    if(GPIO_ReadInputDataBit(GPIO_Port, GIPO_Pin) == STD_HIGH)
+    /* Tra bảng một lần, đọc mức đang xuất (ODR) rồi đảo bằng BSRR */
+    if((channel->port->ODR & channel->mask) != 0)
     {
-        DIO_WriteChannel(ChannelId, STD_LOW);
+        channel->port->BSRR = (uint32_t)channel->mask << 16;
         return STD_LOW;
     }
     else
     {
-        DIO_WriteChannel(ChannelId, STD_HIGH);
+        channel->port->BSRR = channel->mask;
         return STD_HIGH;
     }
 }
@@ -231,6 +241,7 @@ Dio_LevelType DIO_FlipChannel(Dio_ChannelType ChannelId)
  * @brief Hàm để ghi mức độ của một cổng DIO với mặt nạ.
  * @details Hàm này nhận vào ID của cổng, mức độ cần ghi và mặt nạ để xác định các chân cần ghi.
  *          Nó sẽ ghi mức độ vào các chân tương ứng với mặt nạ đã chỉ định.
+ *          Chỉ dùng một lần ghi 32-bit vào BSRR nên an toàn với ngắt mà không cần tắt IRQ.
  * @param[in] PortId ID của cổng DIO cần ghi.
  * @param[in] Level Mức độ cần ghi (Dio_PortLevelType).
  * @param[in] Mask Mặt nạ để xác định các chân cần ghi.
@@ -240,14 +251,241 @@ void DIO_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortL
 {
     GPIO_TypeDef *GPIO_Port;
 
-    GPIO_Port = GPIO_GetPort(PortId);
-    if(GPIO_Port == NULL)
+    if(PortId >= DIO_PORT_COUNT)
     {
         return; // Handle error appropriately
     }
+    GPIO_Port = Dio_PortMap[PortId];
     
-    Dio_PortLevelType currentLevel = GPIO_ReadInputData(GPIO_Port) & ~Mask;
-    currentLevel |= (Level & Mask);
+    /* Một lần ghi BSRR, nguyên tử với ngắt (xem DIO_WriteChannelGroup) */
+    uint16_t setBits = Level & Mask;
+    uint16_t resetBits = (uint16_t)~Level & Mask;
 
-    GPIO_Write(GPIO_Port, currentLevel);
+    GPIO_Port->BSRR = ((uint32_t)resetBits << 16) | setBits;
+}
+
+/***************************************************************************
+ * @brief Ghi đệm mức của một kênh, chưa ghi ra phần cứng.
+ * @details Mức được gộp vào bản đệm set/reset của cổng; lần stage sau
+ *          cùng của một chân sẽ thắng. Ra phần cứng khi gọi Dio_Commit().
+ * @param[in] ChannelId ID của kênh DIO (DIO_CHANNEL_xx).
+ * @param[in] Level Mức độ cần ghi (STD_HIGH hoặc STD_LOW).
+ ***************************************************************************/
+
+void Dio_StageChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    uint8_t portIdx;
+    uint32_t mask;
+
+    if(ChannelId >= DIO_CHANNEL_COUNT)
+    {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STAGECHANNEL_ID, DIO_E_PARAM_INVALID_CHANNEL);
+        return;
+    }
+    portIdx = (uint8_t)(ChannelId / DIO_PINS_PER_PORT);
+    mask = 1UL << (ChannelId % DIO_PINS_PER_PORT);
+
+    if(Level == STD_HIGH)
+    {
+        Dio_StagedBsrr[portIdx] = (Dio_StagedBsrr[portIdx] & ~(mask << 16)) | mask;
+    }
+    else
+    {
+        Dio_StagedBsrr[portIdx] = (Dio_StagedBsrr[portIdx] & ~mask) | (mask << 16);
+    }
+    Dio_StagedPorts |= (uint8_t)(1U << portIdx);
+}
+
+/***************************************************************************
+ * @brief Ghi đệm mức của một nhóm kênh, chưa ghi ra phần cứng.
+ * @param[in] ChannelGroupIdPtr Con trỏ đến nhóm kênh.
+ * @param[in] Level Mức của nhóm (chưa dịch offset).
+ ***************************************************************************/
+
+void Dio_StageChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+    uint32_t portIdx;
+    uint32_t setBits;
+    uint32_t resetBits;
+
+    if(ChannelGroupIdPtr == NULL)
+    {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STAGECHANNELGROUP_ID, DIO_E_PARAM_INVALID_GROUP);
+        return;
+    }
+    /* GPIOA..GPIOD cách nhau 0x400 nên chỉ số cổng suy ra từ địa chỉ */
+    portIdx = (uint32_t)(((uintptr_t)ChannelGroupIdPtr->port - GPIOA_BASE) >> 10);
+    if(portIdx >= DIO_PORT_COUNT)
+    {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STAGECHANNELGROUP_ID, DIO_E_PARAM_INVALID_GROUP);
+        return;
+    }
+
+    setBits = ((uint32_t)Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask;
+    resetBits = ~setBits & ChannelGroupIdPtr->mask;
+
+    Dio_StagedBsrr[portIdx] &= ~(((uint32_t)ChannelGroupIdPtr->mask << 16) | ChannelGroupIdPtr->mask);
+    Dio_StagedBsrr[portIdx] |= (resetBits << 16) | setBits;
+    Dio_StagedPorts |= (uint8_t)(1U << portIdx);
+}
+
+/***************************************************************************
+ * @brief Ghi tất cả thay đổi đã stage ra phần cứng.
+ * @details Mỗi cổng có thay đổi được ghi bằng đúng một lần store BSRR,
+ *          cổng không đổi không bị truy cập. Bản đệm được xóa sau commit.
+ ***************************************************************************/
+
+void Dio_Commit(void)
+{
+    uint8_t pending = Dio_StagedPorts;
+
+    Dio_StagedPorts = 0;
+    for(uint8_t portIdx = 0; pending != 0; portIdx++, pending >>= 1)
+    {
+        if(pending & 1U)
+        {
+            Dio_PortMap[portIdx]->BSRR = Dio_StagedBsrr[portIdx];
+            Dio_StagedBsrr[portIdx] = 0;
+        }
+    }
+}
+
+/***************************************************************************
+ * @brief Chụp IDR của mọi cổng với độ lệch nhỏ nhất.
+ * @details Nạp hết địa chỉ vào thanh ghi trước để không có lệnh nào
+ *          chen vào giữa 4 lệnh load IDR, rồi mới ghi kết quả ra Levels.
+ *          Độ lệch: xem Dio.h.
+ * @param[out] Levels Mảng DIO_PORT_COUNT phần tử, chỉ số là Dio_PortType.
+ ***************************************************************************/
+
+void Dio_ReadAllPorts(Dio_PortLevelType Levels[])
+{
+    volatile uint32_t *idrA, *idrB, *idrC, *idrD;
+    uint32_t levelA, levelB, levelC, levelD;
+
+    if(Levels == NULL)
+    {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_READALLPORTS_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+
+    idrA = Dio_PortIdrMap[DIO_PORT_A];
+    idrB = Dio_PortIdrMap[DIO_PORT_B];
+    idrC = Dio_PortIdrMap[DIO_PORT_C];
+    idrD = Dio_PortIdrMap[DIO_PORT_D];
+    /* Buộc 4 địa chỉ nằm sẵn trong thanh ghi (không nạp lại từ bảng) */
+    __ASM volatile ("" : "+r" (idrA), "+r" (idrB), "+r" (idrC), "+r" (idrD));
+
+    levelA = *idrA;
+    levelB = *idrB;
+    levelC = *idrC;
+    levelD = *idrD;
+
+    Levels[DIO_PORT_A] = (Dio_PortLevelType)levelA;
+    Levels[DIO_PORT_B] = (Dio_PortLevelType)levelB;
+    Levels[DIO_PORT_C] = (Dio_PortLevelType)levelC;
+    Levels[DIO_PORT_D] = (Dio_PortLevelType)levelD;
+}
+
+/***************************************************************************
+ * @brief Ghi mức của mọi cổng bằng 4 lệnh store BSRR liền nhau.
+ * @details Word BSRR của từng cổng (set = Level, reset = ~Level) được
+ *          tính xong trước lần ghi đầu tiên.
+ * @param[in] Levels Mảng DIO_PORT_COUNT phần tử, chỉ số là Dio_PortType.
+ ***************************************************************************/
+
+void Dio_WriteAllPorts(const Dio_PortLevelType Levels[])
+{
+    volatile uint32_t *bsrrA, *bsrrB, *bsrrC, *bsrrD;
+    uint32_t wordA, wordB, wordC, wordD;
+
+    if(Levels == NULL)
+    {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_WRITEALLPORTS_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+
+    wordA = ((uint32_t)(uint16_t)~Levels[DIO_PORT_A] << 16) | Levels[DIO_PORT_A];
+    wordB = ((uint32_t)(uint16_t)~Levels[DIO_PORT_B] << 16) | Levels[DIO_PORT_B];
+    wordC = ((uint32_t)(uint16_t)~Levels[DIO_PORT_C] << 16) | Levels[DIO_PORT_C];
+    wordD = ((uint32_t)(uint16_t)~Levels[DIO_PORT_D] << 16) | Levels[DIO_PORT_D];
+    bsrrA = Dio_PortBsrrMap[DIO_PORT_A];
+    bsrrB = Dio_PortBsrrMap[DIO_PORT_B];
+    bsrrC = Dio_PortBsrrMap[DIO_PORT_C];
+    bsrrD = Dio_PortBsrrMap[DIO_PORT_D];
+    /* Buộc địa chỉ và word đã tính xong, nằm sẵn trong thanh ghi */
+    __ASM volatile ("" : "+r" (bsrrA), "+r" (bsrrB), "+r" (bsrrC), "+r" (bsrrD),
+                         "+r" (wordA), "+r" (wordB), "+r" (wordC), "+r" (wordD));
+
+    *bsrrA = wordA;
+    *bsrrB = wordB;
+    *bsrrC = wordC;
+    *bsrrD = wordD;
+}
+
+/***************************************************************************
+ * @brief Đọc giá trị logic của một nhóm kênh ảo.
+ * @details IDR của các cổng được đọc liền nhau trước, sau đó mỗi nibble
+ *          IDR có chân của nhóm được đổi sang bit logic bằng bảng gather.
+ * @param[in] GroupPtr Nhóm kênh ảo (DIO_VIRTUAL_GROUP).
+ * @return Giá trị nhóm, bit i là chân thứ i trong danh sách.
+ ***************************************************************************/
+
+Dio_PortLevelType Dio_ReadVirtualGroup(const Dio_VirtualGroupType* GroupPtr)
+{
+    uint32_t idr[DIO_VGROUP_MAX_PORTS];
+    uint32_t level = 0;
+
+    if(GroupPtr == NULL)
+    {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_READVIRTUALGROUP_ID, DIO_E_PARAM_POINTER);
+        return 0;
+    }
+
+    for(uint8_t p = 0; p < DIO_VGROUP_MAX_PORTS; p++)
+    {
+        idr[p] = (GroupPtr->mask[p] != 0U) ? (GroupPtr->port[p]->IDR & GroupPtr->mask[p]) : 0U;
+    }
+    for(uint8_t p = 0; p < DIO_VGROUP_MAX_PORTS; p++)
+    {
+        /* Dừng khi các nibble còn lại không có chân của nhóm */
+        for(uint8_t n = 0; idr[p] != 0U; n++, idr[p] >>= 4)
+        {
+            level |= GroupPtr->gather[p][n][idr[p] & 0xFU];
+        }
+    }
+    return (Dio_PortLevelType)level;
+}
+
+/***************************************************************************
+ * @brief Ghi giá trị logic cho một nhóm kênh ảo.
+ * @details Mỗi nibble của Level tra ra bit set của cả hai cổng (bảng
+ *          scatter), chân của nhóm không được set thì bị reset; mỗi cổng
+ *          được ghi bằng đúng một store BSRR.
+ * @param[in] GroupPtr Nhóm kênh ảo (DIO_VIRTUAL_GROUP).
+ * @param[in] Level Giá trị nhóm, bit i là chân thứ i trong danh sách.
+ ***************************************************************************/
+
+void Dio_WriteVirtualGroup(const Dio_VirtualGroupType* GroupPtr, Dio_PortLevelType Level)
+{
+    uint32_t set = 0;
+
+    if(GroupPtr == NULL)
+    {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_WRITEVIRTUALGROUP_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+
+    for(uint8_t n = 0; n * 4U < GroupPtr->width; n++)
+    {
+        set |= GroupPtr->scatter[n][(Level >> (n * 4U)) & 0xFU];
+    }
+    for(uint8_t p = 0; p < DIO_VGROUP_MAX_PORTS; p++, set >>= 16)
+    {
+        uint32_t mask = GroupPtr->mask[p];
+        if(mask != 0U)
+        {
+            GroupPtr->port[p]->BSRR = ((mask & ~set) << 16) | (set & mask);
+        }
+    }
 }
@@ -0,0 +1,497 @@
+/**********************************************************
+ * @file    Dio_BitBang.c
+ * @brief   SPI / I2C / one-wire bằng phần mềm trên các kênh DIO
+ * @details Mọi cạnh được đặt ở mốc tuyệt đối t của DWT->CYCCNT (Tm); mốc
+ *          kế tiếp là t + nửa chu kỳ. Nếu bị ngắt làm trễ hơn nửa
+ *          chu kỳ, mốc được đặt lại từ thời điểm hiện tại thay vì
+ *          chạy bù các bit sau nhanh hơn tốc độ đã chọn.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "stm32f10x.h"
+#include "Dio_BitBang.h"
+#include "Tm.h"
+#include "Det.h"
+#include <stddef.h>
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Số byte chạy thử để đo tốc độ tối đa */
+#define DIO_BITBANG_PROBE_BYTES     4U
+
+/* Bit báo hết thời gian chờ clock stretching (ngoài 9 bit dữ liệu + ACK) */
+#define DIO_BITBANG_I2C_TIMEOUT     0x80000000UL
+
+/* Slot one-wire tốc độ chuẩn theo AN126 (µs) */
+#define DIO_OW_A_US     6U
+#define DIO_OW_C_US     60U
+#define DIO_OW_D_US     10U
+#define DIO_OW_E_US     9U
+#define DIO_OW_F_US     55U
+#define DIO_OW_H_US     480U
+#define DIO_OW_I_US     70U
+#define DIO_OW_J_US     410U
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/**********************************************************
+ * @brief Chờ đến mốc Deadline, trả về mốc dùng cho cạnh kế tiếp
+ * @details Trễ quá Half (bị ngắt) thì lấy thời điểm hiện tại làm mốc,
+ *          để không chạy bù nhanh hơn tốc độ đã chọn.
+ **********************************************************/
+static inline uint32 Dio_BitBangNext(uint32 Deadline, uint32 Half)
+{
+    uint32 now;
+
+    do {
+        now = Tm_GetCycles();
+    } while ((sint32)(now - Deadline) < 0);
+    return ((now - Deadline) > Half) ? now : Deadline;
+}
+
+static Std_ReturnType Dio_BitBangPin(Dio_BitBangPinType* Pin, Dio_ChannelType ChannelId)
+{
+    if (ChannelId >= DIO_CHANNEL_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGINIT_ID, DIO_E_PARAM_INVALID_CHANNEL);
+        return E_NOT_OK;
+    }
+    Pin->bsrr = &Dio_ChannelMap[ChannelId].port->BSRR;
+    Pin->idr = &Dio_ChannelMap[ChannelId].port->IDR;
+    Pin->mask = Dio_ChannelMap[ChannelId].mask;
+    Pin->high = Pin->mask;
+    Pin->low = (uint32)Pin->mask << 16;
+    return E_OK;
+}
+
+/* Chân không dùng: store/load vào cổng của Ref với word 0, mask 0 */
+static void Dio_BitBangNoPin(Dio_BitBangPinType* Pin, const Dio_BitBangPinType* Ref)
+{
+    Pin->bsrr = Ref->bsrr;
+    Pin->idr = Ref->idr;
+    Pin->mask = 0;
+    Pin->high = 0;
+    Pin->low = 0;
+}
+
+/* Bản chạy thử: giữ nguyên các truy cập bus nhưng không đổi chân nào */
+static void Dio_BitBangDryPin(Dio_BitBangPinType* Pin)
+{
+    Pin->high = 0;
+    Pin->low = 0;
+    Pin->mask = 0;
+}
+
+/**********************************************************
+ * @brief Tính nửa chu kỳ cho Bitrate và tốc độ thực/tối đa
+ * @param[in]  CyclesPerBit  Chu kỳ mỗi bit khi nửa chu kỳ = 0 (đo được)
+ * @param[out] Actual        Tốc độ thực
+ * @param[out] Max           Tốc độ tối đa
+ * @return Nửa chu kỳ (chu kỳ CYCCNT), 0 nếu Bitrate vượt tốc độ tối đa
+ **********************************************************/
+static uint32 Dio_BitBangHalf(uint32 Bitrate, uint32 CyclesPerBit, uint32* Actual, uint32* Max)
+{
+    uint32 half = SystemCoreClock / 2U / Bitrate;
+
+    /* Làm tròn lên: không chạy nhanh hơn tốc độ yêu cầu */
+    if (half * 2U * Bitrate < SystemCoreClock) half++;
+
+    if (CyclesPerBit == 0U) CyclesPerBit = 1U;
+    *Max = SystemCoreClock / CyclesPerBit;
+    if (2U * half <= CyclesPerBit) {
+        *Actual = *Max;
+        return 0;
+    }
+    *Actual = SystemCoreClock / (2U * half);
+    return half;
+}
+
+/* Một byte SPI, MSB trước; *Deadline là mốc của cạnh đầu tiên */
+static uint8 Dio_BitBangSpiByte(const Dio_BitBangSpiType* Spi, uint32 Out, uint32* Deadline)
+{
+    volatile uint32_t* dataBsrr = Spi->mosi.bsrr;
+    volatile uint32_t* sckBsrr = Spi->sck.bsrr;
+    volatile uint32_t* idr = Spi->miso.idr;
+    uint32 mask = Spi->miso.mask;
+    uint32 half = Spi->halfCycles;
+    uint32 t = *Deadline;
+    uint32 in = 0;
+
+    for (uint8 b = 0; b < 8U; b++) {
+        *dataBsrr = Spi->firstWord[(Out >> 7) & 1U];
+        if (dataBsrr != sckBsrr) {
+            *sckBsrr = Spi->firstSck;
+        }
+        Out <<= 1;
+        t = Dio_BitBangNext(t + half, half);
+        *sckBsrr = Spi->secondWord;
+        in = (in << 1) | ((*idr & mask) != 0U);
+        t = Dio_BitBangNext(t + half, half);
+    }
+    *Deadline = t;
+    return (uint8)in;
+}
+
+/* SCL lên mức 1 (nhả) và chờ slave hết giữ clock; trả về mốc mới hoặc báo hết giờ */
+static boolean Dio_BitBangI2cRelease(const Dio_BitBangI2cType* I2c, uint32* Deadline)
+{
+    volatile uint32_t* idr = I2c->scl.idr;
+    uint32 mask = I2c->scl.mask;
+
+    *I2c->scl.bsrr = I2c->scl.high;
+    if ((*idr & mask) != mask) {
+        uint32 now;
+        do {
+            now = Tm_GetCycles();
+            if (now - *Deadline > I2c->stretchCycles) return FALSE;
+        } while ((*idr & mask) != mask);
+        *Deadline = now;    /* Nửa chu kỳ cao tính từ lúc SCL thực sự lên */
+    }
+    return TRUE;
+}
+
+/**********************************************************
+ * @brief Dịch 9 bit (8 bit + ACK) trên bus, MSB trước
+ * @details Bit ra = 1 là nhả SDA, nên đọc một byte bằng Out = 0x1FF
+ *          (kèm ACK/NACK ở bit 0). Mỗi bit: đặt SDA khi SCL thấp,
+ *          nhả SCL (chờ clock stretching), lấy mẫu SDA cuối nửa cao.
+ * @return 9 bit đọc được, hoặc DIO_BITBANG_I2C_TIMEOUT
+ **********************************************************/
+static uint32 Dio_BitBangI2cShift(const Dio_BitBangI2cType* I2c, uint32 Out, uint32* Deadline)
+{
+    volatile uint32_t* sdaBsrr = I2c->sda.bsrr;
+    volatile uint32_t* sdaIdr = I2c->sda.idr;
+    uint32 sdaMask = I2c->sda.mask;
+    uint32 half = I2c->halfCycles;
+    uint32 t = *Deadline;
+    uint32 in = 0;
+
+    for (uint8 b = 0; b < 9U; b++) {
+        *sdaBsrr = ((Out >> (8U - b)) & 1U) ? I2c->sda.high : I2c->sda.low;
+        t = Dio_BitBangNext(t + half, half);
+        if (!Dio_BitBangI2cRelease(I2c, &t)) return DIO_BITBANG_I2C_TIMEOUT;
+        t = Dio_BitBangNext(t + half, half);
+        in = (in << 1) | ((*sdaIdr & sdaMask) != 0U);
+        *I2c->scl.bsrr = I2c->scl.low;
+    }
+    *Deadline = t;
+    return in;
+}
+
+/* START: SDA xuống khi SCL cao, rồi SCL xuống; trả về mốc của bit đầu */
+static uint32 Dio_BitBangI2cStart(const Dio_BitBangI2cType* I2c)
+{
+    uint32 half = I2c->halfCycles;
+    uint32 t = Tm_GetCycles();
+
+    *I2c->sda.bsrr = I2c->sda.high;
+    *I2c->scl.bsrr = I2c->scl.high;
+    t = Dio_BitBangNext(t + half, half);
+    *I2c->sda.bsrr = I2c->sda.low;
+    t = Dio_BitBangNext(t + half, half);
+    *I2c->scl.bsrr = I2c->scl.low;
+    return t;
+}
+
+/* STOP: SDA lên khi SCL cao, giữ bus rảnh thêm nửa chu kỳ */
+static void Dio_BitBangI2cStop(const Dio_BitBangI2cType* I2c, uint32 Deadline)
+{
+    uint32 half = I2c->halfCycles;
+    uint32 t = Deadline;
+
+    *I2c->sda.bsrr = I2c->sda.low;
+    t = Dio_BitBangNext(t + half, half);
+    (void)Dio_BitBangI2cRelease(I2c, &t);
+    t = Dio_BitBangNext(t + half, half);
+    *I2c->sda.bsrr = I2c->sda.high;
+    Tm_WaitUntil(t + half);
+}
+
+/* Một slot one-wire; bit 1 cũng là slot đọc, trả về mức lấy mẫu.
+ * Khác SPI/I2C, slave đo độ rộng xung thấp: ngắt chen vào xung 6 µs
+ * biến bit 1 thành bit 0 hoặc đọc sai, nên từ cạnh xuống đến hết xung
+ * thấp (bit 0) hay đến lúc lấy mẫu (bit 1) ngắt bị khóa. Phần hồi phục
+ * còn lại của slot chịu được trễ nên ngắt được mở trước đó. */
+static uint32 Dio_BitBangOneWireBit(const Dio_BitBangOneWireType* OneWire, uint32 Bit)
+{
+    volatile uint32_t* bsrr = OneWire->pin.bsrr;
+    uint32 primask = Dio_IrqSave();
+    uint32 t = Tm_GetCycles();
+    uint32 level = 0;
+
+    *bsrr = OneWire->pin.low;
+    if (Bit) {
+        Tm_WaitUntil(t += OneWire->a);
+        *bsrr = OneWire->pin.high;
+        Tm_WaitUntil(t += OneWire->e);
+        level = (*OneWire->pin.idr & OneWire->pin.mask) != 0U;
+        Dio_IrqRestore(primask);
+        Tm_WaitUntil(t + OneWire->f);
+    } else {
+        Tm_WaitUntil(t += OneWire->c);
+        *bsrr = OneWire->pin.high;
+        Dio_IrqRestore(primask);
+        Tm_WaitUntil(t + OneWire->d);
+    }
+    return level;
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+Std_ReturnType Dio_BitBangSpiInit(Dio_BitBangSpiType* Spi, const Dio_BitBangSpiConfigType* Config)
+{
+    Dio_BitBangSpiType dry;
+    uint8 probe[DIO_BITBANG_PROBE_BYTES] = { 0 };
+    uint32 idle, active, first, start;
+
+    if (Spi == NULL || Config == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGINIT_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (Config->Bitrate == 0U || Config->Mode > 3U) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGINIT_ID, DIO_E_PARAM_INVALID_BITRATE);
+        return E_NOT_OK;
+    }
+    if (Dio_BitBangPin(&Spi->sck, Config->Sck) != E_OK) return E_NOT_OK;
+    if (Config->Mosi == DIO_BITBANG_NO_PIN) {
+        Dio_BitBangNoPin(&Spi->mosi, &Spi->sck);
+    } else if (Dio_BitBangPin(&Spi->mosi, Config->Mosi) != E_OK) {
+        return E_NOT_OK;
+    }
+    if (Config->Miso == DIO_BITBANG_NO_PIN) {
+        Dio_BitBangNoPin(&Spi->miso, &Spi->sck);
+    } else if (Dio_BitBangPin(&Spi->miso, Config->Miso) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    /* CPOL: mức nghỉ của SCK. CPHA = 0: đặt MOSI khi SCK nghỉ, lấy mẫu ở
+     * cạnh đầu; CPHA = 1: đặt MOSI cùng cạnh đầu, lấy mẫu ở cạnh sau */
+    idle = (Config->Mode & 2U) ? Spi->sck.high : Spi->sck.low;
+    active = (Config->Mode & 2U) ? Spi->sck.low : Spi->sck.high;
+    first = (Config->Mode & 1U) ? active : idle;
+    Spi->secondWord = (Config->Mode & 1U) ? idle : active;
+    Spi->endWord = (Config->Mode & 1U) ? 0U : idle;
+    Spi->firstSck = first;
+
+    /* Cùng cổng: bit MOSI và cạnh SCK đi chung một store */
+    if (Spi->mosi.bsrr != Spi->sck.bsrr) first = 0;
+    Spi->firstWord[0] = Spi->mosi.low | first;
+    Spi->firstWord[1] = Spi->mosi.high | first;
+
+    /* Đo chu kỳ mỗi bit ở nửa chu kỳ = 0 với word rỗng */
+    Tm_StartCycleCounter();
+    dry = *Spi;
+    Dio_BitBangDryPin(&dry.miso);
+    dry.firstWord[0] = 0;
+    dry.firstWord[1] = 0;
+    dry.firstSck = 0;
+    dry.secondWord = 0;
+    dry.endWord = 0;
+    dry.halfCycles = 0;
+    start = Tm_GetCycles();
+    Dio_BitBangSpiTransfer(&dry, probe, probe, DIO_BITBANG_PROBE_BYTES);
+    start = Tm_GetCycles() - start;
+
+    Spi->halfCycles = Dio_BitBangHalf(Config->Bitrate, start / (8U * DIO_BITBANG_PROBE_BYTES),
+                                      &Spi->bitrate, &Spi->maxBitrate);
+    *Spi->sck.bsrr = idle;
+    return E_OK;
+}
+
+void Dio_BitBangSpiTransfer(const Dio_BitBangSpiType* Spi, const uint8* Tx, uint8* Rx,
+                            uint32 Length)
+{
+    uint32 t;
+
+    if (Spi == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGTRANSFER_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+
+    t = Tm_GetCycles();
+    for (uint32 i = 0; i < Length; i++) {
+        uint8 in = Dio_BitBangSpiByte(Spi, (Tx != NULL) ? Tx[i] : 0xFFU, &t);
+        if (Rx != NULL) Rx[i] = in;
+    }
+    if (Spi->endWord != 0U) {
+        *Spi->sck.bsrr = Spi->endWord;
+    }
+}
+
+Std_ReturnType Dio_BitBangI2cInit(Dio_BitBangI2cType* I2c, const Dio_BitBangI2cConfigType* Config)
+{
+    Dio_BitBangI2cType dry;
+    uint32 t, start;
+
+    if (I2c == NULL || Config == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGINIT_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (Config->Bitrate == 0U) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGINIT_ID, DIO_E_PARAM_INVALID_BITRATE);
+        return E_NOT_OK;
+    }
+    if (Dio_BitBangPin(&I2c->scl, Config->Scl) != E_OK ||
+        Dio_BitBangPin(&I2c->sda, Config->Sda) != E_OK) {
+        return E_NOT_OK;
+    }
+    I2c->stretchCycles = Tm_UsToCycles(Config->StretchTimeoutUs);
+
+    /* Đo một byte + ACK ở nửa chu kỳ = 0; mask 0 nên SCL luôn "đã nhả" */
+    Tm_StartCycleCounter();
+    dry = *I2c;
+    Dio_BitBangDryPin(&dry.scl);
+    Dio_BitBangDryPin(&dry.sda);
+    dry.halfCycles = 0;
+    t = Tm_GetCycles();
+    start = t;
+    (void)Dio_BitBangI2cShift(&dry, 0x1FFU, &t);
+    start = Tm_GetCycles() - start;
+
+    I2c->halfCycles = Dio_BitBangHalf(Config->Bitrate, start / 9U, &I2c->bitrate, &I2c->maxBitrate);
+
+    /* Bus rảnh: cả hai đường được nhả */
+    *I2c->sda.bsrr = I2c->sda.high;
+    *I2c->scl.bsrr = I2c->scl.high;
+    return E_OK;
+}
+
+Std_ReturnType Dio_BitBangI2cWrite(const Dio_BitBangI2cType* I2c, uint8 Address,
+                                   const uint8* Data, uint32 Length)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 in, t;
+
+    if (I2c == NULL || (Data == NULL && Length != 0U)) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGTRANSFER_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    t = Dio_BitBangI2cStart(I2c);
+    /* Bit ACK phát 1 (nhả SDA); slave ACK kéo xuống 0 */
+    in = Dio_BitBangI2cShift(I2c, ((uint32)(Address & 0x7FU) << 2) | 0x1U, &t);
+    for (uint32 i = 0; i < Length && (in & (DIO_BITBANG_I2C_TIMEOUT | 1U)) == 0U; i++) {
+        in = Dio_BitBangI2cShift(I2c, ((uint32)Data[i] << 1) | 0x1U, &t);
+    }
+    if ((in & (DIO_BITBANG_I2C_TIMEOUT | 1U)) != 0U) ret = E_NOT_OK;
+    Dio_BitBangI2cStop(I2c, t);
+    return ret;
+}
+
+Std_ReturnType Dio_BitBangI2cRead(const Dio_BitBangI2cType* I2c, uint8 Address,
+                                  uint8* Data, uint32 Length)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 in, t;
+
+    if (I2c == NULL || Data == NULL || Length == 0U) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGTRANSFER_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    t = Dio_BitBangI2cStart(I2c);
+    in = Dio_BitBangI2cShift(I2c, ((uint32)(Address & 0x7FU) << 2) | 0x3U, &t);
+    if ((in & (DIO_BITBANG_I2C_TIMEOUT | 1U)) != 0U) {
+        ret = E_NOT_OK;
+    } else {
+        for (uint32 i = 0; i < Length; i++) {
+            /* ACK (0) mọi byte trừ byte cuối, byte cuối NACK (1) */
+            in = Dio_BitBangI2cShift(I2c, 0x1FEU | ((i + 1U == Length) ? 1U : 0U), &t);
+            if (in & DIO_BITBANG_I2C_TIMEOUT) {
+                ret = E_NOT_OK;
+                break;
+            }
+            Data[i] = (uint8)(in >> 1);
+        }
+    }
+    Dio_BitBangI2cStop(I2c, t);
+    return ret;
+}
+
+Std_ReturnType Dio_BitBangOneWireInit(Dio_BitBangOneWireType* OneWire, Dio_ChannelType Pin)
+{
+    if (OneWire == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGINIT_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (Dio_BitBangPin(&OneWire->pin, Pin) != E_OK) return E_NOT_OK;
+
+    OneWire->a = Tm_UsToCycles(DIO_OW_A_US);
+    OneWire->c = Tm_UsToCycles(DIO_OW_C_US);
+    OneWire->d = Tm_UsToCycles(DIO_OW_D_US);
+    OneWire->e = Tm_UsToCycles(DIO_OW_E_US);
+    OneWire->f = Tm_UsToCycles(DIO_OW_F_US);
+    OneWire->h = Tm_UsToCycles(DIO_OW_H_US);
+    OneWire->i = Tm_UsToCycles(DIO_OW_I_US);
+    OneWire->j = Tm_UsToCycles(DIO_OW_J_US);
+
+    /* Slot cố định theo giao thức: tốc độ thực cũng là tốc độ tối đa */
+    OneWire->bitrate = 1000000UL / (DIO_OW_C_US + DIO_OW_D_US);
+    OneWire->maxBitrate = OneWire->bitrate;
+
+    Tm_StartCycleCounter();
+    *OneWire->pin.bsrr = OneWire->pin.high;
+    return E_OK;
+}
+
+Std_ReturnType Dio_BitBangOneWireReset(const Dio_BitBangOneWireType* OneWire)
+{
+    uint32 t;
+    uint32 presence;
+    uint32 primask;
+
+    if (OneWire == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGTRANSFER_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    /* Xung reset 480 µs chỉ cần tối thiểu, ngắt kéo dài nó vô hại; từ
+     * lúc nhả đường dây đến khi lấy mẫu presence (70 µs) thì khóa ngắt */
+    t = Tm_GetCycles();
+    *OneWire->pin.bsrr = OneWire->pin.low;
+    Tm_WaitUntil(t += OneWire->h);
+    primask = Dio_IrqSave();
+    *OneWire->pin.bsrr = OneWire->pin.high;
+    t = Tm_GetCycles();
+    Tm_WaitUntil(t += OneWire->i);
+    presence = (*OneWire->pin.idr & OneWire->pin.mask) == 0U;
+    Dio_IrqRestore(primask);
+    Tm_WaitUntil(t + OneWire->j);
+    return presence ? E_OK : E_NOT_OK;
+}
+
+void Dio_BitBangOneWireWrite(const Dio_BitBangOneWireType* OneWire, const uint8* Data,
+                             uint32 Length)
+{
+    if (OneWire == NULL || (Data == NULL && Length != 0U)) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGTRANSFER_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+    for (uint32 i = 0; i < Length; i++) {
+        for (uint8 b = 0; b < 8U; b++) {
+            (void)Dio_BitBangOneWireBit(OneWire, (Data[i] >> b) & 1U);
+        }
+    }
+}
+
+void Dio_BitBangOneWireRead(const Dio_BitBangOneWireType* OneWire, uint8* Data, uint32 Length)
+{
+    if (OneWire == NULL || (Data == NULL && Length != 0U)) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BITBANGTRANSFER_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+    for (uint32 i = 0; i < Length; i++) {
+        uint32 value = 0;
+        for (uint8 b = 0; b < 8U; b++) {
+            value |= Dio_BitBangOneWireBit(OneWire, 1U) << b;
+        }
+        Data[i] = (uint8)value;
+    }
+}
@@ -0,0 +1,141 @@
+/**********************************************************
+ * @file    Dio_Bus.c
+ * @brief   Bus song song 8 bit (8080/6800) dùng bảng byte -> BSRR
+ * @details Vòng lặp ghi chỉ gồm: đọc byte, tra bảng, store BSRR data
+ *          (kèm kích strobe), store nhả strobe. Con trỏ thanh ghi và
+ *          word strobe được nạp vào biến cục bộ trước vòng lặp.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "stm32f10x.h"
+#include "Dio_Bus.h"
+#include "Det.h"
+#include <stddef.h>
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Đổi chế độ chân data (crOutput/crInput), các chân khác giữ nguyên */
+static void Dio_BusSetMode(const Dio_BusType* Bus, const uint32* Cr)
+{
+    GPIO_TypeDef* port = Bus->dataPort;
+
+    if (Bus->crMask[0] != 0U) {
+        port->CRL = (port->CRL & ~Bus->crMask[0]) | Cr[0];
+    }
+    if (Bus->crMask[1] != 0U) {
+        port->CRH = (port->CRH & ~Bus->crMask[1]) | Cr[1];
+    }
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Dio_BusWrite(const Dio_BusType* Bus, const uint8* Data, uint32 Length)
+{
+    volatile uint32_t* dataBsrr;
+    volatile uint32_t* strobe;
+    const uint32* table;
+    uint32 release;
+    uint32 assert;
+
+    if (Bus == NULL || (Data == NULL && Length != 0U)) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BUSWRITE_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+
+    dataBsrr = &Bus->dataPort->BSRR;
+    strobe = Bus->write.bsrr;
+    table = Bus->writeTable;
+    release = Bus->write.releaseWord;
+    assert = Bus->write.assertWord;
+
+    if (Bus->dirBsrr != NULL) {
+        *Bus->dirBsrr = Bus->dirWrite;
+    }
+
+    if (assert == 0U) {
+        /* Strobe đã gộp: 2 store mỗi byte */
+        for (uint32 i = 0; i < Length; i++) {
+            *dataBsrr = table[Data[i]];
+            *strobe = release;
+        }
+    } else {
+        for (uint32 i = 0; i < Length; i++) {
+            *dataBsrr = table[Data[i]];
+            *strobe = assert;
+            *strobe = release;
+        }
+    }
+}
+
+void Dio_BusRead(const Dio_BusType* Bus, uint8* Data, uint32 Length)
+{
+    volatile uint32_t* idr;
+    volatile uint32_t* strobe;
+    uint32 assert;
+    uint32 release;
+    uint32 mask;
+
+    if (Bus == NULL || (Data == NULL && Length != 0U)) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BUSREAD_ID, DIO_E_PARAM_POINTER);
+        return;
+    }
+
+    idr = &Bus->dataPort->IDR;
+    strobe = Bus->read.bsrr;
+    assert = Bus->read.assertWord;
+    release = Bus->read.releaseWord;
+    mask = Bus->dataMask;
+
+    if (Bus->dirBsrr != NULL) {
+        *Bus->dirBsrr = Bus->dirRead;
+    }
+    Dio_BusSetMode(Bus, Bus->crInput);
+
+    for (uint32 i = 0; i < Length; i++) {
+        uint32 level;
+        uint32 value = 0;
+
+        *strobe = assert;
+        level = *idr & mask;
+        *strobe = release;
+        for (uint8 n = 0; level != 0U; n++, level >>= 4) {
+            value |= Bus->gather[n][level & 0xFU];
+        }
+        Data[i] = (uint8)value;
+    }
+
+    Dio_BusSetMode(Bus, Bus->crOutput);
+}
+
+Std_ReturnType Dio_BusWriteDma(const Dio_BusType* Bus, const uint8* Data, uint16 Length,
+                               uint32* Words, const Dio_StreamTimerType* Timer)
+{
+    if (Bus == NULL || Data == NULL || Words == NULL || Timer == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BUSWRITE_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    /* DMA chỉ ghi được một BSRR: strobe phải gộp được vào word data */
+    if (Bus->write.assertWord != 0U || Timer->mode != DIO_STREAM_ONESHOT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BUSWRITE_ID, DIO_E_PARAM_INVALID_BUS);
+        return E_NOT_OK;
+    }
+    if (Length == 0U || Length > 0x7FFFU) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_BUSWRITE_ID, DIO_E_PARAM_INVALID_LENGTH);
+        return E_NOT_OK;
+    }
+
+    for (uint16 i = 0; i < Length; i++) {
+        Words[2U * i] = Bus->writeTable[Data[i]];
+        Words[2U * i + 1U] = Bus->write.releaseWord;
+    }
+    if (Bus->dirBsrr != NULL) {
+        *Bus->dirBsrr = Bus->dirWrite;
+    }
+    return Dio_StreamStart(Bus->dataPortId, Words, (uint16)(2U * Length), Timer);
+}
@@ -0,0 +1,296 @@
+/**********************************************************
+ * @file    Dio_Capture.c
+ * @brief   Lấy mẫu cả cổng GPIO bằng DMA (kiểu logic analyzer)
+ * @details Timer chạy một kênh output compare ở chế độ Timing
+ *          (CCR = 0, không ra chân): mỗi chu kỳ có một compare event
+ *          -> DMA1 chép GPIOx->IDR (half-word) vào ring buffer,
+ *          circular. Ngắt HT/TC báo từng nửa buffer và đếm số vòng để
+ *          suy ra chỉ số tuyệt đối (dấu thời gian) của mẫu.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "stm32f10x.h"
+#include "stm32f10x_dma.h"
+#include "stm32f10x_tim.h"
+#include "misc.h"
+#include "Dio_Capture.h"
+#include "Det.h"
+#include "Clk.h"
+#include <stddef.h>
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Tài nguyên phần cứng cố định của mỗi timer */
+typedef struct {
+    TIM_TypeDef*         TIMx;
+    Clk_PeripheralType   clock;     /* Định danh clock của timer trong Clk */
+    void               (*ocInit)(TIM_TypeDef*, TIM_OCInitTypeDef*);
+    uint16               dmaSource; /* TIM_DMA_CCx */
+    DMA_Channel_TypeDef* channel;   /* Kênh DMA1 nhận yêu cầu TIMx_CHx */
+    uint32               itGL;
+    uint32               itTC;
+    uint32               itHT;
+    IRQn_Type            irq;
+} Dio_CaptureHwType;
+
+#define DIO_CAPTURE_COUNT   3U
+
+static const Dio_CaptureHwType Dio_CaptureHw[DIO_CAPTURE_COUNT] = {
+    { TIM2, CLK_TIM2, TIM_OC3Init, TIM_DMA_CC3, DMA1_Channel1,
+      DMA1_IT_GL1, DMA1_IT_TC1, DMA1_IT_HT1, DMA1_Channel1_IRQn },
+    { TIM3, CLK_TIM3, TIM_OC1Init, TIM_DMA_CC1, DMA1_Channel6,
+      DMA1_IT_GL6, DMA1_IT_TC6, DMA1_IT_HT6, DMA1_Channel6_IRQn },
+    { TIM4, CLK_TIM4, TIM_OC2Init, TIM_DMA_CC2, DMA1_Channel4,
+      DMA1_IT_GL4, DMA1_IT_TC4, DMA1_IT_HT4, DMA1_Channel4_IRQn }
+};
+
+/* Trạng thái capture đang chạy, cùng chỉ số với Dio_CaptureHw */
+typedef struct {
+    uint16*                     buffer;
+    uint16                      samples;
+    volatile uint32             wraps;      /* Số vòng buffer đã đầy */
+    volatile uint32             trigger;    /* Chỉ số mẫu khớp trigger */
+    const Dio_CaptureTimerType* timer;      /* NULL: không chạy */
+    boolean                     clockHeld;  /* Đang giữ clock DMA1 + timer */
+} Dio_CaptureStateType;
+
+static Dio_CaptureStateType Dio_CaptureState[DIO_CAPTURE_COUNT];
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Tìm chỉ số capture theo timer, trả về DIO_CAPTURE_COUNT nếu không hỗ trợ */
+static uint8 Dio_CaptureIndex(const TIM_TypeDef* TIMx)
+{
+    uint8 idx = 0;
+    while (idx < DIO_CAPTURE_COUNT && Dio_CaptureHw[idx].TIMx != TIMx) idx++;
+    return idx;
+}
+
+/* Dừng timer và kênh DMA của một capture */
+static void Dio_CaptureHalt(uint8 idx)
+{
+    const Dio_CaptureHwType* hw = &Dio_CaptureHw[idx];
+
+    TIM_Cmd(hw->TIMx, DISABLE);
+    TIM_DMACmd(hw->TIMx, hw->dmaSource, DISABLE);
+    DMA_Cmd(hw->channel, DISABLE);
+    DMA_ClearITPendingBit(hw->itGL);
+    Dio_CaptureState[idx].timer = NULL;
+}
+
+/**********************************************************
+ * @brief Báo một chunk vừa đầy, áp dụng điều kiện trigger
+ **********************************************************/
+static void Dio_CaptureDeliver(Dio_CaptureStateType* st, Dio_CaptureNotificationType callback,
+                               const uint16* chunk, uint16 length, uint32 first)
+{
+    const Dio_CaptureTimerType* timer = st->timer;
+
+    if (timer->TriggerMask != 0U && st->trigger == DIO_CAPTURE_NO_TRIGGER) {
+        uint16 i = 0;
+        while (i < length && (chunk[i] & timer->TriggerMask) != timer->TriggerValue) i++;
+        if (i == length) return;
+        st->trigger = first + i;
+    }
+    if (callback != NULL) {
+        callback(chunk, length, first);
+    }
+}
+
+/**********************************************************
+ * @brief Xử lý ngắt DMA chung cho mọi capture
+ * @details HT: nửa đầu đầy. TC: nửa sau đầy, sang vòng mới.
+ **********************************************************/
+static void Dio_CaptureIrq(uint8 idx)
+{
+    const Dio_CaptureHwType* hw = &Dio_CaptureHw[idx];
+    Dio_CaptureStateType* st = &Dio_CaptureState[idx];
+    uint16 half = (uint16)(st->samples / 2U);
+    uint32 first;
+
+    if (st->timer == NULL) {
+        DMA_ClearITPendingBit(hw->itGL);
+        return;
+    }
+    first = st->wraps * st->samples;
+
+    if (DMA_GetITStatus(hw->itHT) != RESET) {
+        DMA_ClearITPendingBit(hw->itHT);
+        Dio_CaptureDeliver(st, st->timer->HalfCallback, st->buffer, half, first);
+    }
+    if (DMA_GetITStatus(hw->itTC) != RESET) {
+        DMA_ClearITPendingBit(hw->itTC);
+        st->wraps++;
+        Dio_CaptureDeliver(st, st->timer->CompleteCallback, st->buffer + half, half, first + half);
+    }
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+Std_ReturnType Dio_CaptureStart(Dio_PortType PortId, uint16* RingBuffer, uint16 Samples,
+                                const Dio_CaptureTimerType* Timer)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+    TIM_TimeBaseInitTypeDef TIM_InitStructure;
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    const Dio_CaptureHwType* hw;
+    Dio_CaptureStateType* st;
+    uint8 idx;
+
+    if (PortId >= DIO_PORT_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_CAPTURESTART_ID, DIO_E_PARAM_INVALID_PORT);
+        return E_NOT_OK;
+    }
+    if (RingBuffer == NULL || Timer == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_CAPTURESTART_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    idx = Dio_CaptureIndex(Timer->TIMx);
+    if (idx >= DIO_CAPTURE_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_CAPTURESTART_ID, DIO_E_PARAM_INVALID_TIMER);
+        return E_NOT_OK;
+    }
+    if (Samples < 2U || (Samples & 1U) != 0U) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_CAPTURESTART_ID, DIO_E_PARAM_INVALID_LENGTH);
+        return E_NOT_OK;
+    }
+
+    hw = &Dio_CaptureHw[idx];
+    st = &Dio_CaptureState[idx];
+    if (Clk_Claim(hw->clock, CLK_OWNER_DIO_CAPTURE) != E_OK) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_CAPTURESTART_ID, DIO_E_TIMER_IN_USE);
+        return E_NOT_OK;
+    }
+    if (st->timer != NULL) {
+        Dio_CaptureHalt(idx);
+    }
+    st->buffer = RingBuffer;
+    st->samples = Samples;
+    st->wraps = 0;
+    st->trigger = DIO_CAPTURE_NO_TRIGGER;
+    st->timer = Timer;
+
+    /* Giữ clock DMA1 và timer đến Dio_CaptureStop */
+    if (!st->clockHeld) {
+        Clk_Request(CLK_DMA1);
+        Clk_Request(hw->clock);
+        st->clockHeld = TRUE;
+        Clk_Apply();
+    }
+
+    /* DMA: IDR (cố định) -> ring buffer (tăng địa chỉ), half-word, vòng tròn */
+    DMA_DeInit(hw->channel);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&Dio_PortMap[PortId]->IDR;
+    DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)RingBuffer;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+    DMA_InitStructure.DMA_BufferSize = Samples;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(hw->channel, &DMA_InitStructure);
+
+    /* TC luôn bật để đếm số vòng (dấu thời gian), HT chỉ khi cần báo */
+    DMA_ITConfig(hw->channel, DMA_IT_TC, ENABLE);
+    if (Timer->HalfCallback != NULL || Timer->TriggerMask != 0U) {
+        DMA_ITConfig(hw->channel, DMA_IT_HT, ENABLE);
+    }
+    NVIC_InitStructure.NVIC_IRQChannel = (uint8_t)hw->irq;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
+    /* Timer: một compare event (CCR = 0) mỗi chu kỳ, không ra chân */
+    TIM_InitStructure.TIM_Prescaler = Timer->prescaler;
+    TIM_InitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_InitStructure.TIM_Period = Timer->period;
+    TIM_InitStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM_InitStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(hw->TIMx, &TIM_InitStructure);
+
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+    TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Disable;
+    TIM_OCInitStructure.TIM_OutputNState = TIM_OutputNState_Disable;
+    TIM_OCInitStructure.TIM_Pulse = 0;
+    TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_High;
+    TIM_OCInitStructure.TIM_OCNPolarity = TIM_OCNPolarity_High;
+    TIM_OCInitStructure.TIM_OCIdleState = TIM_OCIdleState_Reset;
+    TIM_OCInitStructure.TIM_OCNIdleState = TIM_OCNIdleState_Reset;
+    hw->ocInit(hw->TIMx, &TIM_OCInitStructure);
+    TIM_DMACmd(hw->TIMx, hw->dmaSource, ENABLE);
+
+    DMA_Cmd(hw->channel, ENABLE);
+    TIM_Cmd(hw->TIMx, ENABLE);
+    return E_OK;
+}
+
+void Dio_CaptureStop(TIM_TypeDef* TIMx)
+{
+    uint8 idx = Dio_CaptureIndex(TIMx);
+
+    if (idx >= DIO_CAPTURE_COUNT) return;
+    if (Dio_CaptureState[idx].timer != NULL) {
+        Dio_CaptureHalt(idx);
+    }
+    if (Dio_CaptureState[idx].clockHeld) {
+        Clk_Release(CLK_DMA1);
+        Clk_Release(Dio_CaptureHw[idx].clock);
+        Dio_CaptureState[idx].clockHeld = FALSE;
+        Clk_Apply();
+    }
+    Clk_Unclaim(Dio_CaptureHw[idx].clock, CLK_OWNER_DIO_CAPTURE);
+}
+
+uint32 Dio_CaptureGetSampleCount(TIM_TypeDef* TIMx)
+{
+    uint8 idx = Dio_CaptureIndex(TIMx);
+    const Dio_CaptureHwType* hw;
+    Dio_CaptureStateType* st;
+    uint32 wraps;
+    uint16 remaining;
+
+    if (idx >= DIO_CAPTURE_COUNT || Dio_CaptureState[idx].timer == NULL) return 0;
+    hw = &Dio_CaptureHw[idx];
+    st = &Dio_CaptureState[idx];
+
+    /* Đọc lại nếu ngắt TC chen vào giữa hai lần đọc */
+    do {
+        wraps = st->wraps;
+        remaining = DMA_GetCurrDataCounter(hw->channel);
+    } while (wraps != st->wraps);
+
+    /* CNDTR đã nạp lại nhưng ngắt TC chưa kịp chạy */
+    if (DMA_GetITStatus(hw->itTC) != RESET && remaining > st->samples / 2U) {
+        wraps++;
+    }
+    return wraps * st->samples + (uint32)(st->samples - remaining);
+}
+
+uint32 Dio_CaptureGetTriggerSample(TIM_TypeDef* TIMx)
+{
+    uint8 idx = Dio_CaptureIndex(TIMx);
+
+    if (idx >= DIO_CAPTURE_COUNT) return DIO_CAPTURE_NO_TRIGGER;
+    return Dio_CaptureState[idx].trigger;
+}
+
+/* ===============================
+ *     Interrupt Handlers
+ * =============================== */
+
+void DMA1_Channel1_IRQHandler(void) { Dio_CaptureIrq(0); }   /* TIM2_CH3 */
+void DMA1_Channel6_IRQHandler(void) { Dio_CaptureIrq(1); }   /* TIM3_CH1 */
+void DMA1_Channel4_IRQHandler(void) { Dio_CaptureIrq(2); }   /* TIM4_CH2 */
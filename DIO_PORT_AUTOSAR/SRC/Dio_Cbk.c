@@ -0,0 +1,20 @@
+/**********************************************************
+ * @file    Dio_Cbk.c
+ * @brief   Callback báo cạnh của Dio_Edge
+ * @details Dio_Lcfg.c được sinh tự động nên callback của ứng dụng đặt
+ *          ở đây; tên hàm khai báo trong TOOLS/mcal_config.json.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Dio_Lcfg.h"
+
+/* ==== Ví dụ callback báo cạnh (chạy trong ngắt EXTI) ==== */
+void Dio_Button_Notification(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    // Ví dụ: nút nhấn PB12 kéo xuống GND -> cạnh xuống = nhấn
+    // DIO_FlipChannel(DIO_CHANNEL_C13);
+    (void)ChannelId;
+    (void)Level;
+}
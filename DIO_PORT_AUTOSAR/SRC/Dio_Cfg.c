@@ -0,0 +1,64 @@
+/**********************************************************
+ * @file    Dio_Cfg.c
+ * @brief   DIO Driver Configuration Source File
+ * @details Sinh bảng tra kênh/cổng DIO tại thời điểm biên dịch.
+ *          Các bảng là const nên linker đặt trong flash. File chỉ chứa
+ *          bảng theo MCU (nằm trong libmcal.a); nhóm kênh, bus, chống
+ *          dội và EXTI của ứng dụng ở Dio_Lcfg.c (sinh bởi mcal_gen.py).
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Dio.h"     /* DIO_PORT_x, kéo theo Dio_Cfg.h */
+
+/* Sinh 16 phần tử {port, 1 << pin} cho một cổng GPIO */
+#define DIO_MAP_PORT(GPIOx) \
+    { GPIOx, 0x0001U }, { GPIOx, 0x0002U }, { GPIOx, 0x0004U }, { GPIOx, 0x0008U }, \
+    { GPIOx, 0x0010U }, { GPIOx, 0x0020U }, { GPIOx, 0x0040U }, { GPIOx, 0x0080U }, \
+    { GPIOx, 0x0100U }, { GPIOx, 0x0200U }, { GPIOx, 0x0400U }, { GPIOx, 0x0800U }, \
+    { GPIOx, 0x1000U }, { GPIOx, 0x2000U }, { GPIOx, 0x4000U }, { GPIOx, 0x8000U }
+
+const Dio_ChannelMapType Dio_ChannelMap[DIO_CHANNEL_COUNT] = {
+    DIO_MAP_PORT(GPIOA),
+    DIO_MAP_PORT(GPIOB),
+    DIO_MAP_PORT(GPIOC),
+    DIO_MAP_PORT(GPIOD)
+};
+
+GPIO_TypeDef* const Dio_PortMap[DIO_PORT_COUNT] = {
+    GPIOA,
+    GPIOB,
+    GPIOC,
+    GPIOD
+};
+
+volatile uint32_t* const Dio_PortIdrMap[DIO_PORT_COUNT] = {
+    &GPIOA->IDR, &GPIOB->IDR, &GPIOC->IDR, &GPIOD->IDR
+};
+
+volatile uint32_t* const Dio_PortBsrrMap[DIO_PORT_COUNT] = {
+    &GPIOA->BSRR, &GPIOB->BSRR, &GPIOC->BSRR, &GPIOD->BSRR
+};
+
+#if (DIO_USE_BITBAND == STD_ON)
+
+/* Sinh 16 phần tử alias {IDR, ODR} cho một cổng (Port = DIO_PORT_x) */
+#define DIO_BB_ENTRY(Port, Pin) \
+    { (volatile uint32*)DIO_BITBAND_IDR((Port) * DIO_PINS_PER_PORT + (Pin)), \
+      (volatile uint32*)DIO_BITBAND_ODR((Port) * DIO_PINS_PER_PORT + (Pin)) }
+
+#define DIO_BB_PORT(Port) \
+    DIO_BB_ENTRY(Port, 0),  DIO_BB_ENTRY(Port, 1),  DIO_BB_ENTRY(Port, 2),  DIO_BB_ENTRY(Port, 3),  \
+    DIO_BB_ENTRY(Port, 4),  DIO_BB_ENTRY(Port, 5),  DIO_BB_ENTRY(Port, 6),  DIO_BB_ENTRY(Port, 7),  \
+    DIO_BB_ENTRY(Port, 8),  DIO_BB_ENTRY(Port, 9),  DIO_BB_ENTRY(Port, 10), DIO_BB_ENTRY(Port, 11), \
+    DIO_BB_ENTRY(Port, 12), DIO_BB_ENTRY(Port, 13), DIO_BB_ENTRY(Port, 14), DIO_BB_ENTRY(Port, 15)
+
+const Dio_ChannelBitBandType Dio_ChannelBitBand[DIO_CHANNEL_COUNT] = {
+    DIO_BB_PORT(0),
+    DIO_BB_PORT(1),
+    DIO_BB_PORT(2),
+    DIO_BB_PORT(3)
+};
+
+#endif
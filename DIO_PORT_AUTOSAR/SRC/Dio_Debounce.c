@@ -0,0 +1,126 @@
+/**********************************************************
+ * @file    Dio_Debounce.c
+ * @brief   Chống dội cho cả cổng input bằng bộ đếm dọc (SWAR)
+ * @details count[b] giữ bit b của bộ đếm 4 bit cho từng chân. Chân
+ *          nào đọc khác trạng thái ổn định thì bộ đếm tăng 1 (cộng
+ *          có nhớ theo từng mặt phẳng), chân đọc trùng thì bộ đếm về
+ *          0. Bộ đếm chạm depth: chân lật trạng thái và bộ đếm về 0.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Dio_Debounce.h"
+#include "Det.h"
+#include <stddef.h>
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+typedef struct {
+    uint16 state;                       /* Mức ổn định */
+    uint16 count[DIO_DEBOUNCE_PLANES];  /* Bộ đếm dọc, mặt phẳng bit b */
+    uint16 rising;                      /* Cạnh tích lũy chưa đọc */
+    uint16 falling;
+} Dio_DebounceStateType;
+
+/* Mỗi cổng tối đa một phần tử cấu hình, nên DIO_PORT_COUNT là đủ.
+ * Dio_DebounceInit kiểm tra điều đó trên bảng của ứng dụng; số phần tử
+ * được lọc là 0 cho đến khi bảng hợp lệ. */
+static Dio_DebounceStateType Dio_DebounceState[DIO_PORT_COUNT];
+static uint8 Dio_DebounceCount = 0;
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Dio_DebounceInit(void)
+{
+    uint8 seen = 0;
+
+    /* Bảng viết tay có thể vượt DIO_PORT_COUNT hoặc lặp cổng: từ chối cả
+     * bảng thay vì ghi tràn Dio_DebounceState */
+    Dio_DebounceCount = 0;
+    if (Dio_DebounceConfigCount > DIO_PORT_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_DEBOUNCEINIT_ID, DIO_E_PARAM_CONFIG);
+        return;
+    }
+    for (uint8 i = 0; i < Dio_DebounceConfigCount; i++) {
+        uint8 port = Dio_DebounceConfig[i].port;
+
+        if (port >= DIO_PORT_COUNT || (seen & (1U << port))) {
+            Det_ReportError(DIO_MODULE_ID, 0, DIO_DEBOUNCEINIT_ID, DIO_E_PARAM_CONFIG);
+            return;
+        }
+        seen |= (uint8)(1U << port);
+    }
+
+    for (uint8 i = 0; i < Dio_DebounceConfigCount; i++) {
+        const Dio_DebounceConfigType* cfg = &Dio_DebounceConfig[i];
+        Dio_DebounceStateType* st = &Dio_DebounceState[i];
+
+        st->state = DIO_ReadPort(cfg->port) & cfg->mask;
+        for (uint8 b = 0; b < DIO_DEBOUNCE_PLANES; b++) st->count[b] = 0;
+        st->rising = 0;
+        st->falling = 0;
+    }
+    Dio_DebounceCount = Dio_DebounceConfigCount;
+}
+
+void Dio_DebounceMainFunction(void)
+{
+    for (uint8 i = 0; i < Dio_DebounceCount; i++) {
+        const Dio_DebounceConfigType* cfg = &Dio_DebounceConfig[i];
+        Dio_DebounceStateType* st = &Dio_DebounceState[i];
+        uint16 delta = (DIO_ReadPort(cfg->port) & cfg->mask) ^ st->state;
+        uint16 carry = delta;
+        uint16 toggle = delta;
+        uint32 primask;
+
+        /* count = delta ? count + 1 : 0, đồng thời so sánh count == depth */
+        for (uint8 b = 0; b < DIO_DEBOUNCE_PLANES; b++) {
+            uint16 bit = st->count[b];
+            uint16 depthBit = (uint16)(0U - ((cfg->depth >> b) & 1U));
+            st->count[b] = (bit ^ carry) & delta;
+            carry &= bit;
+            toggle &= (uint16)~(st->count[b] ^ depthBit);
+        }
+
+        for (uint8 b = 0; b < DIO_DEBOUNCE_PLANES; b++) st->count[b] &= (uint16)~toggle;
+        /* Dio_GetDebouncedPort ở mức ưu tiên cao hơn không được chen
+         * giữa đọc và ghi lại rising/falling (cạnh bị báo hai lần) */
+        primask = Dio_IrqSave();
+        st->state ^= toggle;
+        st->rising |= toggle & st->state;
+        st->falling |= toggle & (uint16)~st->state;
+        Dio_IrqRestore(primask);
+    }
+}
+
+Std_ReturnType Dio_GetDebouncedPort(Dio_PortType PortId, Dio_DebouncedPortType* Result)
+{
+    if (Result == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_GETDEBOUNCEDPORT_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    for (uint8 i = 0; i < Dio_DebounceCount; i++) {
+        Dio_DebounceStateType* st = &Dio_DebounceState[i];
+        uint32 primask;
+
+        if (Dio_DebounceConfig[i].port != PortId) continue;
+
+        /* Đọc và xóa cạnh liền một khối: cạnh main function chốt từ task
+         * hay ngắt ưu tiên cao hơn giữa hai bước không bị mất */
+        primask = Dio_IrqSave();
+        Result->State = st->state;
+        Result->Rising = st->rising;
+        Result->Falling = st->falling;
+        st->rising = 0;
+        st->falling = 0;
+        Dio_IrqRestore(primask);
+        return E_OK;
+    }
+    Det_ReportError(DIO_MODULE_ID, 0, DIO_GETDEBOUNCEDPORT_ID, DIO_E_PARAM_INVALID_PORT);
+    return E_NOT_OK;
+}
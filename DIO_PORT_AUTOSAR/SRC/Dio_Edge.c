@@ -0,0 +1,225 @@
+/**********************************************************
+ * @file    Dio_Edge.c
+ * @brief   Báo cạnh lên/xuống của kênh input DIO bằng ngắt EXTI
+ * @details Dùng SPL: GPIO_EXTILineConfig (AFIO->EXTICR), EXTI_Init,
+ *          NVIC_Init. Mọi vector EXTI đi qua Dio_EdgeDispatch: xóa cờ
+ *          pending của từng line rồi gọi callback trong bảng flash.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "stm32f10x.h"
+#include "stm32f10x_exti.h"
+#include "stm32f10x_gpio.h"
+#include "misc.h"
+#include "Dio_Edge.h"
+#include "Tm.h"
+#include "Clk.h"
+#include "Det.h"
+#include <stddef.h>
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Bảng dispatch đang dùng (const, trong flash) */
+static const Dio_EdgeConfigType* Dio_EdgeConfigPtr = NULL;
+
+/* Line thuộc các vector dùng chung */
+#define DIO_EDGE_LINES_9_5      0x03E0UL
+#define DIO_EDGE_LINES_15_10    0xFC00UL
+
+#if (DIO_EDGE_MEASURE_LATENCY == STD_ON)
+static uint32 Dio_EdgeEntryCycles;
+static uint32 Dio_EdgeLatencyLast;
+static uint32 Dio_EdgeLatencyMax;
+#define DIO_EDGE_ISR_ENTRY()    (Dio_EdgeEntryCycles = Tm_GetCycles())
+#else
+#define DIO_EDGE_ISR_ENTRY()    ((void)0)
+#endif
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Vector EXTI của F103: line 0..4 riêng, 5..9 và 10..15 dùng chung */
+#define DIO_EDGE_VECTOR_COUNT   7U
+
+static const IRQn_Type Dio_EdgeVectorIrq[DIO_EDGE_VECTOR_COUNT] = {
+    EXTI0_IRQn, EXTI1_IRQn, EXTI2_IRQn, EXTI3_IRQn, EXTI4_IRQn, EXTI9_5_IRQn, EXTI15_10_IRQn
+};
+
+/* Chỉ số vector (trong Dio_EdgeVectorIrq) phục vụ một line */
+static uint8 Dio_EdgeVector(uint8 line)
+{
+    if (line < 5U) return line;
+    return (line < 10U) ? 5U : 6U;
+}
+
+/**********************************************************
+ * @brief Gọi callback cho mọi line trong Pending
+ * @details 31 - CLZ cho line cao nhất còn pending; mỗi vòng xóa đúng
+ *          một line, nên số vòng bằng số line pending.
+ **********************************************************/
+static void Dio_EdgeDispatch(uint32 Pending)
+{
+    /* Chưa Dio_EdgeInit: line của module khác trên vector dùng chung,
+     * chỉ xóa cờ để ngắt không lặp lại */
+    if (Dio_EdgeConfigPtr == NULL) {
+        EXTI->PR = Pending;
+        return;
+    }
+
+    while (Pending != 0U) {
+        uint32 line = 31U - __CLZ(Pending);
+        const Dio_EdgeLineConfigType* cfg = &Dio_EdgeConfigPtr->Lines[line];
+        Dio_LevelType level;
+
+        Pending &= ~(1UL << line);
+        EXTI->PR = 1UL << line;
+        if (cfg->Notification == NULL) continue;    /* Line do module khác bật */
+
+        if (cfg->Edge == DIO_EDGE_RISING) {
+            level = STD_HIGH;
+        } else if (cfg->Edge == DIO_EDGE_FALLING) {
+            level = STD_LOW;
+        } else {
+            level = (Dio_LevelType)((Dio_ChannelMap[cfg->Channel].port->IDR >> line) & 1UL);
+        }
+
+#if (DIO_EDGE_MEASURE_LATENCY == STD_ON)
+        Dio_EdgeLatencyLast = Tm_GetCycles() - Dio_EdgeEntryCycles;
+        if (Dio_EdgeLatencyLast > Dio_EdgeLatencyMax) Dio_EdgeLatencyMax = Dio_EdgeLatencyLast;
+#endif
+        cfg->Notification(cfg->Channel, level);
+    }
+}
+
+/* Chỉ số line của kênh nếu kênh có trong bảng, DIO_EDGE_LINE_COUNT nếu không */
+static uint8 Dio_EdgeLine(Dio_ChannelType ChannelId)
+{
+    uint8 line = (uint8)(ChannelId % DIO_PINS_PER_PORT);
+
+    if (Dio_EdgeConfigPtr == NULL || ChannelId >= DIO_CHANNEL_COUNT ||
+        Dio_EdgeConfigPtr->Lines[line].Notification == NULL ||
+        Dio_EdgeConfigPtr->Lines[line].Channel != ChannelId) {
+        return DIO_EDGE_LINE_COUNT;
+    }
+    return line;
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Dio_EdgeInit(const Dio_EdgeConfigType* ConfigPtr)
+{
+    EXTI_InitTypeDef EXTI_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    uint8 vectors = 0;  /* Bit n: cần bật Dio_EdgeVectorIrq[n] */
+
+    if (ConfigPtr == NULL) return;
+
+    /* Kiểm tra bảng trước khi bật ngắt: kênh phải nằm đúng line */
+    for (uint8 line = 0; line < DIO_EDGE_LINE_COUNT; line++) {
+        const Dio_EdgeLineConfigType* cfg = &ConfigPtr->Lines[line];
+        if (cfg->Notification != NULL &&
+            (cfg->Channel >= DIO_CHANNEL_COUNT || cfg->Channel % DIO_PINS_PER_PORT != line)) {
+            Det_ReportError(DIO_MODULE_ID, 0, DIO_EDGEINIT_ID, DIO_E_PARAM_INVALID_CHANNEL);
+            return;
+        }
+    }
+    /* AFIO (EXTICR) dùng chung với remap của Port: giữ một tham chiếu */
+    if (Dio_EdgeConfigPtr == NULL) {
+        Clk_Request(CLK_AFIO);
+        Clk_Apply();
+    }
+    Dio_EdgeConfigPtr = ConfigPtr;
+#if (DIO_EDGE_MEASURE_LATENCY == STD_ON)
+    Tm_StartCycleCounter();
+    Dio_EdgeLatencyLast = 0;
+    Dio_EdgeLatencyMax = 0;
+#endif
+
+    for (uint8 line = 0; line < DIO_EDGE_LINE_COUNT; line++) {
+        const Dio_EdgeLineConfigType* cfg = &ConfigPtr->Lines[line];
+        if (cfg->Notification == NULL) continue;
+
+        GPIO_EXTILineConfig((uint8_t)(cfg->Channel / DIO_PINS_PER_PORT), line);
+        EXTI_InitStructure.EXTI_Line = 1UL << line;
+        EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+        EXTI_InitStructure.EXTI_Trigger = (cfg->Edge == DIO_EDGE_RISING) ? EXTI_Trigger_Rising :
+                                          (cfg->Edge == DIO_EDGE_FALLING) ? EXTI_Trigger_Falling :
+                                          EXTI_Trigger_Rising_Falling;
+        EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+        EXTI_Init(&EXTI_InitStructure);
+        EXTI_ClearITPendingBit(1UL << line);
+        vectors |= (uint8)(1U << Dio_EdgeVector(line));
+    }
+
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    for (uint8 n = 0; n < DIO_EDGE_VECTOR_COUNT; n++) {
+        if (vectors & (1U << n)) {
+            NVIC_InitStructure.NVIC_IRQChannel = (uint8_t)Dio_EdgeVectorIrq[n];
+            NVIC_Init(&NVIC_InitStructure);
+        }
+    }
+}
+
+void Dio_EdgeEnableNotification(Dio_ChannelType ChannelId)
+{
+    uint8 line = Dio_EdgeLine(ChannelId);
+
+    if (line >= DIO_EDGE_LINE_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_EDGENOTIFICATION_ID, DIO_E_PARAM_INVALID_CHANNEL);
+        return;
+    }
+    /* Bỏ cạnh cũ xảy ra lúc bị mask */
+    EXTI->PR = 1UL << line;
+    EXTI->IMR |= 1UL << line;
+}
+
+void Dio_EdgeDisableNotification(Dio_ChannelType ChannelId)
+{
+    uint8 line = Dio_EdgeLine(ChannelId);
+
+    if (line >= DIO_EDGE_LINE_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_EDGENOTIFICATION_ID, DIO_E_PARAM_INVALID_CHANNEL);
+        return;
+    }
+    EXTI->IMR &= ~(1UL << line);
+}
+
+#if (DIO_EDGE_MEASURE_LATENCY == STD_ON)
+void Dio_EdgeGetLatency(uint32* Last, uint32* Max)
+{
+    if (Last != NULL) *Last = Dio_EdgeLatencyLast;
+    if (Max != NULL) *Max = Dio_EdgeLatencyMax;
+}
+#endif
+
+/* ===============================
+ *     Interrupt Handlers
+ * =============================== */
+
+void EXTI0_IRQHandler(void)     { DIO_EDGE_ISR_ENTRY(); Dio_EdgeDispatch(EXTI->PR & 0x0001UL); }
+void EXTI1_IRQHandler(void)     { DIO_EDGE_ISR_ENTRY(); Dio_EdgeDispatch(EXTI->PR & 0x0002UL); }
+void EXTI2_IRQHandler(void)     { DIO_EDGE_ISR_ENTRY(); Dio_EdgeDispatch(EXTI->PR & 0x0004UL); }
+void EXTI3_IRQHandler(void)     { DIO_EDGE_ISR_ENTRY(); Dio_EdgeDispatch(EXTI->PR & 0x0008UL); }
+void EXTI4_IRQHandler(void)     { DIO_EDGE_ISR_ENTRY(); Dio_EdgeDispatch(EXTI->PR & 0x0010UL); }
+
+/* Vector dùng chung: bỏ line đang bị mask vẫn có thể pending */
+void EXTI9_5_IRQHandler(void)
+{
+    DIO_EDGE_ISR_ENTRY();
+    Dio_EdgeDispatch(EXTI->PR & EXTI->IMR & DIO_EDGE_LINES_9_5);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+    DIO_EDGE_ISR_ENTRY();
+    Dio_EdgeDispatch(EXTI->PR & EXTI->IMR & DIO_EDGE_LINES_15_10);
+}
@@ -0,0 +1,45 @@
+/**********************************************************
+ * @file    Dio_Lcfg.c
+ * @brief   DIO Driver Configuration Source File
+ * @details File sinh bởi TOOLS/mcal_gen.py từ TOOLS/mcal_config.json,
+ *          không sửa tay: sửa file JSON rồi chạy make config.
+ *          Bảng Dio của ứng dụng: nhóm kênh ảo, bus, chống dội và
+ *          dispatch EXTI. Chân đã được kiểm tra khi sinh (không trùng,
+ *          không thuộc SWJ hay chân Port khác DIO); DIO_VIRTUAL_GROUP
+ *          và DIO_CFG_DEBOUNCE kiểm tra lại lúc biên dịch. Bảng tra
+ *          theo MCU (Dio_ChannelMap...) nằm trong Dio_Cfg.c của libmcal.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Dio_Lcfg.h"
+
+/* Dio_Bus12Group: D0..D11 = PA8, PA9, PA10, PA11, PA12, PA6, PB5, PB6, PB7, PB8, PB9, PB10 */
+const Dio_VirtualGroupType Dio_Bus12Group = DIO_VIRTUAL_GROUP(DIO_PORT_A, DIO_PORT_B,
+    DIO_CHANNEL_A8, DIO_CHANNEL_A9, DIO_CHANNEL_A10, DIO_CHANNEL_A11, DIO_CHANNEL_A12, DIO_CHANNEL_A6,
+    DIO_CHANNEL_B5, DIO_CHANNEL_B6, DIO_CHANNEL_B7, DIO_CHANNEL_B8, DIO_CHANNEL_B9, DIO_CHANNEL_B10);
+
+/* Dio_LcdBus: 8080, D0..D7 = PC0, PC1, PC2, PC3, PC4, PC5, PC6, PC7, WR = PC8, RD = PC9 */
+const Dio_BusType Dio_LcdBus = DIO_BUS_8080(DIO_CHANNEL_C8, DIO_CHANNEL_C9,
+    DIO_CHANNEL_C0, DIO_CHANNEL_C1, DIO_CHANNEL_C2, DIO_CHANNEL_C3,
+    DIO_CHANNEL_C4, DIO_CHANNEL_C5, DIO_CHANNEL_C6, DIO_CHANNEL_C7);
+
+/* Dio_LatchBus: 6800, D0..D7 = PD10, PD11, PD12, PD3, PD4, PD5, PD6, PD7, E = PA4, R/W = PA5 */
+const Dio_BusType Dio_LatchBus = DIO_BUS_6800(DIO_CHANNEL_A4, DIO_CHANNEL_A5,
+    DIO_CHANNEL_D10, DIO_CHANNEL_D11, DIO_CHANNEL_D12, DIO_CHANNEL_D3,
+    DIO_CHANNEL_D4, DIO_CHANNEL_D5, DIO_CHANNEL_D6, DIO_CHANNEL_D7);
+
+const Dio_DebounceConfigType Dio_DebounceConfig[DIO_DEBOUNCE_PORT_COUNT] = {
+    DIO_CFG_DEBOUNCE(DIO_PORT_B, 0xE806U, 8U),  /* PB1, PB2, PB11, PB13, PB14, PB15 */
+    DIO_CFG_DEBOUNCE(DIO_PORT_C, 0xDC00U, 4U)   /* PC10, PC11, PC12, PC14, PC15 */
+};
+
+const uint8 Dio_DebounceConfigCount = DIO_DEBOUNCE_PORT_COUNT;
+
+/* Bảng dispatch EXTI, chỉ số là số line (= số chân) */
+const Dio_EdgeConfigType DioEdgeConfig = {
+    .Lines = {
+        [12] = { DIO_CHANNEL_B12, DIO_EDGE_FALLING, Dio_Button_Notification }
+    }
+};
@@ -0,0 +1,247 @@
+/**********************************************************
+ * @file    Dio_Stream.c
+ * @brief   Phát dạng sóng GPIO bằng DMA, nhịp do timer quyết định
+ * @details Timer sinh update event -> DMA1 chép một word từ buffer
+ *          vào GPIOx->BSRR. Dùng SPL (stm32f10x_dma.c, stm32f10x_tim.c,
+ *          misc.c). Chế độ double buffer dùng circular + ngắt nửa
+ *          buffer (HT) và hết buffer (TC) vì DMA của F103 không có
+ *          chế độ hai buffer phần cứng.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "stm32f10x.h"
+#include "stm32f10x_dma.h"
+#include "stm32f10x_tim.h"
+#include "misc.h"
+#include "Dio_Stream.h"
+#include "Det.h"
+#include "Clk.h"
+#include <stddef.h>
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Tài nguyên phần cứng cố định của mỗi timer */
+typedef struct {
+    TIM_TypeDef*         TIMx;
+    Clk_PeripheralType   clock;     /* Định danh clock của timer trong Clk */
+    DMA_Channel_TypeDef* channel;   /* Kênh DMA1 nhận yêu cầu TIMx_UP */
+    uint32               itGL;      /* Cờ ngắt của kênh trong DMA1->ISR */
+    uint32               itTC;
+    uint32               itHT;
+    IRQn_Type            irq;
+} Dio_StreamHwType;
+
+#define DIO_STREAM_COUNT    4U
+
+static const Dio_StreamHwType Dio_StreamHw[DIO_STREAM_COUNT] = {
+    { TIM1, CLK_TIM1, DMA1_Channel5, DMA1_IT_GL5, DMA1_IT_TC5, DMA1_IT_HT5, DMA1_Channel5_IRQn },
+    { TIM2, CLK_TIM2, DMA1_Channel2, DMA1_IT_GL2, DMA1_IT_TC2, DMA1_IT_HT2, DMA1_Channel2_IRQn },
+    { TIM3, CLK_TIM3, DMA1_Channel3, DMA1_IT_GL3, DMA1_IT_TC3, DMA1_IT_HT3, DMA1_Channel3_IRQn },
+    { TIM4, CLK_TIM4, DMA1_Channel7, DMA1_IT_GL7, DMA1_IT_TC7, DMA1_IT_HT7, DMA1_Channel7_IRQn }
+};
+
+/* Trạng thái stream đang chạy, cùng chỉ số với Dio_StreamHw */
+typedef struct {
+    const uint32*              buffer;
+    uint16                     length;
+    const Dio_StreamTimerType* timer;   /* NULL: không chạy */
+    boolean                    clockHeld; /* Đang giữ clock DMA1 + timer */
+} Dio_StreamStateType;
+
+static Dio_StreamStateType Dio_StreamState[DIO_STREAM_COUNT];
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Tìm chỉ số stream theo timer, trả về DIO_STREAM_COUNT nếu không hỗ trợ */
+static uint8 Dio_StreamIndex(const TIM_TypeDef* TIMx)
+{
+    uint8 idx = 0;
+    while (idx < DIO_STREAM_COUNT && Dio_StreamHw[idx].TIMx != TIMx) idx++;
+    return idx;
+}
+
+/* Dừng timer và kênh DMA của một stream */
+static void Dio_StreamHalt(uint8 idx)
+{
+    const Dio_StreamHwType* hw = &Dio_StreamHw[idx];
+
+    TIM_Cmd(hw->TIMx, DISABLE);
+    TIM_DMACmd(hw->TIMx, TIM_DMA_Update, DISABLE);
+    DMA_Cmd(hw->channel, DISABLE);
+    DMA_ClearITPendingBit(hw->itGL);
+    Dio_StreamState[idx].timer = NULL;
+}
+
+/**********************************************************
+ * @brief Xử lý ngắt DMA chung cho mọi stream
+ * @details HT: nửa đầu đã phát xong. TC: nửa sau (circular/double)
+ *          hoặc cả buffer (oneshot, stream tự dừng) đã phát xong.
+ **********************************************************/
+static void Dio_StreamIrq(uint8 idx)
+{
+    const Dio_StreamHwType* hw = &Dio_StreamHw[idx];
+    Dio_StreamStateType* st = &Dio_StreamState[idx];
+    const Dio_StreamTimerType* timer = st->timer;
+    uint16 half = (uint16)(st->length / 2U);
+
+    if (timer == NULL) {
+        DMA_ClearITPendingBit(hw->itGL);
+        return;
+    }
+
+    if (DMA_GetITStatus(hw->itHT) != RESET) {
+        DMA_ClearITPendingBit(hw->itHT);
+        if (timer->HalfCallback != NULL) {
+            timer->HalfCallback(st->buffer, half);
+        }
+    }
+
+    if (DMA_GetITStatus(hw->itTC) != RESET) {
+        DMA_ClearITPendingBit(hw->itTC);
+        if (timer->mode == DIO_STREAM_ONESHOT) {
+            Dio_StreamHalt(idx);
+            if (timer->CompleteCallback != NULL) {
+                timer->CompleteCallback(st->buffer, st->length);
+            }
+        } else if (timer->CompleteCallback != NULL) {
+            timer->CompleteCallback(st->buffer + half, (uint16)(st->length - half));
+        }
+    }
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+Std_ReturnType Dio_StreamStart(Dio_PortType PortId, const uint32* Buffer, uint16 Length,
+                               const Dio_StreamTimerType* Timer)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+    TIM_TimeBaseInitTypeDef TIM_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    const Dio_StreamHwType* hw;
+    uint32 interrupts = 0;
+    uint8 idx;
+
+    if (PortId >= DIO_PORT_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STREAMSTART_ID, DIO_E_PARAM_INVALID_PORT);
+        return E_NOT_OK;
+    }
+    if (Buffer == NULL || Timer == NULL) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STREAMSTART_ID, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    idx = Dio_StreamIndex(Timer->TIMx);
+    if (idx >= DIO_STREAM_COUNT) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STREAMSTART_ID, DIO_E_PARAM_INVALID_TIMER);
+        return E_NOT_OK;
+    }
+    if (Length == 0U || (Timer->mode == DIO_STREAM_DOUBLE_BUFFER && (Length & 1U) != 0U)) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STREAMSTART_ID, DIO_E_PARAM_INVALID_LENGTH);
+        return E_NOT_OK;
+    }
+
+    hw = &Dio_StreamHw[idx];
+    if (Clk_Claim(hw->clock, CLK_OWNER_DIO_STREAM) != E_OK) {
+        Det_ReportError(DIO_MODULE_ID, 0, DIO_STREAMSTART_ID, DIO_E_TIMER_IN_USE);
+        return E_NOT_OK;
+    }
+    if (Dio_StreamState[idx].timer != NULL) {
+        Dio_StreamHalt(idx);
+    }
+    Dio_StreamState[idx].buffer = Buffer;
+    Dio_StreamState[idx].length = Length;
+    Dio_StreamState[idx].timer = Timer;
+
+    /* Giữ clock DMA1 và timer đến Dio_StreamStop (oneshot tự dừng trong
+     * ngắt vẫn giữ, vì Clk chỉ được gọi từ task) */
+    if (!Dio_StreamState[idx].clockHeld) {
+        Clk_Request(CLK_DMA1);
+        Clk_Request(hw->clock);
+        Dio_StreamState[idx].clockHeld = TRUE;
+        Clk_Apply();
+    }
+
+    /* DMA: buffer (tăng địa chỉ) -> BSRR (cố định), mỗi lần một word */
+    DMA_DeInit(hw->channel);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&Dio_PortMap[PortId]->BSRR;
+    DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)Buffer;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+    DMA_InitStructure.DMA_BufferSize = Length;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+    DMA_InitStructure.DMA_Mode = (Timer->mode == DIO_STREAM_ONESHOT) ? DMA_Mode_Normal : DMA_Mode_Circular;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(hw->channel, &DMA_InitStructure);
+
+    /* Chỉ bật ngắt khi thật sự cần: circular không callback chạy 0% CPU */
+    if (Timer->HalfCallback != NULL) {
+        interrupts |= DMA_IT_HT;
+    }
+    if (Timer->CompleteCallback != NULL || Timer->mode == DIO_STREAM_ONESHOT) {
+        interrupts |= DMA_IT_TC;
+    }
+    if (interrupts != 0U) {
+        DMA_ITConfig(hw->channel, interrupts, ENABLE);
+        NVIC_InitStructure.NVIC_IRQChannel = (uint8_t)hw->irq;
+        NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+        NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+        NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+        NVIC_Init(&NVIC_InitStructure);
+    }
+
+    /* Timer: mỗi update event là một yêu cầu DMA */
+    TIM_InitStructure.TIM_Prescaler = Timer->prescaler;
+    TIM_InitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_InitStructure.TIM_Period = Timer->period;
+    TIM_InitStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM_InitStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(hw->TIMx, &TIM_InitStructure);
+    TIM_DMACmd(hw->TIMx, TIM_DMA_Update, ENABLE);
+
+    DMA_Cmd(hw->channel, ENABLE);
+    TIM_Cmd(hw->TIMx, ENABLE);
+    return E_OK;
+}
+
+void Dio_StreamStop(TIM_TypeDef* TIMx)
+{
+    uint8 idx = Dio_StreamIndex(TIMx);
+
+    if (idx >= DIO_STREAM_COUNT) return;
+    if (Dio_StreamState[idx].timer != NULL) {
+        Dio_StreamHalt(idx);
+    }
+    if (Dio_StreamState[idx].clockHeld) {
+        Clk_Release(CLK_DMA1);
+        Clk_Release(Dio_StreamHw[idx].clock);
+        Dio_StreamState[idx].clockHeld = FALSE;
+        Clk_Apply();
+    }
+    Clk_Unclaim(Dio_StreamHw[idx].clock, CLK_OWNER_DIO_STREAM);
+}
+
+boolean Dio_StreamIsBusy(TIM_TypeDef* TIMx)
+{
+    uint8 idx = Dio_StreamIndex(TIMx);
+
+    return (boolean)(idx < DIO_STREAM_COUNT && Dio_StreamState[idx].timer != NULL);
+}
+
+/* ===============================
+ *     Interrupt Handlers
+ * =============================== */
+
+void DMA1_Channel5_IRQHandler(void) { Dio_StreamIrq(0); }   /* TIM1_UP */
+void DMA1_Channel2_IRQHandler(void) { Dio_StreamIrq(1); }   /* TIM2_UP */
+void DMA1_Channel3_IRQHandler(void) { Dio_StreamIrq(2); }   /* TIM3_UP */
+void DMA1_Channel7_IRQHandler(void) { Dio_StreamIrq(3); }   /* TIM4_UP */
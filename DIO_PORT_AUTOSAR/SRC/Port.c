@@ -14,9 +14,10 @@
  *           Includes
  * =============================== */
 #include "Port.h"
-#include "Portconfig.h"
-#include "stm32f10x_rcc.h"
+#include "Clk.h"
+#include "Det.h"
 #include <stddef.h>
+#include <string.h>
 #include "stm32f10x.h"
 #include"stm32f10x_gpio.h"
 
@@ -25,116 +26,592 @@
  * =============================== */
 static uint8_t Port_Initialized = 0;  /* Biến trạng thái xác định Port đã init chưa */
 
+static GPIO_TypeDef* const Port_Gpio[PORT_COUNT] = { GPIOA, GPIOB, GPIOC, GPIOD };
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#define PORT_DET_REPORT(ApiId, ErrorId)   Det_ReportError(PORT_MODULE_ID, 0, (ApiId), (ErrorId))
+#else
+#define PORT_DET_REPORT(ApiId, ErrorId)   ((void)0)
+#endif
+
+/**********************************************************
+ * Bảng tra (mode, direction, pull, speed) -> hành động trên thanh ghi
+ * - bit 3..0: nibble CNF[1:0]:MODE[1:0] ghi vào CRL/CRH
+ * - PORT_LUT_ODR_SET/RESET: input có pull, ODR chọn hướng pull
+ * Quy tắc giữ như khi còn gọi GPIO_Init: output DIO pull-up là
+ * push-pull, còn lại open-drain; PWM là AF push-pull. ADC là analog
+ * input; SPI/CAN/LIN: chân ra (SCK, MOSI, TX) AF push-pull, chân vào
+ * (MISO, RX) là input như DIO; AF_OD là AF open-drain cả hai chiều.
+ **********************************************************/
+#define PORT_LUT_ODR_SET        0x10U
+#define PORT_LUT_ODR_RESET      0x20U
+
+#define PORT_SPEED_MODE(s) \
+    ((s) == PORT_SPEED_10Mhz ? GPIO_Speed_10MHz : (s) == PORT_SPEED_50Mhz ? GPIO_Speed_50MHz : GPIO_Speed_2MHz)
+
+#define PORT_LUT_INPUT(p)                                                                   \
+    ((p) == PORT_PIN_PULL_UP   ? (PORT_CNF_IN_PULL | PORT_LUT_ODR_SET) :                    \
+     (p) == PORT_PIN_PULL_DOWN ? (PORT_CNF_IN_PULL | PORT_LUT_ODR_RESET) :                  \
+                                 PORT_CNF_IN_FLOATING)
+
+#define PORT_LUT_ENTRY(m, d, p, s)                                                          \
+    ((m) == PORT_PIN_MODE_DIO ?                                                             \
+        ((d) == PORT_PIN_OUT ?                                                              \
+            (((p) == PORT_PIN_PULL_UP ? PORT_CNF_OUT_PP : PORT_CNF_OUT_OD) | PORT_SPEED_MODE(s)) : \
+            PORT_LUT_INPUT(p)) :                                                            \
+     (m) == PORT_PIN_MODE_ADC   ? PORT_CNF_IN_ANALOG :                                      \
+     (m) == PORT_PIN_MODE_PWM   ? (PORT_CNF_AF_PP | PORT_SPEED_MODE(s)) :                   \
+     (m) == PORT_PIN_MODE_AF_OD ? (PORT_CNF_AF_OD | PORT_SPEED_MODE(s)) :                   \
+     (d) == PORT_PIN_OUT        ? (PORT_CNF_AF_PP | PORT_SPEED_MODE(s)) :                   \
+                                  PORT_LUT_INPUT(p))
+
+#define PORT_LUT_S(m, d, p) PORT_LUT_ENTRY(m, d, p, 0), PORT_LUT_ENTRY(m, d, p, 1), PORT_LUT_ENTRY(m, d, p, 2)
+#define PORT_LUT_P(m, d)    PORT_LUT_S(m, d, 0), PORT_LUT_S(m, d, 1), PORT_LUT_S(m, d, 2)
+#define PORT_LUT_M(m)       PORT_LUT_P(m, PORT_PIN_IN), PORT_LUT_P(m, PORT_PIN_OUT)
+
+#define PORT_LUT_INDEX(m, d, p, s)  (((((m) * 2U + (d)) * 3U) + (p)) * 3U + (s))
+
+static const uint8_t Port_NibbleLut[PORT_PIN_MODE_COUNT * 2U * 3U * 3U] = {
+    PORT_LUT_M(PORT_PIN_MODE_DIO), PORT_LUT_M(PORT_PIN_MODE_ADC), PORT_LUT_M(PORT_PIN_MODE_PWM),
+    PORT_LUT_M(PORT_PIN_MODE_SPI), PORT_LUT_M(PORT_PIN_MODE_CAN), PORT_LUT_M(PORT_PIN_MODE_LIN),
+    PORT_LUT_M(PORT_PIN_MODE_AF_OD)
+};
+
+/**********************************************************
+ * Trạng thái runtime của từng pin (RAM), chép từ config trong Port_Init
+ * Chỉ số trùng với chỉ số pin trong Port_ConfigType::PinConfigs.
+ * PortNum = PORT_COUNT đánh dấu dòng config không hợp lệ.
+ * Chỉ giữ trường API runtime cần; Level/SleepKeep/SafeState chỉ dùng
+ * khi dựng ảnh nên Port_BuildImages đọc thẳng từ config.
+ **********************************************************/
+typedef struct {
+    uint8_t PortNum;
+    uint8_t PinNum;
+    uint8_t Mode;
+    uint8_t Direction;
+    uint8_t Pull;
+    uint8_t Speed;
+    uint8_t Changeable;     /* PORT_CHANGE_DIRECTION | PORT_CHANGE_MODE */
+} Port_PinStateType;
+
+#define PORT_CHANGE_DIRECTION   0x01U
+#define PORT_CHANGE_MODE        0x02U
+
+static Port_PinStateType Port_PinState[PORT_MAX_PINS];
+static uint16_t Port_PinCount = 0;
+
+/* Ảnh thanh ghi từng cổng (Port_ImageType). Crl/Crh được Port_PatchPin
+ * cập nhật theo, nên luôn là giá trị mong đợi. */
+static Port_ImageType Port_Images[PORT_COUNT];
+
+static uint32_t Port_DriftCount[PORT_COUNT];   /* Số nibble đã sửa, theo cổng */
+
+static uint16_t Port_Locked[PORT_COUNT];       /* Pin đã khóa bằng LCKR, giữ đến khi reset */
+
+static uint8_t Port_ClockHeld = 0;    /* Bit p = 1: Port giữ clock GPIO của cổng p */
+
+static uint32_t Port_Mapr = 0;        /* Giá trị AFIO_MAPR Port ghi lần cuối (reset: 0) */
+static uint8_t Port_AfioHeld = 0;     /* Port giữ clock AFIO khi có remap/SWJ khác reset */
+
+/* CRL/CRH/ODR đọc lúc rời PORT_PROFILE_ACTIVE; Driven: pin profile đã
+ * lái ODR, được trả mức cũ khi về ACTIVE */
+typedef struct {
+    uint32_t Crl;
+    uint32_t Crh;
+    uint32_t Odr;
+    uint16_t Driven;
+} Port_ActiveSaveType;
+
+static Port_ActiveSaveType Port_ActiveSave[PORT_COUNT];
+static Port_ProfileType Port_Profile = PORT_PROFILE_ACTIVE;
+
 /* ===============================
  *      Internal Helper Function
  * =============================== */
 
+/* Phần tử bảng tra ứng với trạng thái hiện tại của pin */
+static inline uint8_t Port_PinLut(const Port_PinStateType* st) {
+    return Port_NibbleLut[PORT_LUT_INDEX(st->Mode, st->Direction, st->Pull, st->Speed)];
+}
+
 /**********************************************************
- * @brief Cấu hình 1 pin GPIO dựa trên thông số AUTOSAR
- * @param[in] pinCfg Con trỏ đến cấu trúc cấu hình pin
+ * @brief Vá nibble CRL/CRH của một pin theo trạng thái runtime
+ * @details Một lần đọc-ghi CRL/CRH; input có pull thêm một lệnh ghi
+ *          BSRR để chọn hướng pull. Output giữ nguyên ODR (mức do Dio
+ *          ghi gần nhất). Clock của cổng đã được Port_Init giữ qua Clk.
+ *          Ảnh của cổng được cập nhật để refresh không đảo lại thay đổi.
+ * @param[in] st Trạng thái pin trong Port_PinState
  **********************************************************/
-static void Port_ApplyPinConfig(const Port_PinConfigType* pinCfg) {
-    GPIO_InitTypeDef GPIO_InitStruct;
-    uint16_t pinMask = PORT_GET_PIN_MASK(pinCfg->PinNum);
+static void Port_PatchPin(const Port_PinStateType* st) {
+    GPIO_TypeDef* port = Port_Gpio[st->PortNum];
+    Port_ImageType* img = &Port_Images[st->PortNum];
+    volatile uint32_t* cr = (st->PinNum < 8) ? &port->CRL : &port->CRH;
+    uint32_t* image = (st->PinNum < 8) ? &img->Crl : &img->Crh;
+    uint32_t shift = (st->PinNum & 7U) * 4U;
+    uint8_t lut = Port_PinLut(st);
+
+    *image = (*image & ~(0xFUL << shift)) | ((uint32_t)(lut & 0xFU) << shift);
 
-    /* Kích hoạt clock cho PORT */
-    switch (pinCfg->PortNum) {
-        case PORT_ID_A: RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE); break;
-        case PORT_ID_B: RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE); break;
-        case PORT_ID_C: RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC, ENABLE); break;
-        case PORT_ID_D: RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOD, ENABLE); break;
-        default: return;
+    /* ODR trước, rồi mới đổi mode: pull đúng hướng ngay khi thành input */
+    if (lut & PORT_LUT_ODR_SET) {
+        port->BSRR = PORT_GET_PIN_MASK(st->PinNum);
+    } else if (lut & PORT_LUT_ODR_RESET) {
+        port->BSRR = PORT_GET_PIN_MASK(st->PinNum) << 16;
     }
+    *cr = (*cr & ~(0xFUL << shift)) | ((uint32_t)(lut & 0xFU) << shift);
+}
+
+/**********************************************************
+ * @brief Chép bảng config vào Port_PinState, chuẩn hóa giá trị
+ * @details Speed/Pull ngoài miền về mặc định (2MHz, không pull) như
+ *          trước đây; PortNum/PinNum/Mode ngoài miền làm dòng đó vô hiệu.
+ * @param[in] ConfigPtr Con trỏ đến cấu hình Port
+ **********************************************************/
+static void Port_LoadPins(const Port_ConfigType* ConfigPtr) {
+    Port_PinCount = (ConfigPtr->PinCount < PORT_MAX_PINS) ? ConfigPtr->PinCount : PORT_MAX_PINS;
+
+    for (uint16_t i = 0; i < Port_PinCount; i++) {
+        const Port_PinConfigType* pinCfg = &ConfigPtr->PinConfigs[i];
+        Port_PinStateType* st = &Port_PinState[i];
 
-    GPIO_InitStruct.GPIO_Pin = pinMask;
-        /* Cấu hình tốc độ chân GPIO */
-    switch(pinCfg->Speed) {
-        case PORT_SPEED_2Mhz: GPIO_InitStruct.GPIO_Speed = GPIO_Speed_2MHz;   break;
-        case PORT_SPEED_10Mhz: GPIO_InitStruct.GPIO_Speed = GPIO_Speed_10MHz; break;
-        case PORT_SPEED_50Mhz: GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz; break;
-        default: GPIO_InitStruct.GPIO_Speed = GPIO_Speed_2MHz; break; // Mặc định 2MHz
+        st->PortNum = pinCfg->PortNum;
+        st->PinNum = pinCfg->PinNum;
+        st->Mode = pinCfg->Mode;
+        st->Direction = (pinCfg->Direction == PORT_PIN_OUT) ? PORT_PIN_OUT : PORT_PIN_IN;
+        st->Pull = (pinCfg->Pull <= PORT_PIN_PULL_DOWN) ? pinCfg->Pull : PORT_PIN_PULL_NONE;
+        st->Speed = (pinCfg->Speed <= PORT_SPEED_50Mhz) ? pinCfg->Speed : PORT_SPEED_2Mhz;
+        st->Changeable = (uint8_t)((pinCfg->DirectionChangeable ? PORT_CHANGE_DIRECTION : 0U) |
+                                   (pinCfg->ModeChangeable ? PORT_CHANGE_MODE : 0U));
+
+        if (st->PortNum >= PORT_COUNT || st->PinNum > 15 || st->Mode >= PORT_PIN_MODE_COUNT) {
+            st->PortNum = PORT_COUNT;
+            st->Changeable = 0;
+        }
     }
+}
+
+/* Bit i của nửa cổng (8 pin) -> nibble i (0xF) */
+static inline uint32_t Port_NibbleMask(uint32_t bits) {
+    bits = (bits | (bits << 12)) & 0x000F000FUL;
+    bits = (bits | (bits << 6)) & 0x03030303UL;
+    bits = (bits | (bits << 3)) & 0x11111111UL;
+    return bits * 0xFU;
+}
+
+/* Nibble output push-pull 2MHz của pin SAFE_LOW/SAFE_HIGH */
+#define PORT_SAFE_DRIVE_NIBBLES (0x11111111UL * (PORT_CNF_OUT_PP | GPIO_Speed_2MHz))
+
+/* Bit pin trong mask Keep của Port_BuildImages theo PORT_SAFE_xxx (nửa cao:
+ * SAFE giữ nibble) và trong BSRR của ảnh SAFE (nửa thấp set, nửa cao reset) */
+static const uint32_t Port_SafeKeepBit[PORT_SAFE_HIGH + 1] = { [PORT_SAFE_KEEP] = 0x10000UL };
+static const uint32_t Port_SafeDriveBit[PORT_SAFE_HIGH + 1] = {
+    [PORT_SAFE_LOW] = 0x10000UL, [PORT_SAFE_HIGH] = 0x1UL
+};
+
+/**********************************************************
+ * @brief Dựng ảnh profile SLEEP và SAFE của một cổng từ mask pin
+ * @details SLEEP: pin SleepKeep giữ nibble, còn lại analog (nibble 0).
+ *          SAFE: KEEP giữ nibble; LOW/HIGH là output push-pull 2MHz,
+ *          mức đã nằm sẵn trong safe->Bsrr; ANALOG là nibble 0.
+ * @param[in,out] img  Ảnh cổng, Profiles[SAFE].Bsrr đã gom xong
+ * @param[in]     keep Nửa thấp: pin giữ ở SLEEP, nửa cao: pin giữ ở SAFE
+ **********************************************************/
+static void Port_BuildProfiles(Port_ImageType* img, uint32_t keep) {
+    Port_ProfileImageType* sleep = &img->Profiles[PORT_PROFILE_SLEEP - 1U];
+    Port_ProfileImageType* safe = &img->Profiles[PORT_PROFILE_SAFE - 1U];
+    uint32_t drive = (safe->Bsrr | (safe->Bsrr >> 16)) & 0xFFFFU;
+
+    sleep->CrlKeep = Port_NibbleMask(keep & 0xFFU);
+    sleep->CrhKeep = Port_NibbleMask((keep >> 8) & 0xFFU);
+    safe->CrlKeep = Port_NibbleMask((keep >> 16) & 0xFFU);
+    safe->CrhKeep = Port_NibbleMask(keep >> 24);
+    safe->Crl = Port_NibbleMask(drive & 0xFFU) & PORT_SAFE_DRIVE_NIBBLES;
+    safe->Crh = Port_NibbleMask(drive >> 8) & PORT_SAFE_DRIVE_NIBBLES;
+}
+
+/**********************************************************
+ * @brief Dựng ảnh CRL/CRH/ODR của từng cổng từ Port_PinState
+ * @details Mức ban đầu (Level) và SleepKeep/SafeState lấy từ dòng
+ *          config cùng chỉ số. Ảnh profile SLEEP/SAFE: vòng lặp chỉ gom
+ *          mask pin, nibble dựng một lần mỗi cổng sau đó.
+ * @param[in] ConfigPtr Con trỏ đến cấu hình Port
+ * @return Mask cổng có dùng (bit p = cổng p)
+ **********************************************************/
+static uint8_t Port_BuildImages(const Port_ConfigType* ConfigPtr) {
+    uint32_t keep[PORT_COUNT] = { 0 };
+    uint8_t used = 0;
 
-    /* Cấu hình mode - chỉ lấy ví dụ mode DIO */
-    switch(pinCfg->Mode) {
-    case  PORT_PIN_MODE_DIO: 
-        if (pinCfg->Direction == PORT_PIN_OUT) { // output
-            GPIO_InitStruct.GPIO_Mode = (pinCfg->Pull == PORT_PIN_PULL_UP) ? GPIO_Mode_Out_PP : GPIO_Mode_Out_OD;
+    memset(Port_Images, 0, sizeof(Port_Images));
+
+    for (uint16_t i = 0; i < Port_PinCount; i++) {
+        const Port_PinStateType* st = &Port_PinState[i];
+        const Port_PinConfigType* pinCfg = &ConfigPtr->PinConfigs[i];
+        Port_ImageType* img;
+        uint32_t shift;
+        uint32_t both;
+        uint8_t safeState;
+        uint8_t lut;
+
+        if (st->PortNum >= PORT_COUNT) continue;
+        img = &Port_Images[st->PortNum];
+        shift = (st->PinNum & 7U) * 4U;
+        lut = Port_PinLut(st);
+
+        /* Pin cấu hình lại ở dòng sau thắng, như khi gọi GPIO_Init tuần tự */
+        if (st->PinNum < 8) {
+            img->Crl = (img->Crl & ~(0xFUL << shift)) | ((uint32_t)(lut & 0xFU) << shift);
+            img->CrlMask |= 0xFUL << shift;
+            if (!(st->Changeable & PORT_CHANGE_DIRECTION)) img->CrlCheck |= 0xFUL << shift;
+            else img->CrlCheck &= ~(0xFUL << shift);
         } else {
-            if (pinCfg->Pull == PORT_PIN_PULL_UP)
-                GPIO_InitStruct.GPIO_Mode = GPIO_Mode_IPU;
-            else if (pinCfg->Pull == PORT_PIN_PULL_DOWN)
-                GPIO_InitStruct.GPIO_Mode = GPIO_Mode_IPD;
-            else
-                GPIO_InitStruct.GPIO_Mode = GPIO_Mode_IN_FLOATING;
+            img->Crh = (img->Crh & ~(0xFUL << shift)) | ((uint32_t)(lut & 0xFU) << shift);
+            img->CrhMask |= 0xFUL << shift;
+            if (!(st->Changeable & PORT_CHANGE_DIRECTION)) img->CrhCheck |= 0xFUL << shift;
+            else img->CrhCheck &= ~(0xFUL << shift);
+        }
+
+        /* Mức ban đầu: output theo Level, input có pull theo hướng pull */
+        if (st->Direction == PORT_PIN_OUT) {
+            lut = (pinCfg->Level == PORT_PIN_LEVEL_HIGH) ? PORT_LUT_ODR_SET : PORT_LUT_ODR_RESET;
+        }
+        both = 0x10001UL << st->PinNum;
+        if (lut & (PORT_LUT_ODR_SET | PORT_LUT_ODR_RESET)) {
+            img->Bsrr &= ~both;
+            img->Bsrr |= PORT_GET_PIN_MASK(st->PinNum) << ((lut & PORT_LUT_ODR_SET) ? 0 : 16);
         }
-        break;
-    case PORT_PIN_MODE_PWM: GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF_PP;
-        break;
-    case PORT_PIN_MODE_SPI: GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF_PP;
-        break;
+
+        /* Profile: mask giữ nibble và BSRR của SAFE, giá trị ngoài miền là ANALOG */
+        safeState = (pinCfg->SafeState <= PORT_SAFE_HIGH) ? pinCfg->SafeState : PORT_SAFE_ANALOG;
+        keep[st->PortNum] = (keep[st->PortNum] & ~both) |
+                            (((pinCfg->SleepKeep != 0U) | Port_SafeKeepBit[safeState]) << st->PinNum);
+        img->Profiles[PORT_PROFILE_SAFE - 1U].Bsrr =
+            (img->Profiles[PORT_PROFILE_SAFE - 1U].Bsrr & ~both) | (Port_SafeDriveBit[safeState] << st->PinNum);
+
+        img->Pins |= PORT_GET_PIN_MASK(st->PinNum);
+        used |= (uint8_t)(1U << st->PortNum);
     }
 
-    /* Các mode khác như ADC, PWM, SPI ... mở rộng thêm tùy MCU */
+    for (uint8_t ports = used; ports != 0; ports &= (uint8_t)(ports - 1U)) {
+        uint8_t p = (uint8_t)__builtin_ctz(ports);
+        Port_BuildProfiles(&Port_Images[p], keep[p]);
+    }
+    return used;
+}
+
+/**********************************************************
+ * @brief Chép ảnh sinh sẵn của Port_ConfigType vào Port_Images
+ * @return Mask cổng có dùng (bit p = cổng p)
+ **********************************************************/
+static uint8_t Port_LoadImages(const Port_ImageType* images) {
+    uint8_t used = 0;
+
+    for (uint8_t p = 0; p < PORT_COUNT; p++) {
+        Port_Images[p] = images[p];
+        if (images[p].Pins != 0) used |= (uint8_t)(1U << p);
+    }
+    return used;
+}
 
-    /* Khởi tạo chân */
-    GPIO_Init(PORT_GET_PORT(pinCfg->PortNum), &GPIO_InitStruct);
+/**********************************************************
+ * @brief Bỏ pin đã khóa LCKR khỏi mask refresh
+ * @details CRL/CRH của pin khóa không ghi được nữa nên không cần so;
+ *          ở mọi profile pin khóa giữ cấu hình active.
+ **********************************************************/
+static void Port_UncheckLocked(void) {
+    for (uint8_t p = 0; p < PORT_COUNT; p++) {
+        uint32_t crl, crh;
 
-    /* Nếu là output, set level ban đầu */
-    if (pinCfg->Direction == PORT_PIN_OUT) {
-        if (pinCfg->Level == PORT_PIN_LEVEL_HIGH)
-            GPIO_SetBits(PORT_GET_PORT(pinCfg->PortNum), pinMask);
-        else
-            GPIO_ResetBits(PORT_GET_PORT(pinCfg->PortNum), pinMask);
+        if (Port_Locked[p] == 0) continue;
+        crl = Port_NibbleMask(Port_Locked[p] & 0xFFU);
+        crh = Port_NibbleMask((uint32_t)Port_Locked[p] >> 8);
+        Port_Images[p].CrlCheck &= ~crl;
+        Port_Images[p].CrhCheck &= ~crh;
+        for (uint8_t i = 0; i < PORT_PROFILE_COUNT - 1U; i++) {
+            Port_ProfileImageType* prof = &Port_Images[p].Profiles[i];
+            prof->CrlKeep |= crl;
+            prof->Crl &= ~crl;
+            prof->CrhKeep |= crh;
+            prof->Crh &= ~crh;
+        }
     }
 }
 
+/**********************************************************
+ * @brief Ghi một thanh ghi CRL/CRH theo ảnh
+ * @details Nửa cổng cấu hình đủ 8 pin được ghi thẳng, không cần đọc.
+ **********************************************************/
+static inline void Port_WriteCr(volatile uint32_t* cr, uint32_t image, uint32_t mask) {
+    if (mask == 0) return;
+    *cr = (mask == 0xFFFFFFFFUL) ? image : ((*cr & ~mask) | image);
+}
+
+/**********************************************************
+ * @brief So một thanh ghi CRL/CRH với ảnh, chỉ sửa nibble bị lệch
+ * @details Không lệch: một lần đọc và một phép so sánh.
+ * @return Số nibble đã sửa
+ **********************************************************/
+static inline uint32_t Port_RepairCr(volatile uint32_t* cr, uint32_t image, uint32_t check) {
+    uint32_t value, diff;
+
+    if (check == 0) return 0;
+    value = *cr;
+    diff = (value ^ image) & check;
+    if (diff == 0) return 0;
+
+    /* Bit lệch bất kỳ trong nibble -> cả nibble */
+    diff |= diff >> 1;
+    diff |= diff >> 2;
+    diff &= 0x11111111UL;
+    *cr = (value & ~(diff * 0xFU)) | (image & (diff * 0xFU));
+    return (uint32_t)__builtin_popcount(diff);
+}
+
 /* ===============================
  *     Function Definitions
  * =============================== */
 
 /**********************************************************
  * @brief Khởi tạo toàn bộ các Port/Pin theo cấu hình
- * @details Hàm này sẽ gọi cấu hình từng pin theo bảng config.
+ * @details Bảng config được chép vào bảng trạng thái RAM (dùng cho các
+ *          API runtime) và gom thành ảnh thanh ghi của từng cổng, sau
+ *          đó mỗi cổng chỉ ghi BSRR, CRL, CRH một lần (CRL/CRH đọc một
+ *          lần nếu cổng còn pin ngoài cấu hình). Clock GPIO của các cổng
+ *          có dùng được đăng ký với Clk và bật bằng một lệnh ghi APB2ENR;
+ *          cổng không còn dùng khi init lại được trả clock.
+ *          Config sinh bởi TOOLS/mcal_gen.py mang sẵn ảnh (Images) nên
+ *          bước dựng ảnh được thay bằng một lần chép. Không có Images
+ *          thì ảnh SLEEP/SAFE cũng dựng ở đây, Port_SetProfile chỉ ghi.
+ *          Remap và SWJ_CFG gộp thành một lệnh ghi AFIO_MAPR, chỉ khi
+ *          khác giá trị Port ghi lần trước; AFIO có clock khi còn remap.
+ *          Pin không có trong config giữ nguyên cấu hình hiện tại.
+ *          Profile quay về PORT_PROFILE_ACTIVE.
  * @param[in] ConfigPtr Con trỏ đến cấu hình Port
  **********************************************************/
 void Port_Init(const Port_ConfigType* ConfigPtr) {
+    uint8_t used;
+    uint32_t mapr;
+
     if (ConfigPtr == NULL) return;
 
-    for (uint16_t i = 0; i < ConfigPtr->PinCount; i++) {
-        Port_ApplyPinConfig(&ConfigPtr->PinConfigs[i]);
+    Port_LoadPins(ConfigPtr);
+    used = (ConfigPtr->Images != NULL) ? Port_LoadImages(ConfigPtr->Images) : Port_BuildImages(ConfigPtr);
+    Port_UncheckLocked();
+
+    /* SWJ_CFG chỉ ghi, đọc ra không xác định: MAPR được ghi nguyên giá
+     * trị từ config, không đọc-sửa-ghi. Clock AFIO đang giữ thì ghi
+     * ngay (trước khi có thể bị trả), chưa giữ thì ghi sau Clk_Apply. */
+    mapr = (ConfigPtr->Remap & PORT_REMAP_MASK) | (((uint32_t)ConfigPtr->SwjCfg << 24) & AFIO_MAPR_SWJ_CFG);
+    if (Port_AfioHeld && mapr != Port_Mapr) {
+        AFIO->MAPR = mapr;
+        Port_Mapr = mapr;
     }
+    if ((mapr != 0U) != Port_AfioHeld) {
+        if (mapr != 0U) Clk_Request(CLK_AFIO);
+        else Clk_Release(CLK_AFIO);
+        Port_AfioHeld = (mapr != 0U);
+    }
+    /* Chỉ duyệt các cổng đổi trạng thái dùng so với lần init trước */
+    for (uint8_t changed = used ^ Port_ClockHeld; changed != 0; changed &= (uint8_t)(changed - 1U)) {
+        uint8_t p = (uint8_t)__builtin_ctz(changed);
+        if (used & (1U << p)) Clk_Request(CLK_GPIO(p));
+        else Clk_Release(CLK_GPIO(p));
+    }
+    Port_ClockHeld = used;
+    Clk_Apply();
+
+    /* Remap trước khi chân thành AF: tín hiệu ra thẳng chân mới */
+    if (mapr != Port_Mapr) {
+        AFIO->MAPR = mapr;
+        Port_Mapr = mapr;
+    }
+
+    for (uint8_t p = 0; p < PORT_COUNT; p++) {
+        const Port_ImageType* img = &Port_Images[p];
+        GPIO_TypeDef* port = Port_Gpio[p];
+
+        if (img->Pins == 0) continue;
+        /* ODR trước, rồi mới đổi mode: output lên đúng mức, không xung nhiễu */
+        if (img->Bsrr != 0) port->BSRR = img->Bsrr;
+        Port_WriteCr(&port->CRL, img->Crl, img->CrlMask);
+        Port_WriteCr(&port->CRH, img->Crh, img->CrhMask);
+    }
+    Port_Profile = PORT_PROFILE_ACTIVE;
     Port_Initialized = 1;
 }
 
 /**********************************************************
  * @brief Đổi chiều một chân Port (nếu cho phép runtime)
  * @details
- * Hàm sẽ đổi chiều (IN/OUT) của pin, nếu cho phép ở config.
- * @param[in] Pin Số hiệu pin (0..n-1)
+ * Hàm sẽ đổi chiều (IN/OUT) của pin, nếu cho phép ở config. Chỉ cập
+ * nhật bảng trạng thái RAM và vá nibble của pin; khi thành output, mức
+ * ra là giá trị ODR hiện tại. Kiểm tra init/tham số chỉ có khi
+ * PORT_DEV_ERROR_DETECT = STD_ON.
+ * @param[in] Pin Số hiệu pin (0..n-1, chỉ số trong bảng config của Port_Init)
  * @param[in] Direction Chiều mong muốn
  **********************************************************/
 void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction) {
-    if (!Port_Initialized) return;
-    if (Pin >= PortCfg_PinsCount) return;
-    if (!PortCfg_Pins[Pin].DirectionChangeable) return;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    if (!Port_Initialized) {
+        PORT_DET_REPORT(PORT_SETPINDIRECTION_ID, PORT_E_UNINIT);
+        return;
+    }
+    if (Pin >= Port_PinCount || Direction > PORT_PIN_OUT) {
+        PORT_DET_REPORT(PORT_SETPINDIRECTION_ID, PORT_E_PARAM_PIN);
+        return;
+    }
+#endif
+    if (!(Port_PinState[Pin].Changeable & PORT_CHANGE_DIRECTION)) {
+        PORT_DET_REPORT(PORT_SETPINDIRECTION_ID, PORT_E_DIRECTION_UNCHANGEABLE);
+        return;
+    }
+    if (Port_Profile != PORT_PROFILE_ACTIVE) return;
 
-    Port_PinConfigType* pinCfg = (Port_PinConfigType*)&PortCfg_Pins[Pin]; // cast bỏ const để update runtime (nếu cần)
-    pinCfg->Direction = Direction;
-    Port_ApplyPinConfig(pinCfg);
+    Port_PinState[Pin].Direction = (uint8_t)Direction;
+    Port_PatchPin(&Port_PinState[Pin]);
 }
 
 /**********************************************************
  * @brief Làm tươi lại chiều các pin không cho đổi runtime
- * @details Chỉ các pin cấu hình DirectionChangeable=0 sẽ được làm tươi lại chiều về giá trị config
+ * @details Chỉ các pin cấu hình DirectionChangeable=0 sẽ được làm tươi lại chiều về giá trị config.
+ *          Mỗi cổng so CRL/CRH với ảnh dưới mask các pin đó; chỉ nibble
+ *          lệch được ghi lại và cộng vào bộ đếm drift của cổng. Trường
+ *          hợp không lệch tốn tối đa hai lần đọc và hai phép so mỗi cổng.
+ *          Pin đã khóa bằng Port_LockConfig bị bỏ qua. Ngoài
+ *          PORT_PROFILE_ACTIVE không làm gì (ảnh là của ACTIVE).
  **********************************************************/
 void Port_RefreshPortDirection(void) {
-    if (!Port_Initialized) return;
-    for (uint16_t i = 0; i < PortCfg_PinsCount; i++) {
-        if (!PortCfg_Pins[i].DirectionChangeable) {
-            Port_ApplyPinConfig(&PortCfg_Pins[i]);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    if (!Port_Initialized) {
+        PORT_DET_REPORT(PORT_REFRESHPORTDIRECTION_ID, PORT_E_UNINIT);
+        return;
+    }
+#endif
+    /* Chưa init: ảnh toàn 0, không cổng nào được so */
+    if (Port_Profile != PORT_PROFILE_ACTIVE) return;
+    for (uint8_t p = 0; p < PORT_COUNT; p++) {
+        const Port_ImageType* img = &Port_Images[p];
+        GPIO_TypeDef* port = Port_Gpio[p];
+
+        Port_DriftCount[p] += Port_RepairCr(&port->CRL, img->Crl, img->CrlCheck) +
+                              Port_RepairCr(&port->CRH, img->Crh, img->CrhCheck);
+    }
+}
+
+/**********************************************************
+ * @brief Khóa cấu hình phần cứng (GPIOx_LCKR) của các pin cố định
+ * @details Pin có DirectionChangeable = 0 và ModeChangeable = 0 được
+ *          khóa; mỗi cổng chạy chuỗi khóa LCKK một lần (ghi 1+mask,
+ *          0+mask, 1+mask, đọc hai lần). Khóa giữ đến khi reset: pin đã
+ *          khóa ra khỏi mask refresh, nên Port_RefreshPortDirection không
+ *          còn đọc cổng chỉ gồm pin khóa. Cổng đã khóa không khóa thêm
+ *          được pin mới.
+ *          Chỉ khóa trong PORT_PROFILE_ACTIVE: ở SLEEP/SAFE pin đang
+ *          mang cấu hình analog/an toàn, khóa lúc đó giữ nó đến reset.
+ * @return E_OK nếu mọi pin cần khóa đã khóa, E_NOT_OK nếu chưa
+ *         Port_Init, không ở ACTIVE, LCKK không lên, hoặc pin mới
+ *         trên cổng đã khóa
+ **********************************************************/
+Std_ReturnType Port_LockConfig(void) {
+    uint16_t lock[PORT_COUNT] = { 0 };
+    Std_ReturnType ret = E_OK;
+
+    if (!Port_Initialized || Port_Profile != PORT_PROFILE_ACTIVE) return E_NOT_OK;
+
+    for (uint16_t i = 0; i < Port_PinCount; i++) {
+        const Port_PinStateType* st = &Port_PinState[i];
+        if (st->PortNum >= PORT_COUNT) continue;
+        /* Pin cấu hình lại ở dòng sau thắng, như Port_BuildImages */
+        if (st->Changeable == 0) lock[st->PortNum] |= (uint16_t)PORT_GET_PIN_MASK(st->PinNum);
+        else lock[st->PortNum] &= (uint16_t)~PORT_GET_PIN_MASK(st->PinNum);
+    }
+
+    for (uint8_t p = 0; p < PORT_COUNT; p++) {
+        GPIO_TypeDef* port = Port_Gpio[p];
+        uint32_t mask = lock[p];
+
+        if (Port_Locked[p] != 0) {
+            if (mask & ~(uint32_t)Port_Locked[p]) ret = E_NOT_OK;
+            continue;
         }
+        if (mask == 0) continue;
+
+        port->LCKR = GPIO_LCKR_LCKK | mask;
+        port->LCKR = mask;
+        port->LCKR = GPIO_LCKR_LCKK | mask;
+        (void)port->LCKR;
+        if (port->LCKR & GPIO_LCKR_LCKK) Port_Locked[p] = (uint16_t)mask;
+        else ret = E_NOT_OK;
     }
+    Port_UncheckLocked();
+    return ret;
+}
+
+/**********************************************************
+ * @brief Chuyển các cổng có trong config sang một profile chân
+ * @details Rời ACTIVE: đọc CRL/CRH/ODR mỗi cổng một lần để giữ lại.
+ *          SLEEP/SAFE: CRL/CRH ghi thẳng (nibble giữ lấy từ giá trị đã
+ *          đọc, còn lại từ ảnh sinh sẵn), BSRR chỉ khi profile lái mức.
+ *          Về ACTIVE: trả ODR của pin profile đã lái rồi ghi lại CRL/CRH
+ *          đã đọc, tức đúng cấu hình trước đó kể cả pin ngoài config.
+ *          Không đọc-sửa-ghi: tối đa 3 lệnh ghi mỗi cổng. Khi chưa về
+ *          ACTIVE, Port_SetPinDirection/Port_SetPinMode/refresh bỏ qua.
+ * @param[in] Profile PORT_PROFILE_xxx
+ * @return E_OK, E_NOT_OK nếu chưa Port_Init hoặc Profile không hợp lệ
+ **********************************************************/
+Std_ReturnType Port_SetProfile(Port_ProfileType Profile) {
+    if (!Port_Initialized || Profile >= PORT_PROFILE_COUNT) return E_NOT_OK;
+    if (Profile == Port_Profile) return E_OK;
+
+    for (uint8_t p = 0; p < PORT_COUNT; p++) {
+        const Port_ImageType* img = &Port_Images[p];
+        Port_ActiveSaveType* save = &Port_ActiveSave[p];
+        GPIO_TypeDef* port = Port_Gpio[p];
+
+        if (img->Pins == 0) continue;
+
+        if (Port_Profile == PORT_PROFILE_ACTIVE) {
+            save->Crl = port->CRL;
+            save->Crh = port->CRH;
+            save->Odr = port->ODR;
+            save->Driven = 0;
+        }
+
+        if (Profile == PORT_PROFILE_ACTIVE) {
+            uint32_t driven = save->Driven;
+            if (driven != 0) port->BSRR = (save->Odr & driven) | ((~save->Odr & driven) << 16);
+            port->CRL = save->Crl;
+            port->CRH = save->Crh;
+        } else {
+            const Port_ProfileImageType* prof = &img->Profiles[Profile - 1U];
+            /* Mức trước rồi mới thành output */
+            if (prof->Bsrr != 0) {
+                port->BSRR = prof->Bsrr;
+                save->Driven |= (uint16_t)(prof->Bsrr | (prof->Bsrr >> 16));
+            }
+            port->CRL = (save->Crl & prof->CrlKeep) | prof->Crl;
+            port->CRH = (save->Crh & prof->CrhKeep) | prof->Crh;
+        }
+    }
+    Port_Profile = Profile;
+    return E_OK;
+}
+
+/**********************************************************
+ * @brief Profile chân hiện tại
+ * @return PORT_PROFILE_xxx
+ **********************************************************/
+Port_ProfileType Port_GetProfile(void) {
+    return Port_Profile;
+}
+
+/**********************************************************
+ * @brief Số nibble CRL/CRH Port_RefreshPortDirection đã phải sửa trên cổng
+ * @param[in] PortNum Cổng (PORT_ID_A..PORT_ID_D)
+ * @return Tổng từ khi khởi động, 0 nếu PortNum không hợp lệ
+ **********************************************************/
+uint32_t Port_GetDriftCount(uint8_t PortNum) {
+    if (PortNum >= PORT_COUNT) return 0;
+    return Port_DriftCount[PortNum];
 }
 
 /**********************************************************
@@ -152,15 +629,32 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo) {
 
 /**********************************************************
  * @brief Đổi mode chức năng của một chân pin (nếu cho phép runtime)
+ * @details Cập nhật bảng trạng thái RAM và vá nibble của pin. Kiểm tra
+ *          init/tham số chỉ có khi PORT_DEV_ERROR_DETECT = STD_ON.
  * @param[in] Pin Số hiệu pin
  * @param[in] Mode Mode chức năng cần chuyển sang
  **********************************************************/
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode) {
-    if (!Port_Initialized) return;
-    if (Pin >= PortCfg_PinsCount) return;
-    if (!PortCfg_Pins[Pin].ModeChangeable) return;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    if (!Port_Initialized) {
+        PORT_DET_REPORT(PORT_SETPINMODE_ID, PORT_E_UNINIT);
+        return;
+    }
+    if (Pin >= Port_PinCount) {
+        PORT_DET_REPORT(PORT_SETPINMODE_ID, PORT_E_PARAM_PIN);
+        return;
+    }
+    if (Mode >= PORT_PIN_MODE_COUNT) {
+        PORT_DET_REPORT(PORT_SETPINMODE_ID, PORT_E_PARAM_INVALID_MODE);
+        return;
+    }
+#endif
+    if (!(Port_PinState[Pin].Changeable & PORT_CHANGE_MODE)) {
+        PORT_DET_REPORT(PORT_SETPINMODE_ID, PORT_E_MODE_UNCHANGEABLE);
+        return;
+    }
+    if (Port_Profile != PORT_PROFILE_ACTIVE) return;
 
-    Port_PinConfigType* pinCfg = (Port_PinConfigType*)&PortCfg_Pins[Pin];
-    pinCfg->Mode = Mode;
-    Port_ApplyPinConfig(pinCfg);
+    Port_PinState[Pin].Mode = Mode;
+    Port_PatchPin(&Port_PinState[Pin]);
 }
@@ -1,100 +1,152 @@
 /**********************************************************
- * @file    Port_cfg.c
+ * @file    Portconfig.c
  * @brief   Port Driver Configuration Source File
- * @details File này chứa phần hiện thực các tham số cấu hình 
- *          cho từng chân Port của driver Port theo chuẩn AUTOSAR,
- *          dùng cho STM32F103.
- *
+ * @details File sinh bởi TOOLS/mcal_gen.py từ TOOLS/mcal_config.json,
+ *          không sửa tay: sửa file JSON rồi chạy make config.
+ *          PortCfg_Images là ảnh CRL/CRH/ODR Port_Init sẽ dựng từ
+ *          PortCfg_Pins, tính sẵn để bỏ bước dựng ảnh lúc khởi động.
+ *          Trường pin đi qua PORT_CFG_xxx: giá trị ngoài miền, hoặc
+ *          PortCfg_PinsCount lệch số dòng, dừng biên dịch.
  * @version 1.0
- * @date    2024-06-19
- * @author  HALA Academy & ChatGPT
+ * @date    2026-10-18
+ * @author  HALA Academy
  **********************************************************/
 
 #include "Portconfig.h"
 
-/**********************************************************
- * Cấu hình chi tiết cho từng chân GPIO
- * - PortNum:   PORT_ID_A, PORT_ID_B, PORT_ID_C, ...
- * - PinNum:    Số thứ tự chân trong port (0-15)
- * - Mode:      PORT_PIN_MODE_DIO, ...
- * - Direction: PORT_PIN_OUT / PORT_PIN_IN
- * - DirectionChangeable: 1 = Cho phép đổi chiều runtime
- * - Level:     PORT_PIN_LEVEL_HIGH / PORT_PIN_LEVEL_LOW
- * - Pull:      PORT_PIN_PULL_NONE / UP / DOWN
- * - ModeChangeable: 1 = Cho phép đổi mode runtime
- **********************************************************/
-
 const Port_PinConfigType PortCfg_Pins[] = {
-    /* PA0: DIO, Output, Được phép đổi chiều & mode runtime, mặc định HIGH, không pull */
+    /* PA0: DIO, Output HIGH, đổi chiều & mode runtime (LedExt) */
     {
-        .PortNum = PORT_ID_A,
-        .PinNum = 0,
-        .Mode = PORT_PIN_MODE_DIO,
-        .Speed = PORT_SPEED_2Mhz, // Tốc độ 2MHz
-        .Direction = PORT_PIN_OUT,
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(0),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_DIO),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_2Mhz),
+        .Direction           = PORT_PIN_OUT,
         .DirectionChangeable = 1,
-        .Level = PORT_PIN_LEVEL_HIGH,
-        .Pull = PORT_PIN_PULL_NONE,
-        .ModeChangeable = 1
+        .Level               = PORT_PIN_LEVEL_HIGH,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 1,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_ANALOG)
     },
-    /* PA1: DIO, Input, Không đổi chiều, pull-up */
+    /* PA1: PWM, TIM2_CH2, safe LOW */
     {
-        .PortNum = PORT_ID_A,
-        .PinNum = 1,
-        .Mode = PORT_PIN_MODE_PWM,
-        .Speed = PORT_SPEED_50Mhz, // Tốc độ 10MHz
-        .Direction = PORT_PIN_OUT,
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(1),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_PWM),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_50Mhz),
+        .Direction           = PORT_PIN_OUT,
         .DirectionChangeable = 0,
-        .Level = PORT_PIN_LEVEL_LOW, /* Không ảnh hưởng nếu là input */
-        .Pull = PORT_PIN_PULL_NONE,
-        .ModeChangeable = 0
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_LOW)
     },
-    /* PB0: DIO, Output, Không đổi chiều, mặc định LOW, không pull */
+    /* PB0: DIO, Output LOW, giữ khi sleep, safe LOW (Relay) */
     {
-        .PortNum = PORT_ID_B,
-        .PinNum = 0, 
-        .Mode = PORT_PIN_MODE_DIO,
-        .Speed = PORT_SPEED_50Mhz, // Tốc độ 50MHz
-        .Direction = PORT_PIN_OUT,
+        .PortNum             = PORT_CFG_PORT(PORT_ID_B),
+        .PinNum              = PORT_CFG_PIN(0),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_DIO),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_50Mhz),
+        .Direction           = PORT_PIN_OUT,
         .DirectionChangeable = 0,
-        .Level = PORT_PIN_LEVEL_LOW,
-        .Pull = PORT_PIN_PULL_NONE,
-        .ModeChangeable = 0
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 1,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_LOW)
     },
-    /* PC13: DIO, Input, Được phép đổi mode runtime, pull-down */
+    /* PC13: DIO, Output LOW, đổi chiều & mode runtime (LedBoard) */
     {
-        .PortNum = PORT_ID_C,
-        .PinNum = 13,
-        .Mode = PORT_PIN_MODE_DIO,
-        .Speed = PORT_SPEED_2Mhz, // Tốc độ 2MHz
-        .Direction = PORT_PIN_OUT,
+        .PortNum             = PORT_CFG_PORT(PORT_ID_C),
+        .PinNum              = PORT_CFG_PIN(13),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_DIO),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_2Mhz),
+        .Direction           = PORT_PIN_OUT,
         .DirectionChangeable = 1,
-        .Level = PORT_PIN_LEVEL_LOW,
-        .Pull = PORT_PIN_PULL_NONE,
-        .ModeChangeable = 1
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 1,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_ANALOG)
     },
+    /* PA3: PWM, TIM2_CH4 */
     {
-        .PortNum              = PORT_ID_A,
-        .PinNum               = 3,
-        .Mode                 = PORT_PIN_MODE_PWM,    
-        .Speed                = PORT_SPEED_10Mhz, // Tốc độ 2MHz
-        .Direction            = PORT_PIN_OUT,
-        .DirectionChangeable  = 0,
-        .Level                = PORT_PIN_LEVEL_LOW,      // Không quan trọng với AF_PP
-        .Pull                 = PORT_PIN_PULL_NONE,
-        .ModeChangeable       = 0
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(3),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_PWM),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_10Mhz),
+        .Direction           = PORT_PIN_OUT,
+        .DirectionChangeable = 0,
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_ANALOG)
     },
-    /* PA7 - TIM3_CH2 - PWM Output */
+    /* PA7: PWM, TIM3_CH2, safe LOW */
     {
-        .PortNum              = PORT_ID_A,
-        .PinNum               = 7,
-        .Mode                 = PORT_PIN_MODE_PWM,    // Alternate Function Push-Pull
-        .Speed                = PORT_SPEED_50Mhz, // Tốc độ 2MHz
-        .Direction            = PORT_PIN_OUT,
-        .DirectionChangeable  = 0,
-        .Level                = PORT_PIN_LEVEL_LOW,
-        .Pull                 = PORT_PIN_PULL_NONE,
-        .ModeChangeable       = 0
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(7),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_PWM),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_50Mhz),
+        .Direction           = PORT_PIN_OUT,
+        .DirectionChangeable = 0,
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_LOW)
     }
 };
-//const uint64 PortCfg_PinsCount = sizeof(PortCfg_Pins) / sizeof(Port_PinConfigType);
\ No newline at end of file
+
+_Static_assert(PORT_ARRAY_SIZE(PortCfg_Pins) == PortCfg_PinsCount,
+               "PortCfg_PinsCount does not match PortCfg_Pins[]");
+
+const Port_ImageType PortCfg_Images[PORT_COUNT] = {
+    [PORT_ID_A] = { .Crl = 0xB00090B6UL, .CrlMask = 0xF000F0FFUL, .CrlCheck = 0xF000F0F0UL,
+                    .Crh = 0x00000000UL, .CrhMask = 0x00000000UL, .CrhCheck = 0x00000000UL,
+                    .Bsrr = 0x008A0001UL, .Pins = 0x008BU,
+                    .Profiles[PORT_PROFILE_SLEEP - 1U] = {
+                        .CrlKeep = 0x00000000UL, .Crl = 0x00000000UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00000000UL },
+                    .Profiles[PORT_PROFILE_SAFE - 1U] = {
+                        .CrlKeep = 0x00000000UL, .Crl = 0x20000020UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00820000UL } },
+    [PORT_ID_B] = { .Crl = 0x00000007UL, .CrlMask = 0x0000000FUL, .CrlCheck = 0x0000000FUL,
+                    .Crh = 0x00000000UL, .CrhMask = 0x00000000UL, .CrhCheck = 0x00000000UL,
+                    .Bsrr = 0x00010000UL, .Pins = 0x0001U,
+                    .Profiles[PORT_PROFILE_SLEEP - 1U] = {
+                        .CrlKeep = 0x0000000FUL, .Crl = 0x00000000UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00000000UL },
+                    .Profiles[PORT_PROFILE_SAFE - 1U] = {
+                        .CrlKeep = 0x00000000UL, .Crl = 0x00000002UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00010000UL } },
+    [PORT_ID_C] = { .Crl = 0x00000000UL, .CrlMask = 0x00000000UL, .CrlCheck = 0x00000000UL,
+                    .Crh = 0x00600000UL, .CrhMask = 0x00F00000UL, .CrhCheck = 0x00000000UL,
+                    .Bsrr = 0x20000000UL, .Pins = 0x2000U,
+                    .Profiles[PORT_PROFILE_SLEEP - 1U] = {
+                        .CrlKeep = 0x00000000UL, .Crl = 0x00000000UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00000000UL },
+                    .Profiles[PORT_PROFILE_SAFE - 1U] = {
+                        .CrlKeep = 0x00000000UL, .Crl = 0x00000000UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00000000UL } },
+    [PORT_ID_D] = { .Crl = 0x00000000UL, .CrlMask = 0x00000000UL, .CrlCheck = 0x00000000UL,
+                    .Crh = 0x00000000UL, .CrhMask = 0x00000000UL, .CrhCheck = 0x00000000UL,
+                    .Bsrr = 0x00000000UL, .Pins = 0x0000U,
+                    .Profiles[PORT_PROFILE_SLEEP - 1U] = {
+                        .CrlKeep = 0x00000000UL, .Crl = 0x00000000UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00000000UL },
+                    .Profiles[PORT_PROFILE_SAFE - 1U] = {
+                        .CrlKeep = 0x00000000UL, .Crl = 0x00000000UL,
+                        .CrhKeep = 0x00000000UL, .Crh = 0x00000000UL, .Bsrr = 0x00000000UL } }
+};
+
+const Port_ConfigType PortCfg_Config = {
+    .PinConfigs = PortCfg_Pins,
+    .PinCount   = PORT_ARRAY_SIZE(PortCfg_Pins),
+    .Images     = PortCfg_Images,
+    .Remap      = PORT_REMAP_NONE,
+    .SwjCfg     = PORT_SWJ_FULL
+};
@@ -3,15 +3,20 @@
  * @brief   Pulse Width Modulation (PWM) Driver Source File
  * @details Hiện thực các API của PWM Driver chuẩn AUTOSAR cho STM32F103, sử dụng SPL.
  *          Quản lý chức năng PWM, không cấu hình chân GPIO.
+ *          Các API runtime ghi thẳng qua con trỏ CCR của kênh trong cấu
+ *          hình; channel (1..4) đã được TOOLS/mcal_gen.py kiểm tra khi sinh
+ *          và PWM_CFG_xxx kiểm tra lúc biên dịch, nên kiểm tra init/số kênh
+ *          lúc chạy chỉ có khi PWM_DEV_ERROR_DETECT = STD_ON.
  * 
  * @version 1.0
  * @date    2024-06-27
  * @author  HALA Academy
  **********************************************************/
 #include "stm32f10x.h"
-#include "stm32f10x_rcc.h"
 #include "stm32f10x_tim.h"
 #include "Pwm.h"
+#include "Clk.h"
+#include "Det.h"
 #include <stddef.h>
 
 /* ===============================
@@ -24,6 +29,46 @@ static const Pwm_ConfigType* Pwm_CurrentConfigPtr = NULL;
 /* Trạng thái đã khởi tạo của driver PWM */
 static uint8 Pwm_IsInitialized = 0;
 
+/* Bit CCxE trong CCER và TIM_IT_CCx của channel 1..4 (các channel cách nhau đều) */
+#define PWM_CCER_ENABLE(Channel)    ((uint16_t)(TIM_CCER_CC1E << (((Channel) - 1U) * 4U)))
+#define PWM_IT_CC(Channel)          ((uint16_t)(TIM_IT_CC1 << ((Channel) - 1U)))
+
+/**********************************************************
+ * Kiểm tra init và số kênh đầu mỗi API runtime; rỗng khi
+ * PWM_DEV_ERROR_DETECT = STD_OFF (kênh đã kiểm tra lúc sinh config)
+ **********************************************************/
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+#define PWM_DET_CHECK(ChannelNumber, ApiId, RetVal)                                         \
+    do {                                                                                    \
+        if (!Pwm_IsInitialized) {                                                           \
+            Det_ReportError(PWM_MODULE_ID, 0, (ApiId), PWM_E_UNINIT);                       \
+            return RetVal;                                                                  \
+        }                                                                                   \
+        if ((ChannelNumber) >= Pwm_CurrentConfigPtr->NumChannels) {                         \
+            Det_ReportError(PWM_MODULE_ID, 0, (ApiId), PWM_E_PARAM_CHANNEL);                \
+            return RetVal;                                                                  \
+        }                                                                                   \
+    } while (0)
+#define PWM_DET_REPORT(ApiId, ErrorId)  Det_ReportError(PWM_MODULE_ID, 0, (ApiId), (ErrorId))
+#else
+#define PWM_DET_CHECK(ChannelNumber, ApiId, RetVal)  ((void)0)
+#define PWM_DET_REPORT(ApiId, ErrorId)              ((void)0)
+#endif
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* Định danh clock Clk của timer, CLK_NONE nếu không hỗ trợ */
+static Clk_PeripheralType Pwm_TimerClock(const TIM_TypeDef* TIMx)
+{
+    if (TIMx == TIM1) return CLK_TIM1;
+    if (TIMx == TIM2) return CLK_TIM2;
+    if (TIMx == TIM3) return CLK_TIM3;
+    if (TIMx == TIM4) return CLK_TIM4;
+    return CLK_NONE;
+}
+
 /* ===============================
  *        Function Definitions
  * =============================== */
@@ -31,6 +76,12 @@ static uint8 Pwm_IsInitialized = 0;
 /**********************************************************
  * @brief   Khởi tạo PWM driver với cấu hình chỉ định
  * @details Khởi tạo tất cả timer/kênh PWM theo cấu hình. Phần cấu hình chân GPIO phải thực hiện riêng.
+ *          Clock của mọi timer được đăng ký với Clk rồi bật cùng lúc
+ *          (một lệnh ghi APB1ENR, một lệnh ghi APB2ENR nếu có TIM1).
+ *          Mọi timer được Clk_Claim trước; một timer đang thuộc driver
+ *          khác (PWM_E_TIMER_IN_USE) hoặc TIMx không phải TIM1..TIM4
+ *          (PWM_E_INIT_FAILED) thì trả lại các timer đã giành và driver
+ *          vẫn chưa init.
  *
  * @param[in] ConfigPtr Con trỏ tới cấu hình PWM
  **********************************************************/
@@ -39,7 +90,34 @@ void Pwm_Init(const Pwm_ConfigType* ConfigPtr)
     if (Pwm_IsInitialized) return;
     if (ConfigPtr == NULL) return;
 
+    /* Giành timer trước khi ghi bất kỳ thanh ghi nào. Timer không hỗ
+     * trợ là lỗi config, không phải timer bận: báo riêng, không claim */
+    for (uint8 i = 0; i < ConfigPtr->NumChannels; i++)
+    {
+        Clk_PeripheralType clock = Pwm_TimerClock(ConfigPtr->Channels[i].TIMx);
+        uint8 error = (clock == CLK_NONE) ? PWM_E_INIT_FAILED
+                    : (Clk_Claim(clock, CLK_OWNER_PWM) != E_OK) ? PWM_E_TIMER_IN_USE : 0U;
+
+        if (error != 0U)
+        {
+            for (uint8 j = 0; j < i; j++)
+            {
+                Clk_Unclaim(Pwm_TimerClock(ConfigPtr->Channels[j].TIMx), CLK_OWNER_PWM);
+            }
+            PWM_DET_REPORT(PWM_INIT_ID, error);
+            return;
+        }
+    }
+
     Pwm_CurrentConfigPtr = ConfigPtr;
+
+    /*bật clock cho timer: mỗi kênh giữ một tham chiếu, trả lại ở Pwm_DeInit*/
+    for (uint8 i = 0; i < ConfigPtr->NumChannels; i++)
+    {
+        Clk_Request(Pwm_TimerClock(ConfigPtr->Channels[i].TIMx));
+    }
+    Clk_Apply();
+
     for (uint8 i = 0; i < ConfigPtr->NumChannels; i++)
     {
         const Pwm_ChannelConfigType* channelConfig = &ConfigPtr->Channels[i];
@@ -47,17 +125,6 @@ void Pwm_Init(const Pwm_ConfigType* ConfigPtr)
         /* Cấu hình chu kỳ cho timer (ARR) */
         channelConfig->TIMx->ARR = channelConfig->defaultPeriod;
 
-        /*bật clock cho timer*/
-        if(channelConfig -> TIMx == TIM2) {
-            RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
-        } else if(channelConfig -> TIMx == TIM3) {
-            RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
-        } else if(channelConfig -> TIMx == TIM4) {
-            RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM4, ENABLE);
-        } else if(channelConfig -> TIMx == TIM1) {
-            RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1, ENABLE);
-        }
-
         /* Cấu hình timer */
     
         TIM_TimeBaseInitTypeDef TIM_InitStructure;
@@ -110,6 +177,8 @@ void Pwm_Init(const Pwm_ConfigType* ConfigPtr)
 
 /**********************************************************
  * @brief   Dừng tất cả kênh PWM và giải phóng tài nguyên
+ * @details Timer không còn driver nào giữ sẽ bị tắt clock và được
+ *          trả cho Dio_Stream/Dio_Capture.
  **********************************************************/
 void Pwm_DeInit(void)
 {
@@ -121,7 +190,10 @@ void Pwm_DeInit(void)
         if (channelConfig->TIMx == TIM1) {
             TIM_CtrlPWMOutputs(TIM1, DISABLE);
         }
+        Clk_Release(Pwm_TimerClock(channelConfig->TIMx));
+        Clk_Unclaim(Pwm_TimerClock(channelConfig->TIMx), CLK_OWNER_PWM);
     }
+    Clk_Apply();
     Pwm_IsInitialized = 0;
 }
 
@@ -134,17 +206,10 @@ void Pwm_DeInit(void)
  **********************************************************/
 void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
 {
-    if (!Pwm_IsInitialized || ChannelNumber >= Pwm_CurrentConfigPtr->NumChannels) return;
+    PWM_DET_CHECK(ChannelNumber, PWM_SETDUTYCYCLE_ID, );
     const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
     uint16_t period = channelConfig->TIMx->ARR;
-    uint16_t compareValue = ((uint32_t)period * DutyCycle) >> 15;
-    switch (channelConfig->channel) {
-    case 1: channelConfig->TIMx->CCR1 = compareValue; break;
-    case 2: channelConfig->TIMx->CCR2 = compareValue; break;
-    case 3: channelConfig->TIMx->CCR3 = compareValue; break;
-    case 4: channelConfig->TIMx->CCR4 = compareValue; break;
-    default: break;
-    }
+    *channelConfig->ccr = ((uint32_t)period * DutyCycle) >> 15;
 }
 
 /**********************************************************
@@ -157,18 +222,14 @@ void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
  **********************************************************/
 void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle)
 {
-    if (!Pwm_IsInitialized || ChannelNumber >= Pwm_CurrentConfigPtr->NumChannels) return;
+    PWM_DET_CHECK(ChannelNumber, PWM_SETPERIODANDDUTY_ID, );
     const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
-    if (channelConfig->classType != PWM_VARIABLE_PERIOD) return;
-    channelConfig->TIMx->ARR = Period;
-    uint16_t compareValue = ((uint32_t)Period * DutyCycle) >> 15;
-    switch (channelConfig->channel) {
-    case 1: channelConfig->TIMx->CCR1 = compareValue; break;
-    case 2: channelConfig->TIMx->CCR2 = compareValue; break;
-    case 3: channelConfig->TIMx->CCR3 = compareValue; break;
-    case 4: channelConfig->TIMx->CCR4 = compareValue; break;
-    default: break;
+    if (channelConfig->classType != PWM_VARIABLE_PERIOD) {
+        PWM_DET_REPORT(PWM_SETPERIODANDDUTY_ID, PWM_E_PERIOD_UNCHANGEABLE);
+        return;
     }
+    channelConfig->TIMx->ARR = Period;
+    *channelConfig->ccr = ((uint32_t)Period * DutyCycle) >> 15;
 }
 
 /**********************************************************
@@ -176,15 +237,8 @@ void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period,
  **********************************************************/
 void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
 {
-    if (!Pwm_IsInitialized || ChannelNumber >= Pwm_CurrentConfigPtr->NumChannels) return;
-    const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
-    switch (channelConfig->channel) {
-    case 1: channelConfig->TIMx->CCR1 = 0; break;
-    case 2: channelConfig->TIMx->CCR2 = 0; break;
-    case 3: channelConfig->TIMx->CCR3 = 0; break;
-    case 4: channelConfig->TIMx->CCR4 = 0; break;
-    default: break;
-    }
+    PWM_DET_CHECK(ChannelNumber, PWM_SETOUTPUTTOIDLE_ID, );
+    *Pwm_CurrentConfigPtr->Channels[ChannelNumber].ccr = 0;
 }
 
 /**********************************************************
@@ -193,17 +247,9 @@ void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
  **********************************************************/
 Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber)
 {
-    if (!Pwm_IsInitialized || ChannelNumber >= Pwm_CurrentConfigPtr->NumChannels) return PWM_LOW;
+    PWM_DET_CHECK(ChannelNumber, PWM_GETOUTPUTSTATE_ID, PWM_LOW);
     const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
-    uint16_t isOutputEnabled = 0;
-    switch (channelConfig->channel) {
-    case 1: isOutputEnabled = (channelConfig->TIMx->CCER & TIM_CCER_CC1E); break;
-    case 2: isOutputEnabled = (channelConfig->TIMx->CCER & TIM_CCER_CC2E); break;
-    case 3: isOutputEnabled = (channelConfig->TIMx->CCER & TIM_CCER_CC3E); break;
-    case 4: isOutputEnabled = (channelConfig->TIMx->CCER & TIM_CCER_CC4E); break;
-    default: break;
-    }
-    return (isOutputEnabled) ? PWM_HIGH : PWM_LOW;
+    return (channelConfig->TIMx->CCER & PWM_CCER_ENABLE(channelConfig->channel)) ? PWM_HIGH : PWM_LOW;
 }
 
 /**********************************************************
@@ -214,15 +260,9 @@ Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber)
  **********************************************************/
 void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber)
 {
-    if (!Pwm_IsInitialized || ChannelNumber >= Pwm_CurrentConfigPtr->NumChannels) return;
+    PWM_DET_CHECK(ChannelNumber, PWM_DISABLENOTIFICATION_ID, );
     const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
-    switch (channelConfig->channel) {
-    case 1: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC1, DISABLE); break;
-    case 2: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC2, DISABLE); break;
-    case 3: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC3, DISABLE); break;
-    case 4: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC4, DISABLE); break;
-    default: break;
-    }
+    TIM_ITConfig(channelConfig->TIMx, PWM_IT_CC(channelConfig->channel), DISABLE);
 }
 
 /**********************************************************
@@ -235,15 +275,9 @@ void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber)
 void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification)
 {
     (void)Notification; // Hiện tại chưa phân biệt cạnh, có thể mở rộng nếu dùng input capture
-    if (!Pwm_IsInitialized || ChannelNumber >= Pwm_CurrentConfigPtr->NumChannels) return;
+    PWM_DET_CHECK(ChannelNumber, PWM_ENABLENOTIFICATION_ID, );
     const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
-    switch (channelConfig->channel) {
-    case 1: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC1, ENABLE); break;
-    case 2: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC2, ENABLE); break;
-    case 3: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC3, ENABLE); break;
-    case 4: TIM_ITConfig(channelConfig->TIMx, TIM_IT_CC4, ENABLE); break;
-    default: break;
-    }
+    TIM_ITConfig(channelConfig->TIMx, PWM_IT_CC(channelConfig->channel), ENABLE);
 }
 
 /**********************************************************
@@ -256,7 +290,7 @@ void Pwm_GetVersionInfo(Std_VersionInfoType* versioninfo)
 {
     if (versioninfo == NULL) return;
     versioninfo->vendorID = 0x1234;
-    versioninfo->moduleID = 0xABCD;
+    versioninfo->moduleID = PWM_MODULE_ID;
     versioninfo->sw_major_version = 1;
     versioninfo->sw_minor_version = 0;
     versioninfo->sw_patch_version = 0;
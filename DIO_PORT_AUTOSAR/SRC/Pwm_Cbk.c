@@ -0,0 +1,21 @@
+/**********************************************************
+ * @file    Pwm_Cbk.c
+ * @brief   Callback notification của các kênh PWM
+ * @details Pwm_Lcfg.c được sinh tự động nên callback của ứng dụng đặt
+ *          ở đây; tên hàm khai báo trong TOOLS/mcal_config.json.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Pwm_Lcfg.h"
+
+/* ==== Ví dụ hàm callback cho PWM notification ==== */
+void Pwm_Channel0_Notification(void)
+{
+    // Ví dụ: đặt breakpoint, bật LED, debug, v.v.
+    // printf("PWM Channel 0 interrupt/callback!\n");
+    // GPIO_SetBits(GPIOC, GPIO_Pin_13);
+    // Pwm_EnableNotification(0, PWM_BOTH_EDGES); // hoặc PWM_RISING_EDGE, PWM_FALLING_EDGE
+    // sẽ kích hoạt ngắt
+}
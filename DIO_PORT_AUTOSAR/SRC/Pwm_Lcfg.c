@@ -1,57 +1,47 @@
 /**********************************************************
  * @file    Pwm_Lcfg.c
  * @brief   PWM Driver Configuration Source File (AUTOSAR)
- * @details Cấu hình các kênh PWM dùng cho STM32F103 (ví dụ: TIM2_CH1/PA0, TIM3_CH2/PA7)
+ * @details File sinh bởi TOOLS/mcal_gen.py từ TOOLS/mcal_config.json,
+ *          không sửa tay: sửa file JSON rồi chạy make config.
+ *          Mỗi kênh mang sẵn con trỏ tới thanh ghi CCR của nó; timer,
+ *          channel và CCR cùng sinh từ một PWM_CFG_CH. Chân và remap
+ *          AFIO đã được kiểm tra khi sinh, timer/channel/duty được
+ *          PWM_CFG_xxx kiểm tra lại lúc biên dịch.
  * @version 1.0
- * @date    2024-06-27
+ * @date    2026-10-18
  * @author  HALA Academy
  **********************************************************/
 
 #include "Pwm.h"
 #include "Pwm_Lcfg.h"
-#include <stdio.h> // Nếu muốn test bằng printf hoặc debug trong callback
+#include <stddef.h>
 
-/* ==== Ví dụ hàm callback cho PWM notification ==== */
-void Pwm_Channel0_Notification(void)
-{
-    // Ví dụ: đặt breakpoint, bật LED, debug, v.v.
-    // printf("PWM Channel 0 interrupt/callback!\n");
-    // GPIO_SetBits(GPIOC, GPIO_Pin_13);
-    // ngắt quay lại học, nhưng cũng nói qua, thằng này kiểu khi có ngắt xảy ra, cụ thể là hàm
-    // Pwm_EnableNotification(0, PWM_BOTH_EDGES); // hoặc PWM_RISING_EDGE, PWM_FALLING_EDGE
-    // sẽ kích hoạt ngắt
-}
-
-/* ==== Cấu hình từng kênh PWM ==== */
-const Pwm_ChannelConfigType PwmChannelsConfig[] = {
-    /* Channel 0: PA1 - TIM2_CH2, có callback */
+static const Pwm_ChannelConfigType PwmChannelsConfig[] = {
+    /* Channel 0: PA1 - TIM2_CH2 (Dimmer) */
     {
-        .TIMx             = TIM2,
-        .channel          = 2,
+        PWM_CFG_CH(2, 2),      /* .TIMx, .channel, .ccr */
         .classType        = PWM_VARIABLE_PERIOD,
         .prescaler        = 0,
-        .defaultPeriod    = 999,          // 1ms (72MHz/72/1000)
-        .defaultDutyCycle = 0x0000,       // Duty 0%
+        .defaultPeriod    = 999,
+        .defaultDutyCycle = PWM_CFG_DUTY(0x0000),
         .polarity         = PWM_HIGH,
         .idleState        = PWM_LOW,
-        .NotificationCb   = Pwm_Channel0_Notification   // Callback không NULL!
+        .NotificationCb   = Pwm_Channel0_Notification
     },
-    /* Channel 1: PA7 - TIM3_CH2, không dùng callback */
+    /* Channel 1: PA7 - TIM3_CH2 (Fan) */
     {
-        .TIMx             = TIM3,
-        .channel          = 2,
+        PWM_CFG_CH(3, 2),      /* .TIMx, .channel, .ccr */
         .classType        = PWM_VARIABLE_PERIOD,
         .prescaler        = 0,
         .defaultPeriod    = 999,
-        .defaultDutyCycle = 0x0000,
+        .defaultDutyCycle = PWM_CFG_DUTY(0x0000),
         .polarity         = PWM_HIGH,
         .idleState        = PWM_LOW,
         .NotificationCb   = NULL
     }
 };
 
-/* ==== Cấu hình tổng PWM driver ==== */
 const Pwm_ConfigType PwmDriverConfig = {
     .Channels    = PwmChannelsConfig,
-    .NumChannels = sizeof(PwmChannelsConfig) / sizeof(Pwm_ChannelConfigType)
+    .NumChannels = PWM_CFG_COUNT(PwmChannelsConfig)
 };
@@ -0,0 +1,94 @@
+/**********************************************************
+ * @file    Tm.c
+ * @brief   Đo thời gian và chờ bận dùng chung (DWT CYCCNT + SysTick)
+ * @details SysTick_Handler so CYCCNT với giá trị lần trước: nhỏ hơn
+ *          nghĩa là CYCCNT đã tràn, tăng phần cao của trục 64 bit.
+ *          Chu kỳ SysTick ngắn hơn nhiều thời gian tràn nên giữa hai
+ *          lần ngắt CYCCNT tràn nhiều nhất một lần.
+ * @version 1.0
+ * @date    2026-10-18
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Tm.h"
+
+/* ===============================
+ *     Static Variables & Defines
+ * =============================== */
+
+/* Đoạn chờ dài nhất mỗi lần: 1 s < 2^31 chu kỳ tới ~2 GHz */
+#define TM_WAIT_CHUNK_US    1000000UL
+
+static volatile uint32 Tm_CycleHigh;    /* Số lần CYCCNT đã tràn */
+static volatile uint32 Tm_CycleLast;    /* CYCCNT ở lần SysTick trước */
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+void Tm_StartCycleCounter(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void Tm_Init(void)
+{
+    Tm_StartCycleCounter();
+    DWT->CYCCNT = 0;
+    Tm_CycleHigh = 0;
+    Tm_CycleLast = 0;
+    (void)SysTick_Config(SystemCoreClock / TM_SYSTICK_HZ);
+}
+
+void Tm_BusyWaitUs(uint32 Us)
+{
+    uint32 deadline = DWT->CYCCNT;
+
+    while (Us > TM_WAIT_CHUNK_US) {
+        deadline += Tm_UsToCycles(TM_WAIT_CHUNK_US);
+        Tm_WaitUntil(deadline);
+        Us -= TM_WAIT_CHUNK_US;
+    }
+    Tm_WaitUntil(deadline + Tm_UsToCycles(Us));
+}
+
+uint64_t Tm_GetCycles64(void)
+{
+    uint32 high;
+    uint32 last;
+    uint32 low;
+
+    /* SysTick chen vào giữa chỉ đổi high khi có tràn: đọc lại đến khi khớp */
+    do {
+        high = Tm_CycleHigh;
+        last = Tm_CycleLast;
+        low = DWT->CYCCNT;
+    } while (high != Tm_CycleHigh);
+
+    /* Tràn sau lần SysTick cuối mà ISR chưa chạy */
+    if (low < last) high++;
+    return ((uint64_t)high << 32) | low;
+}
+
+uint64_t Tm_GetTimeUs64(void)
+{
+    return Tm_GetCycles64() / TM_CYCLES_PER_US();
+}
+
+uint32 Tm_GetTimestampUs(void)
+{
+    return (uint32)Tm_GetTimeUs64();
+}
+
+/* ===============================
+ *     Interrupt Handlers
+ * =============================== */
+
+void SysTick_Handler(void)
+{
+    uint32 now = DWT->CYCCNT;
+
+    if (now < Tm_CycleLast) Tm_CycleHigh++;
+    Tm_CycleLast = now;
+}
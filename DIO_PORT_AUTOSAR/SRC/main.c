@@ -3,23 +3,18 @@
 #include "stm32f10x_tim.h"
 #include "stm32f10x_gpio.h"  
 #include "Dio.h"
+#include "Dio_Inline.h"     /* DIO_FlipChannel hằng số -> 1 load + 1 store */
 #include "Port.h"
 #include "Portconfig.h"
 #include "Pwm.h"
 #include "Pwm_Lcfg.h"
+#include "Tm.h"         /* Chờ theo DWT CYCCNT, không phụ thuộc -O và SYSCLK */
 
-
-void delay_ms(uint32_t ms)
-{
-    for(uint32_t i = 0; i < ms * 8000; i++) __NOP();
-}
 uint16_t duty =0;
 int main() {
-	    Port_ConfigType portConfig = {
-        .PinConfigs = PortCfg_Pins, // con trỏ trỏ tới mảng config
-       .PinCount = PortCfg_PinsCount // gán số lượng phần tử trong mảng
-    };
-    Port_Init(&portConfig);
+    Tm_Init();
+    Port_Init(&PortCfg_Config);   /* Bảng pin + ảnh thanh ghi sinh sẵn */
+    (void)Port_LockConfig();      /* Khóa LCKR pin cố định (PWM, PB0) đến khi reset */
 
 	Pwm_Init(&PwmDriverConfig);
  /* Bật ngắt cạnh lên của PWM cho kênh 0 nếu cần thiết */
@@ -33,17 +28,17 @@ int main() {
          if (duty < 0x8000){
         for (duty = 0; duty < 0x8000; duty += 0x0800) {
             Pwm_SetDutyCycle(0, duty);
-       delay_ms(50); // Đợi 500ms
+       Tm_BusyWaitUs(50000U); // Đợi 50 ms
         }}
         else { for (duty = 0; duty > 0x8000; duty -= 0x0800) {
             Pwm_SetDutyCycle(0, duty);
-       delay_ms(30); 
+       Tm_BusyWaitUs(30000U); 
       }
 	//Port_SetPinDirection(3, PORT_PIN_IN); // Đặt chân C13 là OUTPUT
 	DIO_FlipChannel(DIO_CHANNEL(GPIOC, 13)); 
-    delay_ms(30);
+    Tm_BusyWaitUs(30000U);
 	//Port_RefreshPortDirection(); // Làm tươi lại chiều các chân không cho đổi runtime
-	//delay_ms(500); // Đợi 500ms
+	//Tm_BusyWaitUs(500000U); // Đợi 500ms
     }
 }}
 
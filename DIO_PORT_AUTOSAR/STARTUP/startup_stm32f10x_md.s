@@ -22,11 +22,55 @@ g_pfnVectors:
     .word   0
     .word   0
     .word   0
+    .word   SVC_Handler
+    .word   DebugMon_Handler
     .word   0
-    .word   0
-    .word   0
-    .word   0
-    .word   0
+    .word   PendSV_Handler
+    .word   SysTick_Handler
+    /* Ngắt ngoại vi STM32F10x medium density (IRQ 0..42) */
+    .word   WWDG_IRQHandler
+    .word   PVD_IRQHandler
+    .word   TAMPER_IRQHandler
+    .word   RTC_IRQHandler
+    .word   FLASH_IRQHandler
+    .word   RCC_IRQHandler
+    .word   EXTI0_IRQHandler
+    .word   EXTI1_IRQHandler
+    .word   EXTI2_IRQHandler
+    .word   EXTI3_IRQHandler
+    .word   EXTI4_IRQHandler
+    .word   DMA1_Channel1_IRQHandler
+    .word   DMA1_Channel2_IRQHandler
+    .word   DMA1_Channel3_IRQHandler
+    .word   DMA1_Channel4_IRQHandler
+    .word   DMA1_Channel5_IRQHandler
+    .word   DMA1_Channel6_IRQHandler
+    .word   DMA1_Channel7_IRQHandler
+    .word   ADC1_2_IRQHandler
+    .word   USB_HP_CAN1_TX_IRQHandler
+    .word   USB_LP_CAN1_RX0_IRQHandler
+    .word   CAN1_RX1_IRQHandler
+    .word   CAN1_SCE_IRQHandler
+    .word   EXTI9_5_IRQHandler
+    .word   TIM1_BRK_IRQHandler
+    .word   TIM1_UP_IRQHandler
+    .word   TIM1_TRG_COM_IRQHandler
+    .word   TIM1_CC_IRQHandler
+    .word   TIM2_IRQHandler
+    .word   TIM3_IRQHandler
+    .word   TIM4_IRQHandler
+    .word   I2C1_EV_IRQHandler
+    .word   I2C1_ER_IRQHandler
+    .word   I2C2_EV_IRQHandler
+    .word   I2C2_ER_IRQHandler
+    .word   SPI1_IRQHandler
+    .word   SPI2_IRQHandler
+    .word   USART1_IRQHandler
+    .word   USART2_IRQHandler
+    .word   USART3_IRQHandler
+    .word   EXTI15_10_IRQHandler
+    .word   RTCAlarm_IRQHandler
+    .word   USBWakeUp_IRQHandler
 
     .section .text.Reset_Handler
     .weak Reset_Handler
@@ -71,6 +115,68 @@ Reset_Handler:
     .weak UsageFault_Handler
     .thumb_set UsageFault_Handler, Default_Handler
 
+    .weak SVC_Handler
+    .thumb_set SVC_Handler, Default_Handler
+
+    .weak DebugMon_Handler
+    .thumb_set DebugMon_Handler, Default_Handler
+
+    .weak PendSV_Handler
+    .thumb_set PendSV_Handler, Default_Handler
+
+    .weak SysTick_Handler
+    .thumb_set SysTick_Handler, Default_Handler
+
+// Ngắt ngoại vi: driver nào định nghĩa handler thì đè lên bản weak
+    .macro IRQ_DEFAULT handler
+    .weak \handler
+    .thumb_set \handler, Default_Handler
+    .endm
+
+    IRQ_DEFAULT WWDG_IRQHandler
+    IRQ_DEFAULT PVD_IRQHandler
+    IRQ_DEFAULT TAMPER_IRQHandler
+    IRQ_DEFAULT RTC_IRQHandler
+    IRQ_DEFAULT FLASH_IRQHandler
+    IRQ_DEFAULT RCC_IRQHandler
+    IRQ_DEFAULT EXTI0_IRQHandler
+    IRQ_DEFAULT EXTI1_IRQHandler
+    IRQ_DEFAULT EXTI2_IRQHandler
+    IRQ_DEFAULT EXTI3_IRQHandler
+    IRQ_DEFAULT EXTI4_IRQHandler
+    IRQ_DEFAULT DMA1_Channel1_IRQHandler
+    IRQ_DEFAULT DMA1_Channel2_IRQHandler
+    IRQ_DEFAULT DMA1_Channel3_IRQHandler
+    IRQ_DEFAULT DMA1_Channel4_IRQHandler
+    IRQ_DEFAULT DMA1_Channel5_IRQHandler
+    IRQ_DEFAULT DMA1_Channel6_IRQHandler
+    IRQ_DEFAULT DMA1_Channel7_IRQHandler
+    IRQ_DEFAULT ADC1_2_IRQHandler
+    IRQ_DEFAULT USB_HP_CAN1_TX_IRQHandler
+    IRQ_DEFAULT USB_LP_CAN1_RX0_IRQHandler
+    IRQ_DEFAULT CAN1_RX1_IRQHandler
+    IRQ_DEFAULT CAN1_SCE_IRQHandler
+    IRQ_DEFAULT EXTI9_5_IRQHandler
+    IRQ_DEFAULT TIM1_BRK_IRQHandler
+    IRQ_DEFAULT TIM1_UP_IRQHandler
+    IRQ_DEFAULT TIM1_TRG_COM_IRQHandler
+    IRQ_DEFAULT TIM1_CC_IRQHandler
+    IRQ_DEFAULT TIM2_IRQHandler
+    IRQ_DEFAULT TIM3_IRQHandler
+    IRQ_DEFAULT TIM4_IRQHandler
+    IRQ_DEFAULT I2C1_EV_IRQHandler
+    IRQ_DEFAULT I2C1_ER_IRQHandler
+    IRQ_DEFAULT I2C2_EV_IRQHandler
+    IRQ_DEFAULT I2C2_ER_IRQHandler
+    IRQ_DEFAULT SPI1_IRQHandler
+    IRQ_DEFAULT SPI2_IRQHandler
+    IRQ_DEFAULT USART1_IRQHandler
+    IRQ_DEFAULT USART2_IRQHandler
+    IRQ_DEFAULT USART3_IRQHandler
+    IRQ_DEFAULT EXTI15_10_IRQHandler
+    IRQ_DEFAULT RTCAlarm_IRQHandler
+    IRQ_DEFAULT USBWakeUp_IRQHandler
+
 Default_Handler:
     b .
 
@@ -0,0 +1,889 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file    mcal_gen.py
+@brief   Sinh file cấu hình Port/Pwm/Dio từ một mô tả chân/timer JSON
+@details Đọc TOOLS/mcal_config.json, kiểm tra xung đột rồi sinh:
+           INC/Portconfig.h, SRC/Portconfig.c  (bảng pin + ảnh CRL/CRH/ODR)
+           INC/Pwm_Lcfg.h,   SRC/Pwm_Lcfg.c    (kênh PWM + con trỏ CCR)
+           INC/Dio_Lcfg.h,   SRC/Dio_Lcfg.c    (tên kênh, nhóm kênh ảo, bus,
+                                                chống dội, dispatch EXTI)
+         Xung đột bị từ chối (mã thoát 1): một chân khai báo hai lần hoặc
+         vừa là DIO vừa là đầu ra timer, kênh timer đặt sai chân, các kênh
+         của một timer cần hai kiểu remap AFIO khác nhau, chân còn thuộc
+         SWJ (JTAG/SWD), hai remap cho cùng một ngoại vi, hai kênh cùng
+         timer khác prescaler/period. Với mục "dio": một chân thuộc hai
+         nhóm/bus/cổng lọc/line EXTI, chân Port không phải DIO, nhóm quá
+         16 chân hoặc trên hơn 2 cổng, depth ngoài 1..15, line EXTI trùng.
+
+         python3 TOOLS/mcal_gen.py            ghi các file cấu hình
+         python3 TOOLS/mcal_gen.py --check    so với file đã commit
+         python3 TOOLS/mcal_gen.py --selftest chạy các ca cấu hình sai
+@version 1.0
+@date    2026-10-18
+@author  HALA Academy
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_CONFIG = os.path.join("TOOLS", "mcal_config.json")
+
+# ===============================
+#   Mô tả MCU (STM32F103, RM0008)
+# ===============================
+
+PORTS = "ABCD"
+MODES = ["DIO", "ADC", "PWM", "SPI", "CAN", "LIN", "AF_OD"]
+PULLS = ["NONE", "UP", "DOWN"]
+SAFE_STATES = ["ANALOG", "KEEP", "LOW", "HIGH"]  # PORT_SAFE_xxx
+SPEEDS = {2: 0, 10: 1, 50: 2}                  # MHz -> PORT_SPEED_xMhz
+SPEED_MODE = {0: 0x2, 1: 0x1, 2: 0x3}          # PORT_SPEED_xMhz -> MODE[1:0]
+PWM_CLASSES = ["VARIABLE_PERIOD", "FIXED_PERIOD", "FIXED_PERIOD_SHIFTED"]
+
+CNF_IN_ANALOG = 0x0
+CNF_IN_FLOATING = 0x4
+CNF_IN_PULL = 0x8
+CNF_OUT_PP = 0x0
+CNF_OUT_OD = 0x4
+CNF_AF_PP = 0x8
+CNF_AF_OD = 0xC
+
+# PORT_REMAP_xxx -> (trường AFIO_MAPR, giá trị); thứ tự theo bit trong MAPR
+REMAPS = {
+    "SPI1": ("SPI1", 1), "I2C1": ("I2C1", 1), "USART1": ("USART1", 1), "USART2": ("USART2", 1),
+    "USART3_PARTIAL": ("USART3", 1), "USART3_FULL": ("USART3", 3),
+    "TIM1_PARTIAL": ("TIM1", 1), "TIM1_FULL": ("TIM1", 3),
+    "TIM2_PARTIAL1": ("TIM2", 1), "TIM2_PARTIAL2": ("TIM2", 2), "TIM2_FULL": ("TIM2", 3),
+    "TIM3_PARTIAL": ("TIM3", 2), "TIM3_FULL": ("TIM3", 3), "TIM4": ("TIM4", 1),
+    "CAN_PB8_PB9": ("CAN", 2), "CAN_PD0_PD1": ("CAN", 3), "PD01": ("PD01", 1),
+}
+
+# Chân CH1..CH4 của timer theo từng remap (None = mặc định), mặc định trước.
+# TIM1 full remap ra cổng E, ngoài phạm vi Port (A..D).
+TIMER_REMAPS = {
+    "TIM1": [(None,            ["PA8", "PA9", "PA10", "PA11"]),
+             ("TIM1_PARTIAL",  ["PA8", "PA9", "PA10", "PA11"])],
+    "TIM2": [(None,            ["PA0", "PA1", "PA2", "PA3"]),
+             ("TIM2_PARTIAL1", ["PA15", "PB3", "PA2", "PA3"]),
+             ("TIM2_PARTIAL2", ["PA0", "PA1", "PB10", "PB11"]),
+             ("TIM2_FULL",     ["PA15", "PB3", "PB10", "PB11"])],
+    "TIM3": [(None,            ["PA6", "PA7", "PB0", "PB1"]),
+             ("TIM3_PARTIAL",  ["PB4", "PB5", "PB0", "PB1"]),
+             ("TIM3_FULL",     ["PC6", "PC7", "PC8", "PC9"])],
+    "TIM4": [(None,            ["PB6", "PB7", "PB8", "PB9"]),
+             ("TIM4",          ["PD12", "PD13", "PD14", "PD15"])],
+}
+
+# Chân còn thuộc debug port theo SWJ_CFG, và macro PORT_SWJ_xxx tương ứng
+SWJ_RESERVED = {
+    "full":     ["PA13", "PA14", "PA15", "PB3", "PB4"],
+    "nojntrst": ["PA13", "PA14", "PA15", "PB3"],
+    "swd":      ["PA13", "PA14"],
+    "disabled": [],
+}
+
+# Giới hạn của Dio (DIO_VGROUP_MAX_PINS, DIO_DEBOUNCE_MAX_DEPTH)
+DIO_VGROUP_MAX_PINS = 16
+DIO_DEBOUNCE_MAX_DEPTH = 15
+DIO_EDGES = ["RISING", "FALLING", "BOTH"]
+# Chân strobe của mỗi kiểu bus: (khóa JSON, vai trò)
+DIO_BUS_STROBES = {"8080": [("wr", "WR"), ("rd", "RD")], "6800": [("e", "E"), ("rw", "R/W")]}
+
+
+class ConfigError(Exception):
+    pass
+
+
+# ===============================
+#   Đọc và kiểm tra mô tả
+# ===============================
+
+def parse_pin(text, where):
+    m = re.fullmatch(r"P([A-Z])(\d{1,2})", str(text))
+    if not m or m.group(1) not in PORTS or int(m.group(2)) > 15:
+        raise ConfigError("%s: invalid pin '%s' (expected PA0..PD15)" % (where, text))
+    return PORTS.index(m.group(1)), int(m.group(2))
+
+
+def pin_name(port, pin):
+    return "P%s%d" % (PORTS[port], pin)
+
+
+def choice(entry, key, allowed, default, where):
+    value = entry.get(key, default)
+    if value not in allowed:
+        raise ConfigError("%s: %s must be one of %s, got '%s'" %
+                          (where, key, "/".join(str(a) for a in allowed), value))
+    return value
+
+
+def number(entry, key, low, high, default, where):
+    value = entry.get(key, default)
+    if not isinstance(value, int) or isinstance(value, bool) or not low <= value <= high:
+        raise ConfigError("%s: %s must be an integer in %d..%d, got %r" %
+                          (where, key, low, high, value))
+    return value
+
+
+def identifier(entry, key, where):
+    value = entry.get(key)
+    if value is not None and not re.fullmatch(r"[A-Za-z_]\w*", str(value)):
+        raise ConfigError("%s: %s '%s' is not a C identifier" % (where, key, value))
+    return value
+
+
+def load_pins(desc):
+    pins, owner = [], {}
+    for i, entry in enumerate(desc.get("pins", [])):
+        where = "pins[%d]" % i
+        port, pin = parse_pin(entry.get("pin"), where)
+        name = pin_name(port, pin)
+        where = "%s (%s)" % (where, name)
+        if name in owner:
+            raise ConfigError("%s: pin claimed twice (also %s)" % (where, owner[name]))
+        owner[name] = where
+        mode = choice(entry, "mode", MODES, None, where)
+        default_dir = "OUT" if mode == "PWM" else "IN"
+        p = {
+            "port": port, "pin": pin, "text": name, "mode": mode,
+            "name": identifier(entry, "name", where),
+            "direction": choice(entry, "direction", ["IN", "OUT"], default_dir, where),
+            "level": choice(entry, "level", ["LOW", "HIGH"], "LOW", where),
+            "pull": choice(entry, "pull", PULLS, "NONE", where),
+            "speed": SPEEDS[choice(entry, "speed", list(SPEEDS), 2, where)],
+            "dirChangeable": bool(entry.get("directionChangeable", False)),
+            "modeChangeable": bool(entry.get("modeChangeable", False)),
+            "sleep": choice(entry, "sleep", ["ANALOG", "KEEP"], "ANALOG", where),
+            "safe": choice(entry, "safe", SAFE_STATES, "ANALOG", where),
+            "owner": None,
+        }
+        if mode == "PWM" and p["direction"] != "OUT":
+            raise ConfigError("%s: PWM pin must be an output" % where)
+        pins.append(p)
+    return pins
+
+
+def load_pwm(desc):
+    channels, used = [], {}
+    for i, entry in enumerate(desc.get("pwm", [])):
+        where = "pwm[%d]" % i
+        timer = choice(entry, "timer", list(TIMER_REMAPS), None, where)
+        ch = number(entry, "channel", 1, 4, None, where)
+        key = "%s_CH%d" % (timer, ch)
+        where = "%s (%s)" % (where, key)
+        if key in used:
+            raise ConfigError("%s: timer channel used twice (also %s)" % (where, used[key]))
+        used[key] = where
+        port, pin = parse_pin(entry.get("pin"), where)
+        channels.append({
+            "timer": timer, "channel": ch, "key": key, "where": where,
+            "port": port, "pin": pin, "text": pin_name(port, pin),
+            "name": identifier(entry, "name", where),
+            "class": choice(entry, "class", PWM_CLASSES, "VARIABLE_PERIOD", where),
+            "prescaler": number(entry, "prescaler", 0, 0xFFFF, 0, where),
+            "period": number(entry, "period", 0, 0xFFFF, None, where),
+            "duty": number(entry, "duty", 0, 0x8000, 0, where),
+            "polarity": choice(entry, "polarity", ["HIGH", "LOW"], "HIGH", where),
+            "idle": choice(entry, "idle", ["HIGH", "LOW"], "LOW", where),
+            "notification": identifier(entry, "notification", where),
+        })
+    return channels
+
+
+def load_remaps(desc):
+    """Remap khai báo tay: trường AFIO_MAPR -> tên PORT_REMAP_xxx."""
+    fields = {}
+    for name in desc.get("remap", []):
+        if name not in REMAPS:
+            raise ConfigError("remap: unknown '%s' (valid: %s)" % (name, ", ".join(REMAPS)))
+        field = REMAPS[name][0]
+        if field in fields and fields[field] != name:
+            raise ConfigError("remap: %s and %s need incompatible AFIO remaps" %
+                              (fields[field], name))
+        fields[field] = name
+    return fields
+
+
+def select_remaps(channels, fields):
+    """Kiểu remap duy nhất cho mỗi timer khớp mọi kênh đang dùng."""
+    remaps = {}
+    for timer, options in TIMER_REMAPS.items():
+        mine = [c for c in channels if c["timer"] == timer]
+        if timer in fields:
+            options = [(name, outs) for name, outs in options if name == fields[timer]]
+        fits = [(name, outs) for name, outs in options
+                if all(outs[c["channel"] - 1] == c["text"] for c in mine)]
+        if not fits:
+            if timer in fields:
+                raise ConfigError("%s: channels %s need incompatible AFIO remaps (remap %s)" %
+                                  (timer, ", ".join("%s on %s" % (c["key"], c["text"]) for c in mine),
+                                   fields[timer]))
+            for c in mine:
+                if not any(outs[c["channel"] - 1] == c["text"] for _, outs in options):
+                    allowed = sorted({outs[c["channel"] - 1] for _, outs in options})
+                    raise ConfigError("%s: %s is not an output of %s (valid: %s)" %
+                                      (c["where"], c["text"], c["key"], ", ".join(allowed)))
+            raise ConfigError("%s: channels %s need incompatible AFIO remaps" %
+                              (timer, ", ".join("%s on %s" % (c["key"], c["text"]) for c in mine)))
+        remaps[timer] = fits[0]
+    return remaps
+
+
+def load_dio(desc, swj, pins):
+    """Mục "dio": nhóm kênh ảo, bus song song, chống dội, dispatch EXTI."""
+    dio = desc.get("dio", {})
+    port_pins = {p["text"]: p for p in pins}
+    owner = {}
+
+    def claim(text, where):
+        port, pin = parse_pin(text, where)
+        name = pin_name(port, pin)
+        if name in SWJ_RESERVED[swj]:
+            raise ConfigError("%s: pin %s is reserved for the debug port with swj '%s'" %
+                              (where, name, swj))
+        if name in owner:
+            raise ConfigError("%s: pin %s claimed twice (also %s)" % (where, name, owner[name]))
+        p = port_pins.get(name)
+        if p is not None and p["mode"] != "DIO":
+            raise ConfigError("%s: pin %s is configured as %s in 'pins'" % (where, name, p["mode"]))
+        owner[name] = where
+        return port, pin
+
+    def pin_list(entry, where):
+        texts = entry.get("pins")
+        if not isinstance(texts, list):
+            raise ConfigError("%s: pins must be a list" % where)
+        return [claim(t, where) for t in texts]
+
+    groups = []
+    for i, entry in enumerate(dio.get("groups", [])):
+        where = "dio.groups[%d]" % i
+        name = identifier(entry, "name", where)
+        if not name:
+            raise ConfigError("%s: name is required" % where)
+        where = "%s (%s)" % (where, name)
+        group = pin_list(entry, where)
+        if not 1 <= len(group) <= DIO_VGROUP_MAX_PINS:
+            raise ConfigError("%s: virtual group takes 1..%d pins, got %d" %
+                              (where, DIO_VGROUP_MAX_PINS, len(group)))
+        ports = []
+        for port, _ in group:
+            if port not in ports:
+                ports.append(port)
+        if len(ports) > 2:
+            raise ConfigError("%s: virtual group spans more than 2 ports" % where)
+        groups.append({"name": name, "pins": group, "ports": ports + ports[:1]})
+
+    buses = []
+    for i, entry in enumerate(dio.get("buses", [])):
+        where = "dio.buses[%d]" % i
+        name = identifier(entry, "name", where)
+        if not name:
+            raise ConfigError("%s: name is required" % where)
+        where = "%s (%s)" % (where, name)
+        kind = choice(entry, "type", list(DIO_BUS_STROBES), None, where)
+        strobes = [claim(entry.get(key), "%s %s" % (where, role))
+                   for key, role in DIO_BUS_STROBES[kind]]
+        data = entry.get("data")
+        if not isinstance(data, list) or len(data) != 8:
+            raise ConfigError("%s: data must list 8 pins D0..D7" % where)
+        data = [claim(t, where) for t in data]
+        if len({port for port, _ in data}) != 1:
+            raise ConfigError("%s: bus data pins must share one port" % where)
+        buses.append({"name": name, "type": kind, "strobes": strobes, "data": data})
+
+    debounce, debounced_ports = [], {}
+    for i, entry in enumerate(dio.get("debounce", [])):
+        where = "dio.debounce[%d]" % i
+        group = pin_list(entry, where)
+        depth = number(entry, "depth", 1, DIO_DEBOUNCE_MAX_DEPTH, None, where)
+        ports = {port for port, _ in group}
+        if len(ports) != 1:
+            raise ConfigError("%s: debounce pins must share one port" % where)
+        port = ports.pop()
+        if port in debounced_ports:
+            raise ConfigError("%s: debounce port %s configured twice (also %s)" %
+                              (where, PORTS[port], debounced_ports[port]))
+        debounced_ports[port] = where
+        mask = sum(1 << pin for _, pin in group)
+        debounce.append({"port": port, "pins": group, "mask": mask, "depth": depth})
+
+    edges, lines = [], {}
+    for i, entry in enumerate(dio.get("edges", [])):
+        where = "dio.edges[%d]" % i
+        port, pin = claim(entry.get("pin"), where)
+        if pin in lines:
+            raise ConfigError("%s: EXTI line %d used twice (also %s)" % (where, pin, lines[pin]))
+        lines[pin] = where
+        notification = identifier(entry, "notification", where)
+        if not notification:
+            raise ConfigError("%s: notification is required" % where)
+        edges.append({"port": port, "pin": pin,
+                      "edge": choice(entry, "edge", DIO_EDGES, None, where),
+                      "notification": notification})
+    edges.sort(key=lambda e: e["pin"])
+
+    return {"groups": groups, "buses": buses, "debounce": debounce, "edges": edges}
+
+
+def check(desc):
+    swj = choice(desc, "swj", list(SWJ_RESERVED), "full", "swj")
+    pins = load_pins(desc)
+    channels = load_pwm(desc)
+    fields = load_remaps(desc)
+    remaps = select_remaps(channels, fields)
+    for timer, (name, _) in remaps.items():
+        if name:
+            fields[timer] = name
+    by_name = {p["text"]: p for p in pins}
+
+    for p in pins:
+        if p["text"] in SWJ_RESERVED[swj]:
+            raise ConfigError("%s: pin is reserved for the debug port with swj '%s'" %
+                              (p["text"], swj))
+
+    for c in channels:
+        p = by_name.get(c["text"])
+        if p is None:
+            raise ConfigError("%s: pin %s is not configured in 'pins'" % (c["where"], c["text"]))
+        if p["mode"] != "PWM":
+            raise ConfigError("%s: pin %s is claimed by %s but configured as %s" %
+                              (c["where"], c["text"], c["key"], p["mode"]))
+        p["owner"] = c["key"]
+
+    # Kênh cùng timer dùng chung PSC/ARR
+    for timer in TIMER_REMAPS:
+        mine = [c for c in channels if c["timer"] == timer]
+        for c in mine[1:]:
+            if (c["prescaler"], c["period"]) != (mine[0]["prescaler"], mine[0]["period"]):
+                raise ConfigError("%s: prescaler/period differ from %s on the same timer" %
+                                  (c["where"], mine[0]["key"]))
+
+    # Chân PWM không có kênh Pwm vẫn phải là đầu ra timer theo remap đã chọn
+    for p in pins:
+        if p["mode"] != "PWM" or p["owner"]:
+            continue
+        for timer, (_, outs) in sorted(remaps.items()):
+            if p["text"] in outs:
+                p["owner"] = "%s_CH%d" % (timer, outs.index(p["text"]) + 1)
+                break
+        else:
+            raise ConfigError("%s: PWM pin is not a timer output with the selected AFIO remaps" %
+                              p["text"])
+
+    mapr = sorted(fields.values(), key=list(REMAPS).index)
+    dio = load_dio(desc, swj, pins)
+    return {"swj": swj, "pins": pins, "pwm": channels, "remaps": remaps, "mapr": mapr, "dio": dio}
+
+
+# ===============================
+#   Ảnh thanh ghi (giống Port_NibbleLut)
+# ===============================
+
+def pin_nibble(p):
+    """(nibble CNF:MODE, 'set'/'reset'/None cho ODR) như PORT_LUT_ENTRY."""
+    speed = SPEED_MODE[p["speed"]]
+    if p["mode"] == "ADC":
+        return CNF_IN_ANALOG, None
+    if p["mode"] == "PWM":
+        return CNF_AF_PP | speed, None
+    if p["mode"] == "AF_OD":
+        return CNF_AF_OD | speed, None
+    if p["direction"] == "OUT":
+        if p["mode"] == "DIO":
+            return (CNF_OUT_PP if p["pull"] == "UP" else CNF_OUT_OD) | speed, None
+        return CNF_AF_PP | speed, None
+    if p["pull"] == "UP":
+        return CNF_IN_PULL, "set"
+    if p["pull"] == "DOWN":
+        return CNF_IN_PULL, "reset"
+    return CNF_IN_FLOATING, None
+
+
+def profile_pin(prof, pin, state):
+    """Một pin vào ảnh profile như Port_BuildProfilePin."""
+    reg = "Crl" if pin < 8 else "Crh"
+    shift = (pin & 7) * 4
+    if state == "KEEP":
+        prof[reg + "Keep"] |= 0xF << shift
+    elif state != "ANALOG":
+        prof[reg] |= (CNF_OUT_PP | SPEED_MODE[0]) << shift
+        prof["Bsrr"] |= (1 << pin) << (0 if state == "HIGH" else 16)
+
+
+def build_images(pins):
+    images = [dict(Crl=0, CrlMask=0, CrlCheck=0, Crh=0, CrhMask=0, CrhCheck=0, Bsrr=0, Pins=0,
+                   Profiles=[dict(CrlKeep=0, CrhKeep=0, Crl=0, Crh=0, Bsrr=0) for _ in range(2)])
+              for _ in PORTS]
+    for p in pins:
+        img = images[p["port"]]
+        nibble, odr = pin_nibble(p)
+        reg = "Crl" if p["pin"] < 8 else "Crh"
+        shift = (p["pin"] & 7) * 4
+        img[reg] |= nibble << shift
+        img[reg + "Mask"] |= 0xF << shift
+        if not p["dirChangeable"]:
+            img[reg + "Check"] |= 0xF << shift
+        if p["direction"] == "OUT":
+            odr = "set" if p["level"] == "HIGH" else "reset"
+        if odr:
+            img["Bsrr"] |= (1 << p["pin"]) << (0 if odr == "set" else 16)
+        profile_pin(img["Profiles"][0], p["pin"], p["sleep"])
+        profile_pin(img["Profiles"][1], p["pin"], p["safe"])
+        img["Pins"] |= 1 << p["pin"]
+    return images
+
+
+# ===============================
+#   Sinh file C
+# ===============================
+
+def banner(name, brief, details):
+    lines = ["/**********************************************************",
+             " * @file    %s" % name,
+             " * @brief   %s" % brief]
+    for i, text in enumerate(details):
+        lines.append((" * @details " if i == 0 else " *          ") + text)
+    lines += [" * @version 1.0",
+              " * @date    2026-10-18",
+              " * @author  HALA Academy",
+              " **********************************************************/",
+              ""]
+    return lines
+
+
+GENERATED = ["File sinh bởi TOOLS/mcal_gen.py từ TOOLS/mcal_config.json,",
+             "không sửa tay: sửa file JSON rồi chạy make config."]
+
+
+def pin_comment(p):
+    if p["mode"] == "DIO":
+        text = "DIO, %s" % ("Output %s" % p["level"] if p["direction"] == "OUT" else "Input")
+        if p["pull"] != "NONE":
+            text += ", pull-%s" % p["pull"].lower()
+    else:
+        text = p["mode"] + (", " + p["owner"] if p["owner"] else "")
+    changeable = [w for w, f in (("chiều", p["dirChangeable"]), ("mode", p["modeChangeable"])) if f]
+    if changeable:
+        text += ", đổi %s runtime" % " & ".join(changeable)
+    if p["sleep"] == "KEEP":
+        text += ", giữ khi sleep"
+    if p["safe"] != "ANALOG":
+        text += ", safe %s" % p["safe"]
+    return "%s: %s%s" % (p["text"], text, " (%s)" % p["name"] if p["name"] else "")
+
+
+def gen_portconfig_h(cfg):
+    out = banner("Portconfig.h", "Port Driver Configuration Header File",
+                 GENERATED + ["Bảng pin và ảnh thanh ghi từng cổng cho Port_Init."])
+    out += ["#ifndef PORT_CFG_H",
+            "#define PORT_CFG_H",
+            "",
+            "#include \"Port.h\"   /* Bao gồm các kiểu dữ liệu chuẩn của Port Driver */",
+            "",
+            "/* Số lượng chân Port được cấu hình */",
+            "#define PortCfg_PinsCount    %dU" % len(cfg["pins"]),
+            "",
+            "extern const Port_PinConfigType PortCfg_Pins[];",
+            "extern const Port_ImageType PortCfg_Images[PORT_COUNT];",
+            "",
+            "/* Cấu hình tổng truyền cho Port_Init (kèm ảnh sinh sẵn) */",
+            "extern const Port_ConfigType PortCfg_Config;",
+            "",
+            "#endif /* PORT_CFG_H */",
+            ""]
+    return out
+
+
+def gen_portconfig_c(cfg):
+    out = banner("Portconfig.c", "Port Driver Configuration Source File",
+                 GENERATED + ["PortCfg_Images là ảnh CRL/CRH/ODR Port_Init sẽ dựng từ",
+                              "PortCfg_Pins, tính sẵn để bỏ bước dựng ảnh lúc khởi động.",
+                              "Trường pin đi qua PORT_CFG_xxx: giá trị ngoài miền, hoặc",
+                              "PortCfg_PinsCount lệch số dòng, dừng biên dịch."])
+    out += ["#include \"Portconfig.h\"", "",
+            "const Port_PinConfigType PortCfg_Pins[] = {"]
+    speed_names = {0: "PORT_SPEED_2Mhz", 1: "PORT_SPEED_10Mhz", 2: "PORT_SPEED_50Mhz"}
+    for i, p in enumerate(cfg["pins"]):
+        out += ["    /* %s */" % pin_comment(p),
+                "    {",
+                "        .PortNum             = PORT_CFG_PORT(PORT_ID_%s)," % PORTS[p["port"]],
+                "        .PinNum              = PORT_CFG_PIN(%d)," % p["pin"],
+                "        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_%s)," % p["mode"],
+                "        .Speed               = PORT_CFG_SPEED(%s)," % speed_names[p["speed"]],
+                "        .Direction           = PORT_PIN_%s," % p["direction"],
+                "        .DirectionChangeable = %d," % p["dirChangeable"],
+                "        .Level               = PORT_PIN_LEVEL_%s," % p["level"],
+                "        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_%s)," % p["pull"],
+                "        .ModeChangeable      = %d," % p["modeChangeable"],
+                "        .SleepKeep           = %d," % (p["sleep"] == "KEEP"),
+                "        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_%s)" % p["safe"],
+                "    }" + ("," if i + 1 < len(cfg["pins"]) else "")]
+    out += ["};", "",
+            "_Static_assert(PORT_ARRAY_SIZE(PortCfg_Pins) == PortCfg_PinsCount,",
+            "               \"PortCfg_PinsCount does not match PortCfg_Pins[]\");",
+            "",
+            "const Port_ImageType PortCfg_Images[PORT_COUNT] = {"]
+    images = build_images(cfg["pins"])
+    for port, img in enumerate(images):
+        out.append("    [PORT_ID_%s] = { .Crl = 0x%08XUL, .CrlMask = 0x%08XUL, .CrlCheck = 0x%08XUL,"
+                   % (PORTS[port], img["Crl"], img["CrlMask"], img["CrlCheck"]))
+        out.append("                    .Crh = 0x%08XUL, .CrhMask = 0x%08XUL, .CrhCheck = 0x%08XUL,"
+                   % (img["Crh"], img["CrhMask"], img["CrhCheck"]))
+        out.append("                    .Bsrr = 0x%08XUL, .Pins = 0x%04XU,"
+                   % (img["Bsrr"], img["Pins"]))
+        for i, (name, prof) in enumerate(zip(("SLEEP", "SAFE"), img["Profiles"])):
+            out.append("                    .Profiles[PORT_PROFILE_%s - 1U] = {" % name)
+            out.append("                        .CrlKeep = 0x%08XUL, .Crl = 0x%08XUL,"
+                       % (prof["CrlKeep"], prof["Crl"]))
+            out.append("                        .CrhKeep = 0x%08XUL, .Crh = 0x%08XUL, .Bsrr = 0x%08XUL }%s"
+                       % (prof["CrhKeep"], prof["Crh"], prof["Bsrr"], "," if i == 0 else " }"))
+        out[-1] += "," if port + 1 < len(images) else ""
+    remap = " | ".join("PORT_REMAP_" + name for name in cfg["mapr"]) or "PORT_REMAP_NONE"
+    out += ["};", "",
+            "const Port_ConfigType PortCfg_Config = {",
+            "    .PinConfigs = PortCfg_Pins,",
+            "    .PinCount   = PORT_ARRAY_SIZE(PortCfg_Pins),",
+            "    .Images     = PortCfg_Images,",
+            "    .Remap      = %s," % remap,
+            "    .SwjCfg     = PORT_SWJ_%s" % cfg["swj"].upper(),
+            "};",
+            ""]
+    return out
+
+
+def gen_pwm_lcfg_h(cfg):
+    out = banner("Pwm_Lcfg.h", "PWM Driver Configuration Header File (AUTOSAR)",
+                 GENERATED + ["Khai báo cấu hình tổng, tên kênh và callback của PWM Driver."])
+    out += ["#ifndef PWM_LCFG_H",
+            "#define PWM_LCFG_H",
+            "",
+            "#include \"Pwm.h\"",
+            ""]
+    named = [(i, c) for i, c in enumerate(cfg["pwm"]) if c["name"]]
+    if named:
+        width = max(len(c["name"]) for _, c in named)
+        out.append("/* Chỉ số kênh cho Pwm_SetDutyCycle... */")
+        out += ["#define PwmConf_PwmChannel_%s %dU  /* %s, %s */" %
+                (c["name"].ljust(width), i, c["key"], c["text"]) for i, c in named]
+        out.append("")
+    callbacks = sorted({c["notification"] for c in cfg["pwm"] if c["notification"]})
+    if callbacks:
+        out.append("/* Callback notification, hiện thực ở Pwm_Cbk.c */")
+        out += ["void %s(void);" % cb for cb in callbacks]
+        out.append("")
+    out += ["/**********************************************************",
+            " * @brief   Biến cấu hình tổng cho PWM Driver",
+            " **********************************************************/",
+            "extern const Pwm_ConfigType PwmDriverConfig;",
+            "",
+            "#endif /* PWM_LCFG_H */",
+            ""]
+    return out
+
+
+def gen_pwm_lcfg_c(cfg):
+    out = banner("Pwm_Lcfg.c", "PWM Driver Configuration Source File (AUTOSAR)",
+                 GENERATED + ["Mỗi kênh mang sẵn con trỏ tới thanh ghi CCR của nó; timer,",
+                              "channel và CCR cùng sinh từ một PWM_CFG_CH. Chân và remap",
+                              "AFIO đã được kiểm tra khi sinh, timer/channel/duty được",
+                              "PWM_CFG_xxx kiểm tra lại lúc biên dịch."])
+    out += ["#include \"Pwm.h\"",
+            "#include \"Pwm_Lcfg.h\"",
+            "#include <stddef.h>",
+            ""]
+    if cfg["pwm"]:
+        out.append("static const Pwm_ChannelConfigType PwmChannelsConfig[] = {")
+        for i, c in enumerate(cfg["pwm"]):
+            remap = cfg["remaps"][c["timer"]][0]
+            out += ["    /* Channel %d: %s - %s%s%s */" %
+                    (i, c["text"], c["key"], ", PORT_REMAP_" + remap if remap else "",
+                     " (%s)" % c["name"] if c["name"] else ""),
+                    "    {",
+                    "        PWM_CFG_CH(%s, %d),      /* .TIMx, .channel, .ccr */" % (c["timer"][3:], c["channel"]),
+                    "        .classType        = PWM_%s," % c["class"],
+                    "        .prescaler        = %d," % c["prescaler"],
+                    "        .defaultPeriod    = %d," % c["period"],
+                    "        .defaultDutyCycle = PWM_CFG_DUTY(0x%04X)," % c["duty"],
+                    "        .polarity         = PWM_%s," % c["polarity"],
+                    "        .idleState        = PWM_%s," % c["idle"],
+                    "        .NotificationCb   = %s" % (c["notification"] or "NULL"),
+                    "    }" + ("," if i + 1 < len(cfg["pwm"]) else "")]
+        out += ["};", ""]
+    out += ["const Pwm_ConfigType PwmDriverConfig = {",
+            "    .Channels    = %s," % ("PwmChannelsConfig" if cfg["pwm"] else "NULL"),
+            "    .NumChannels = %s" % ("PWM_CFG_COUNT(PwmChannelsConfig)" if cfg["pwm"] else "0U"),
+            "};",
+            ""]
+    return out
+
+
+def channel(port, pin):
+    return "DIO_CHANNEL_%s%d" % (PORTS[port], pin)
+
+
+def pin_texts(group):
+    return ", ".join(pin_name(port, pin) for port, pin in group)
+
+
+def wrap_args(args, per_line):
+    """Danh sách đối số macro, per_line phần tử mỗi dòng, thụt 4."""
+    rows = [args[i:i + per_line] for i in range(0, len(args), per_line)]
+    return ",\n".join("    " + ", ".join(row) for row in rows)
+
+
+def gen_dio_lcfg_h(cfg):
+    dio = cfg["dio"]
+    out = banner("Dio_Lcfg.h", "DIO Driver Configuration Header File",
+                 GENERATED + ["Tên kênh theo chức năng cho các chân DIO có \"name\", số cổng",
+                              "chống dội và khai báo các bảng cấu hình của ứng dụng."])
+    out += ["#ifndef DIO_LCFG_H",
+            "#define DIO_LCFG_H",
+            "",
+            "#include \"Dio.h\"",
+            "#include \"Dio_Bus.h\"",
+            "#include \"Dio_Debounce.h\"",
+            "#include \"Dio_Edge.h\"",
+            ""]
+    named = [p for p in cfg["pins"] if p["mode"] == "DIO" and p["name"]]
+    if named:
+        width = max(len(p["name"]) for p in named)
+        out += ["#define DioConf_DioChannel_%s %s" % (p["name"].ljust(width), channel(p["port"], p["pin"]))
+                for p in named]
+        out.append("")
+    out += ["/* Số phần tử của Dio_DebounceConfig (mỗi cổng tối đa một) */",
+            "#define DIO_DEBOUNCE_PORT_COUNT %dU" % len(dio["debounce"]),
+            ""]
+    if dio["groups"]:
+        out.append("/* Nhóm kênh ảo (Dio_ReadVirtualGroup/Dio_WriteVirtualGroup) */")
+        width = max(len(g["name"]) for g in dio["groups"])
+        out += ["extern const Dio_VirtualGroupType %s  /* %d bit, cổng %s */" %
+                ((g["name"] + ";").ljust(width + 1), len(g["pins"]),
+                 "/".join(PORTS[port] for port in sorted(set(g["ports"])))) for g in dio["groups"]]
+        out.append("")
+    if dio["buses"]:
+        out.append("/* Bus song song 8 bit (Dio_BusWrite/Dio_BusRead) */")
+        width = max(len(b["name"]) for b in dio["buses"])
+        for b in dio["buses"]:
+            roles = DIO_BUS_STROBES[b["type"]]
+            out.append("extern const Dio_BusType %s  /* %s, %s */" %
+                       ((b["name"] + ";").ljust(width + 1), b["type"],
+                        ", ".join("%s = %s" % (role, pin_name(*pin))
+                                  for (_, role), pin in zip(roles, b["strobes"]))))
+        out.append("")
+    if dio["edges"]:
+        callbacks = sorted({e["notification"] for e in dio["edges"]})
+        out += ["/* Bảng dispatch EXTI cho Dio_EdgeInit */",
+                "extern const Dio_EdgeConfigType DioEdgeConfig;",
+                "",
+                "/* Callback báo cạnh (ngữ cảnh ngắt EXTI), hiện thực ở Dio_Cbk.c */"]
+        out += ["void %s(Dio_ChannelType ChannelId, Dio_LevelType Level);" % cb for cb in callbacks]
+        out.append("")
+    out += ["#endif /* DIO_LCFG_H */",
+            ""]
+    return out
+
+
+def gen_dio_lcfg_c(cfg):
+    dio = cfg["dio"]
+    out = banner("Dio_Lcfg.c", "DIO Driver Configuration Source File",
+                 GENERATED + ["Bảng Dio của ứng dụng: nhóm kênh ảo, bus, chống dội và",
+                              "dispatch EXTI. Chân đã được kiểm tra khi sinh (không trùng,",
+                              "không thuộc SWJ hay chân Port khác DIO); DIO_VIRTUAL_GROUP",
+                              "và DIO_CFG_DEBOUNCE kiểm tra lại lúc biên dịch. Bảng tra",
+                              "theo MCU (Dio_ChannelMap...) nằm trong Dio_Cfg.c của libmcal."])
+    out += ["#include \"Dio_Lcfg.h\"",
+            ""]
+    for g in dio["groups"]:
+        out += ["/* %s: D0..D%d = %s */" % (g["name"], len(g["pins"]) - 1, pin_texts(g["pins"])),
+                "const Dio_VirtualGroupType %s = DIO_VIRTUAL_GROUP(DIO_PORT_%s, DIO_PORT_%s," %
+                (g["name"], PORTS[g["ports"][0]], PORTS[g["ports"][1]]),
+                wrap_args([channel(*pin) for pin in g["pins"]], 6) + ");",
+                ""]
+    for b in dio["buses"]:
+        roles = DIO_BUS_STROBES[b["type"]]
+        out += ["/* %s: %s, D0..D7 = %s, %s */" %
+                (b["name"], b["type"], pin_texts(b["data"]),
+                 ", ".join("%s = %s" % (role, pin_name(*pin)) for (_, role), pin in zip(roles, b["strobes"]))),
+                "const Dio_BusType %s = DIO_BUS_%s(%s," %
+                (b["name"], b["type"], ", ".join(channel(*pin) for pin in b["strobes"])),
+                wrap_args([channel(*pin) for pin in b["data"]], 4) + ");",
+                ""]
+    if dio["debounce"]:
+        out.append("const Dio_DebounceConfigType Dio_DebounceConfig[DIO_DEBOUNCE_PORT_COUNT] = {")
+        for i, d in enumerate(dio["debounce"]):
+            entry = "    DIO_CFG_DEBOUNCE(DIO_PORT_%s, 0x%04XU, %dU)%s" % (
+                PORTS[d["port"]], d["mask"], d["depth"], "," if i + 1 < len(dio["debounce"]) else "")
+            out.append("%-48s/* %s */" % (entry, pin_texts(sorted(d["pins"]))))
+        out += ["};",
+                "",
+                "const uint8 Dio_DebounceConfigCount = DIO_DEBOUNCE_PORT_COUNT;",
+                ""]
+    if dio["edges"]:
+        out += ["/* Bảng dispatch EXTI, chỉ số là số line (= số chân) */",
+                "const Dio_EdgeConfigType DioEdgeConfig = {",
+                "    .Lines = {"]
+        for i, e in enumerate(dio["edges"]):
+            out.append("        [%d] = { %s, DIO_EDGE_%s, %s }%s" %
+                       (e["pin"], channel(e["port"], e["pin"]), e["edge"], e["notification"],
+                        "," if i + 1 < len(dio["edges"]) else ""))
+        out += ["    }",
+                "};",
+                ""]
+    return out
+
+
+OUTPUTS = [
+    ("INC/Portconfig.h", gen_portconfig_h),
+    ("SRC/Portconfig.c", gen_portconfig_c),
+    ("INC/Pwm_Lcfg.h", gen_pwm_lcfg_h),
+    ("SRC/Pwm_Lcfg.c", gen_pwm_lcfg_c),
+    ("INC/Dio_Lcfg.h", gen_dio_lcfg_h),
+    ("SRC/Dio_Lcfg.c", gen_dio_lcfg_c),
+]
+
+
+def generate(desc):
+    cfg = check(desc)
+    return {path: "\n".join(fn(cfg)) for path, fn in OUTPUTS}
+
+
+# ===============================
+#   Tự kiểm tra: các cấu hình phải bị từ chối
+# ===============================
+
+def selftest(desc):
+    def pwm(**kw):
+        base = {"timer": "TIM2", "channel": 2, "pin": "PA1", "period": 999}
+        base.update(kw)
+        return base
+
+    def bus(**kw):
+        base = {"name": "B1", "type": "8080", "wr": "PC8", "rd": "PC9",
+                "data": ["PC%d" % n for n in range(8)]}
+        base.update(kw)
+        return base
+
+    def edge(pin):
+        return {"pin": pin, "edge": "FALLING", "notification": "Cb"}
+
+    pa1 = {"pin": "PA1", "mode": "PWM"}
+    cases = [
+        ("pin claimed twice",
+         {"pins": [pa1, {"pin": "PA1", "mode": "DIO"}]}),
+        ("claimed by TIM2_CH2 but configured as DIO",
+         {"pins": [{"pin": "PA1", "mode": "DIO"}], "pwm": [pwm()]}),
+        ("not configured in 'pins'",
+         {"pins": [], "pwm": [pwm()]}),
+        ("PA7 is not an output of TIM2_CH2",
+         {"pins": [{"pin": "PA7", "mode": "PWM"}], "pwm": [pwm(pin="PA7")]}),
+        ("need incompatible AFIO remaps",
+         {"swj": "disabled", "pins": [pa1, {"pin": "PA15", "mode": "PWM"}],
+          "pwm": [pwm(), pwm(channel=1, pin="PA15")]}),
+        ("reserved for the debug port",
+         {"pins": [{"pin": "PB3", "mode": "PWM"}], "pwm": [pwm(pin="PB3")]}),
+        ("timer channel used twice",
+         {"pins": [pa1], "pwm": [pwm(), pwm()]}),
+        ("prescaler/period differ",
+         {"pins": [pa1, {"pin": "PA0", "mode": "PWM"}],
+          "pwm": [pwm(), pwm(channel=1, pin="PA0", period=499)]}),
+        ("not a timer output with the selected AFIO remaps",
+         {"pins": [{"pin": "PC0", "mode": "PWM"}]}),
+        ("CAN_PB8_PB9 and CAN_PD0_PD1 need incompatible AFIO remaps",
+         {"remap": ["CAN_PB8_PB9", "CAN_PD0_PD1"]}),
+        ("need incompatible AFIO remaps (remap TIM2_FULL)",
+         {"remap": ["TIM2_FULL"], "pins": [pa1], "pwm": [pwm()]}),
+        ("unknown 'TIM5'",
+         {"remap": ["TIM5"]}),
+        ("safe must be one of ANALOG/KEEP/LOW/HIGH",
+         {"pins": [{"pin": "PB0", "mode": "DIO", "safe": "OFF"}]}),
+        ("pin PA15 is reserved for the debug port",
+         {"dio": {"groups": [{"name": "G", "pins": ["PA8", "PA15"]}]}}),
+        ("pin PC0 claimed twice",
+         {"dio": {"buses": [bus(), bus(name="B2", wr="PD8", rd="PD9")]}}),
+        ("pin PA1 is configured as PWM",
+         {"pins": [pa1], "dio": {"debounce": [{"pins": ["PA1"], "depth": 4}]}}),
+        ("virtual group takes 1..16 pins",
+         {"dio": {"groups": [{"name": "G", "pins": ["PC%d" % n for n in range(16)] + ["PD0"]}]}}),
+        ("virtual group spans more than 2 ports",
+         {"dio": {"groups": [{"name": "G", "pins": ["PA8", "PB5", "PC0"]}]}}),
+        ("depth must be an integer in 1..15",
+         {"dio": {"debounce": [{"pins": ["PB1"], "depth": 16}]}}),
+        ("debounce port B configured twice",
+         {"dio": {"debounce": [{"pins": ["PB1"], "depth": 4}, {"pins": ["PB2"], "depth": 8}]}}),
+        ("bus data pins must share one port",
+         {"dio": {"buses": [bus(data=["PC0", "PC1", "PC2", "PC3", "PC4", "PC5", "PC6", "PD7"])]}}),
+        ("EXTI line 12 used twice",
+         {"dio": {"edges": [edge("PB12"), edge("PC12")]}}),
+    ]
+    failed = 0
+    for expected, bad in cases:
+        try:
+            check(bad)
+            print("FAIL: accepted config, expected '%s'" % expected)
+            failed += 1
+        except ConfigError as err:
+            if expected not in str(err):
+                print("FAIL: '%s', expected '%s'" % (err, expected))
+                failed += 1
+
+    # Remap hợp lệ: TIM2 partial1 (CH2 trên PB3) khi đã tắt JTAG
+    try:
+        cfg = check({"swj": "swd", "pins": [{"pin": "PB3", "mode": "PWM"}], "pwm": [pwm(pin="PB3")]})
+        if cfg["mapr"] != ["TIM2_PARTIAL1"]:
+            print("FAIL: TIM2 CH2 on PB3 should select partial1")
+            failed += 1
+    except ConfigError as err:
+        print("FAIL: valid remap rejected: %s" % err)
+        failed += 1
+
+    generate(desc)
+    print("mcal_gen selftest: %d case(s), %d failed" % (len(cases) + 1, failed))
+    return 1 if failed else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate Port/Pwm/Dio configuration files")
+    parser.add_argument("config", nargs="?", default=DEFAULT_CONFIG)
+    parser.add_argument("--check", action="store_true", help="compare with files on disk")
+    parser.add_argument("--selftest", action="store_true", help="run rejection tests")
+    args = parser.parse_args()
+
+    path = args.config if os.path.isabs(args.config) else os.path.join(ROOT, args.config)
+    with open(path, encoding="utf-8") as f:
+        desc = json.load(f)
+
+    try:
+        if args.selftest:
+            return selftest(desc)
+        files = generate(desc)
+    except ConfigError as err:
+        print("%s: error: %s" % (os.path.relpath(path, ROOT), err), file=sys.stderr)
+        return 1
+
+    stale = 0
+    for rel, text in files.items():
+        target = os.path.join(ROOT, rel)
+        old = None
+        if os.path.exists(target):
+            with open(target, encoding="utf-8") as f:
+                old = f.read()
+        if old == text:
+            continue
+        if args.check:
+            print("%s is out of date, run make config" % rel, file=sys.stderr)
+            stale += 1
+        else:
+            with open(target, "w", encoding="utf-8", newline="\n") as f:
+                f.write(text)
+            print("wrote %s" % rel)
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
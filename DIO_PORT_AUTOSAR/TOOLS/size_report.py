@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file    size_report.py
+@brief   Báo cáo flash/RAM theo từng hàm của libmcal.a hoặc firmware ELF
+@details Đọc bảng ký hiệu bằng nm (-S: có kích thước, -l: file nguồn) và
+         xếp mỗi ký hiệu vào flash hay RAM theo loại section:
+           T/t/W/w  mã           -> flash
+           R/r      hằng         -> flash
+           D/d/G/g  biến khởi tạo -> flash (ảnh nạp) + RAM
+           B/b/S/s/C biến zero    -> RAM
+         Module là file .o trong thư viện, hoặc file .c chứa ký hiệu (theo
+         thông tin debug) với ELF.
+
+         Có --baseline FILE: so với lần đo trước, mã thoát 1 nếu có hàm
+         lớn hơn mốc quá --tolerance byte (hàm mới tính cả kích thước).
+
+         python3 TOOLS/size_report.py --nm gcc-nm BUILD/MCAL/host-size/libmcal.a
+         python3 TOOLS/size_report.py --nm arm-none-eabi-gcc-nm BUILD/test.elf \\
+                 --write-baseline size.txt
+@version 1.0
+@date    2026-10-18
+@author  HALA Academy
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# Loại ký hiệu của nm -> (tính vào flash, tính vào RAM, nhóm)
+SYMBOL_KINDS = {
+    "T": (True, False, "code"), "W": (True, False, "code"),
+    "R": (True, False, "const"),
+    "D": (True, True, "data"), "G": (True, True, "data"), "V": (True, True, "data"),
+    "B": (False, True, "bss"), "S": (False, True, "bss"), "C": (False, True, "bss"),
+}
+
+MEMBER_RE = re.compile(r"^(?:.*\()?([^()]+?\.o)\)?:$")
+
+
+# ===============================
+#   Đọc bảng ký hiệu
+# ===============================
+
+def read_symbols(nm, path):
+    """Trả về dict (module, ký hiệu) -> [flash, ram, nhóm]."""
+    try:
+        out = subprocess.run([nm, "-S", "-l", "-t", "d", "--defined-only", path],
+                             check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as err:
+        raise SystemExit("size_report: cannot run %s on %s: %s" % (nm, path, err))
+
+    default_module = os.path.splitext(os.path.basename(path))[0]
+    member = None
+    symbols = {}
+    for line in out.splitlines():
+        if not line.strip():
+            continue
+        m = MEMBER_RE.match(line)
+        if m:
+            member = os.path.splitext(m.group(1))[0]
+            continue
+        where = None
+        if "\t" in line:
+            line, where = line.split("\t", 1)
+        fields = line.split()
+        if len(fields) != 4:
+            continue  # ký hiệu không có kích thước (nhãn, section)
+        size, kind, name = int(fields[1]), fields[2], fields[3]
+        flags = SYMBOL_KINDS.get(kind.upper())
+        if flags is None or size == 0:
+            continue
+        module = member
+        if module is None:
+            module = default_module
+            if where:
+                module = os.path.splitext(os.path.basename(where.rsplit(":", 1)[0]))[0]
+        entry = symbols.setdefault((module, name), [0, 0, flags[2]])
+        entry[0] += size if flags[0] else 0
+        entry[1] += size if flags[1] else 0
+    return symbols
+
+
+def read_baseline(path):
+    base = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            if line.startswith("#") or not line.strip():
+                continue
+            module, name, flash, ram = line.split()
+            base[(module, name)] = (int(flash), int(ram))
+    return base
+
+
+def write_baseline(path, symbols, source):
+    folder = os.path.dirname(path)
+    if folder:
+        os.makedirs(folder, exist_ok=True)
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("# size_report baseline: %s\n# module symbol flash ram\n" % source)
+        for (module, name), (flash, ram, _) in sorted(symbols.items()):
+            f.write("%s %s %d %d\n" % (module, name, flash, ram))
+
+
+# ===============================
+#   Báo cáo
+# ===============================
+
+def print_report(symbols, source):
+    print("size report: %s" % source)
+    print("%-20s %-36s %-5s %7s %7s" % ("module", "symbol", "kind", "flash", "ram"))
+    modules = {}
+    for (module, name), (flash, ram, group) in sorted(
+            symbols.items(), key=lambda item: (item[0][0], -item[1][0], item[0][1])):
+        print("%-20s %-36s %-5s %7d %7d" % (module, name, group, flash, ram))
+        total = modules.setdefault(module, [0, 0])
+        total[0] += flash
+        total[1] += ram
+
+    print("\n%-20s %7s %7s" % ("module", "flash", "ram"))
+    for module, (flash, ram) in sorted(modules.items(), key=lambda item: -item[1][0]):
+        print("%-20s %7d %7d" % (module, flash, ram))
+    print("%-20s %7d %7d" % ("TOTAL",
+                             sum(t[0] for t in modules.values()),
+                             sum(t[1] for t in modules.values())))
+
+
+def compare(symbols, base, tolerance):
+    """In các thay đổi so với mốc, trả về số hàm vượt tolerance."""
+    grown = 0
+    changes = []
+    for key in sorted(set(symbols) | set(base)):
+        new = symbols.get(key, (0, 0))[:2]
+        old = base.get(key, (0, 0))
+        if tuple(new) == tuple(old):
+            continue
+        delta = (new[0] - old[0], new[1] - old[1])
+        tag = "new" if key not in base else "gone" if key not in symbols else "changed"
+        bad = delta[0] > tolerance or delta[1] > tolerance
+        grown += 1 if bad else 0
+        changes.append("%s %-20s %-36s %-7s flash %+6d  ram %+6d" %
+                       ("REGRESSION" if bad else "          ", key[0], key[1], tag,
+                        delta[0], delta[1]))
+
+    old_flash = sum(v[0] for v in base.values())
+    old_ram = sum(v[1] for v in base.values())
+    new_flash = sum(v[0] for v in symbols.values())
+    new_ram = sum(v[1] for v in symbols.values())
+    print("\nbaseline: flash %d -> %d (%+d), ram %d -> %d (%+d)" %
+          (old_flash, new_flash, new_flash - old_flash, old_ram, new_ram, new_ram - old_ram))
+    for text in changes:
+        print(text)
+    return grown
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Per-function flash/RAM size report")
+    parser.add_argument("input", help="static library (.a), object or ELF file")
+    parser.add_argument("--nm", default="nm", help="nm of the matching toolchain")
+    parser.add_argument("--baseline", help="fail if a symbol grew compared to this file")
+    parser.add_argument("--write-baseline", help="store the current sizes as baseline")
+    parser.add_argument("--tolerance", type=int, default=0, help="allowed growth in bytes")
+    args = parser.parse_args()
+
+    symbols = read_symbols(args.nm, args.input)
+    print_report(symbols, args.input)
+
+    if args.write_baseline:
+        write_baseline(args.write_baseline, symbols, args.input)
+        print("wrote %s" % args.write_baseline)
+        return 0
+
+    if args.baseline:
+        if not os.path.exists(args.baseline):
+            print("\nno baseline %s (make size_baseline)" % args.baseline)
+            return 0
+        grown = compare(symbols, read_baseline(args.baseline), args.tolerance)
+        if grown:
+            print("%d symbol(s) grew by more than %d byte(s)" % (grown, args.tolerance),
+                  file=sys.stderr)
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,135 @@
+# =========================================================
+#  mcal.mk - thư viện MCAL dùng chung (libmcal.a)
+#
+#  Dio/Port/Pwm/Clk/Tm + SPL + system_stm32f10x được build một
+#  lần thành thư viện tĩnh; mỗi dự án mẫu chỉ giữ phần của riêng
+#  nó (main.c, syscall.c, cấu hình Portconfig/Pwm_Lcfg/Dio_Lcfg, linker.ld):
+#
+#      include ../DIO_PORT_AUTOSAR/mcal.mk
+#      OBJ = $(SRC:.c=.o) $(MCAL_STARTUP)
+#      $(OUT): $(OBJ) $(MCAL_ARM_LIB)
+#
+#  Startup (bảng vector đầy đủ của STM32F10x medium density) cũng đi
+#  kèm thư viện: SysTick_Handler của Tm, EXTI của Dio_Edge, DMA1 của
+#  Dio_Stream/Dio_Capture chỉ có vector qua bảng này.
+#
+#  Biến chọn cách build:
+#      PROFILE = debug (-O0, mặc định) | size (-Os) | speed (-O2)
+#      LTO     = 1  -> -flto: hàm nhỏ của SPL (GPIO_SetBits, TIM_ITConfig...)
+#                    được inline vào driver lúc link
+#      DEV_ERROR_DETECT = STD_ON | STD_OFF (Det của Port/Pwm)
+#
+#  Mỗi tổ hợp có thư mục riêng BUILD/MCAL/<arm|host>-<biến thể>/
+#  nên đổi PROFILE/LTO không cần clean.
+# =========================================================
+
+MCAL_DIR := $(patsubst %/,%,$(dir $(lastword $(MAKEFILE_LIST))))
+
+# Không để target của file này thành mục tiêu mặc định của dự án include nó
+MCAL_SAVED_GOAL := $(.DEFAULT_GOAL)
+
+PROFILE ?= debug
+LTO ?= 0
+DEV_ERROR_DETECT ?= STD_ON
+
+# Nguồn của thư viện (tương đối với MCAL_DIR). Không chứa cấu hình
+# của dự án: Portconfig.c, Pwm_Lcfg.c, Pwm_Cbk.c, Dio_Lcfg.c, Dio_Cbk.c
+# nằm phía ứng dụng; Dio_Cfg.c chỉ giữ bảng tra theo MCU.
+MCAL_SRC = SRC/Dio.c SRC/Dio_Cfg.c SRC/Dio_Stream.c SRC/Dio_Capture.c SRC/Dio_Debounce.c \
+	SRC/Dio_Edge.c SRC/Dio_Bus.c SRC/Dio_BitBang.c SRC/Tm.c SRC/Clk.c SRC/Port.c SRC/Pwm.c \
+	SRC/stm32f10x_gpio.c SRC/stm32f10x_rcc.c SRC/stm32f10x_tim.c SRC/stm32f10x_dma.c \
+	SRC/stm32f10x_exti.c SRC/misc.c SRC/system_stm32f10x.c
+
+MCAL_INC = -I$(MCAL_DIR)/INC -I$(MCAL_DIR)/LIB
+MCAL_DEFS = -DSTM32F10X_MD -DUSE_STDPERIPH_DRIVER \
+	-DPORT_DEV_ERROR_DETECT=$(DEV_ERROR_DETECT) -DPWM_DEV_ERROR_DETECT=$(DEV_ERROR_DETECT)
+
+# Mức tối ưu theo profile
+MCAL_OPT_debug = -O0 -g
+MCAL_OPT_size = -Os -g
+MCAL_OPT_speed = -O2 -g
+ifeq ($(MCAL_OPT_$(PROFILE)),)
+$(error PROFILE=$(PROFILE) khong hop le (debug | size | speed))
+endif
+
+# -ffat-lto-objects: object trong thư viện vẫn có mã máy, nm/size_report
+# đọc được kích thước hàm kể cả khi bật LTO
+MCAL_LTO = $(if $(filter 1,$(LTO)),-flto -ffat-lto-objects)
+MCAL_OPT = $(MCAL_OPT_$(PROFILE)) -ffunction-sections -fdata-sections $(MCAL_LTO)
+
+MCAL_VARIANT = $(PROFILE)$(if $(filter 1,$(LTO)),-lto)$(if $(filter STD_OFF,$(DEV_ERROR_DETECT)),-nodet)
+
+# Cross (arm-none-eabi). gcc-ar: ar có plugin LTO
+MCAL_ARM_CC = arm-none-eabi-gcc
+MCAL_ARM_AR = arm-none-eabi-gcc-ar
+MCAL_ARM_NM = arm-none-eabi-gcc-nm
+MCAL_ARM_CFLAGS = -mcpu=cortex-m3 -mthumb -std=c11 -Wall $(MCAL_OPT) $(MCAL_INC) $(MCAL_DEFS)
+MCAL_ARM_DIR = $(MCAL_DIR)/BUILD/MCAL/arm-$(MCAL_VARIANT)
+MCAL_ARM_OBJ = $(patsubst %.c,$(MCAL_ARM_DIR)/%.o,$(MCAL_SRC))
+MCAL_ARM_LIB = $(MCAL_ARM_DIR)/libmcal.a
+# Object riêng, không nằm trong .a: linker không kéo member chỉ có .isr_vector
+MCAL_STARTUP = $(MCAL_ARM_DIR)/STARTUP/startup_stm32f10x_md.o
+
+# Host (Linux x86-64, gcc): cùng mã nguồn, chạy trên mô hình thanh ghi HOST/
+MCAL_HOST_CC = gcc
+MCAL_HOST_AR = gcc-ar
+MCAL_HOST_NM = gcc-nm
+MCAL_HOST_CFLAGS = -std=gnu11 -Wall $(MCAL_OPT) $(MCAL_INC) $(MCAL_DEFS) -fno-pie \
+	-Wno-int-to-pointer-cast -Wno-pointer-to-int-cast
+MCAL_HOST_DIR = $(MCAL_DIR)/BUILD/MCAL/host-$(MCAL_VARIANT)
+MCAL_HOST_OBJ = $(patsubst %.c,$(MCAL_HOST_DIR)/%.o,$(MCAL_SRC))
+MCAL_HOST_LIB = $(MCAL_HOST_DIR)/libmcal.a
+
+$(MCAL_ARM_LIB): $(MCAL_ARM_OBJ)
+	rm -f $@
+	$(MCAL_ARM_AR) rcs $@ $^
+
+$(MCAL_ARM_DIR)/%.o: $(MCAL_DIR)/%.c
+	@mkdir -p $(dir $@)
+	$(MCAL_ARM_CC) $(MCAL_ARM_CFLAGS) -MMD -MP -c $< -o $@
+
+$(MCAL_STARTUP): $(MCAL_DIR)/STARTUP/startup_stm32f10x_md.s
+	@mkdir -p $(dir $@)
+	$(MCAL_ARM_CC) $(MCAL_ARM_CFLAGS) -c $< -o $@
+
+$(MCAL_HOST_LIB): $(MCAL_HOST_OBJ)
+	rm -f $@
+	$(MCAL_HOST_AR) rcs $@ $^
+
+$(MCAL_HOST_DIR)/%.o: $(MCAL_DIR)/%.c
+	@mkdir -p $(dir $@)
+	$(MCAL_HOST_CC) $(MCAL_HOST_CFLAGS) -MMD -MP -c $< -o $@
+
+# Phụ thuộc header (.d cạnh .o): sửa INC/Dio_Cfg.h, Port.h... thì object
+# liên quan build lại, libmcal.a không giữ layout struct cũ
+-include $(MCAL_ARM_OBJ:.o=.d) $(MCAL_HOST_OBJ:.o=.d)
+
+mcal: $(MCAL_ARM_LIB) $(MCAL_STARTUP)
+
+mcal_host: $(MCAL_HOST_LIB)
+
+mcal_clean:
+	rm -rf $(MCAL_DIR)/BUILD/MCAL
+
+# Báo cáo flash/RAM theo từng hàm (TOOLS/size_report.py).
+#   SIZE_INPUT    : file ELF hoặc .a cần đo (mặc định libmcal.a host)
+#   SIZE_NM       : nm tương ứng (arm-none-eabi-gcc-nm cho bản cross)
+#   SIZE_BASELINE : file mốc; size_report báo lỗi nếu hàm nào lớn hơn mốc
+#                   quá SIZE_TOLERANCE byte
+PYTHON ?= python3
+SIZE_INPUT ?= $(MCAL_HOST_LIB)
+SIZE_NM ?= $(MCAL_HOST_NM)
+SIZE_BASELINE ?= $(SIZE_INPUT).baseline
+SIZE_TOLERANCE ?= 0
+
+size_report: $(SIZE_INPUT)
+	$(PYTHON) $(MCAL_DIR)/TOOLS/size_report.py --nm $(SIZE_NM) \
+		--baseline $(SIZE_BASELINE) --tolerance $(SIZE_TOLERANCE) $(SIZE_INPUT)
+
+size_baseline: $(SIZE_INPUT)
+	$(PYTHON) $(MCAL_DIR)/TOOLS/size_report.py --nm $(SIZE_NM) \
+		--write-baseline $(SIZE_BASELINE) $(SIZE_INPUT)
+
+.DEFAULT_GOAL := $(MCAL_SAVED_GOAL)
+
+.PHONY: mcal mcal_host mcal_clean size_report size_baseline
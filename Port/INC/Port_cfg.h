@@ -26,4 +26,7 @@
  **********************************************************/
 extern const Port_PinConfigType PortCfg_Pins[PortCfg_PinsCount];
 
+/* Cấu hình tổng truyền cho Port_Init (ảnh thanh ghi do Port_Init tự dựng) */
+extern const Port_ConfigType PortCfg_Config;
+
 #endif /* PORT_CFG_H */
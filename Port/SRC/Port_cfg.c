@@ -0,0 +1,97 @@
+/**********************************************************
+ * @file    Port_cfg.c
+ * @brief   Port Driver Configuration Source File
+ * @details File này chứa phần hiện thực các tham số cấu hình 
+ *          cho từng chân Port của driver Port theo chuẩn AUTOSAR,
+ *          dùng cho STM32F103.
+ *
+ * @version 1.0
+ * @date    2024-06-19
+ * @author  HALA Academy & ChatGPT
+ **********************************************************/
+
+#include "Port_cfg.h"
+#include <stddef.h>
+
+/**********************************************************
+ * Cấu hình chi tiết cho từng chân GPIO (kiểu của libmcal, Port.h)
+ * - PortNum:   PORT_ID_A, PORT_ID_B, PORT_ID_C, ...
+ * - PinNum:    Số thứ tự chân trong port (0-15)
+ * - Mode:      PORT_PIN_MODE_DIO, ...
+ * - Speed:     PORT_SPEED_2Mhz / 10Mhz / 50Mhz
+ * - Direction: PORT_PIN_OUT / PORT_PIN_IN
+ * - DirectionChangeable: 1 = Cho phép đổi chiều runtime
+ * - Level:     PORT_PIN_LEVEL_HIGH / PORT_PIN_LEVEL_LOW
+ * - Pull:      PORT_PIN_PULL_NONE / UP / DOWN
+ * - ModeChangeable: 1 = Cho phép đổi mode runtime
+ * - SleepKeep, SafeState: trạng thái ở PORT_PROFILE_SLEEP / SAFE
+ * Trường đi qua PORT_CFG_xxx: giá trị ngoài miền dừng biên dịch.
+ **********************************************************/
+
+const Port_PinConfigType PortCfg_Pins[PortCfg_PinsCount] = {
+    /* PA0: DIO, Output, Được phép đổi chiều & mode runtime, mặc định HIGH, không pull */
+    {
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(0),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_DIO),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_2Mhz),
+        .Direction           = PORT_PIN_OUT,
+        .DirectionChangeable = 1,
+        .Level               = PORT_PIN_LEVEL_HIGH,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 1,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_ANALOG)
+    },
+    /* PA1: DIO, Input, Không đổi chiều, pull-up */
+    {
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(1),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_DIO),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_2Mhz),
+        .Direction           = PORT_PIN_IN,
+        .DirectionChangeable = 0,
+        .Level               = PORT_PIN_LEVEL_LOW, /* Không ảnh hưởng nếu là input */
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_UP),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_ANALOG)
+    },
+    /* PB0: DIO, Output, Không đổi chiều, mặc định LOW, không pull */
+    {
+        .PortNum             = PORT_CFG_PORT(PORT_ID_B),
+        .PinNum              = PORT_CFG_PIN(0),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_DIO),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_2Mhz),
+        .Direction           = PORT_PIN_OUT,
+        .DirectionChangeable = 0,
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_ANALOG)
+    },
+    /* PC13: DIO, Input, Được phép đổi mode runtime, pull-down */
+    {
+        .PortNum             = PORT_CFG_PORT(PORT_ID_C),
+        .PinNum              = PORT_CFG_PIN(13),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_DIO),
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_2Mhz),
+        .Direction           = PORT_PIN_IN,
+        .DirectionChangeable = 1,
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_DOWN),
+        .ModeChangeable      = 1, // có phép đổi sang chế độ khác hay k (DIO - Analog)
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_ANALOG)
+    }
+    /* ... Thêm cấu hình cho các chân khác tại đây ... */
+};
+
+const Port_ConfigType PortCfg_Config = {
+    .PinConfigs = PortCfg_Pins,
+    .PinCount   = PortCfg_PinsCount,
+    .Images     = NULL,              /* Port_Init dựng ảnh CRL/CRH/ODR từ PortCfg_Pins */
+    .Remap      = PORT_REMAP_NONE,
+    .SwjCfg     = PORT_SWJ_FULL
+};
@@ -0,0 +1,26 @@
+#include "stm32f10x_rcc.h"          
+#include "stm32f10x.h"       
+#include "stm32f10x_gpio.h" 
+#include "Dio.h"
+#include "Port.h"
+#include "Port_cfg.h"
+#include "Tm.h"
+
+/* Chờ bận theo DWT CYCCNT, không chiếm TIM2 của ứng dụng */
+void delay_ms(uint32_t time)
+{
+	Tm_BusyWaitUs(time * 1000U);
+}
+
+
+int main(void) {
+	Tm_Init();
+	Port_Init(&PortCfg_Config);
+	while (1) {
+	Port_SetPinDirection(3, PORT_PIN_IN); // Đặt chân C13 là OUTPUT
+	//DIO_FlipChannel(DIO_CHANNEL_C13); // Đảo trạng thái chân PA0
+	//Port_RefreshPortDirection();
+	Port_RefreshPortDirection(); // Làm tươi lại chiều các chân không cho đổi runtime
+	delay_ms(500); // Đợi 500ms
+    }
+}
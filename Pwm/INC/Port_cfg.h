@@ -1,15 +1,12 @@
 /**********************************************************
  * @file    Port_cfg.h
  * @brief   Port Driver Configuration Header File
- * @details File này chứa các định nghĩa cấu hình các chân Port 
- *          cho driver Port theo chuẩn AUTOSAR, dùng trên 
- *          STM32F103 với thư viện SPL.
- *
+ * @details Cấu hình chân (Port) của ví dụ PWM, dùng kiểu dữ liệu và
+ *          macro PORT_xxx của Port Driver trong libmcal (Port.h).
  * @version 1.0
- * @date    2024-06-19
+ * @date    2024-06-27
  * @author  HALA Academy
  **********************************************************/
-
 #ifndef PORT_CFG_H
 #define PORT_CFG_H
 
@@ -18,7 +15,7 @@
 /**********************************************************
  * Số lượng chân Port được cấu hình (tùy chỉnh theo dự án)
  **********************************************************/
-#define PortCfg_PinsCount    4U
+#define PortCfg_PinsCount    2U
 
 /**********************************************************
  * Mảng cấu hình chi tiết cho từng chân GPIO
@@ -26,4 +23,7 @@
  **********************************************************/
 extern const Port_PinConfigType PortCfg_Pins[PortCfg_PinsCount];
 
+/* Cấu hình tổng truyền cho Port_Init (ảnh thanh ghi do Port_Init tự dựng) */
+extern const Port_ConfigType PortCfg_Config;
+
 #endif /* PORT_CFG_H */
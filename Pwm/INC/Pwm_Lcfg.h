@@ -11,6 +11,9 @@
 
 #include "Pwm.h"
 
+/* Callback notification của kênh 0 (Pwm_Lcfg.c) */
+void Pwm_Channel0_Notification(void);
+
 /**********************************************************
  * @brief   Biến cấu hình tổng cho PWM Driver
  **********************************************************/
@@ -0,0 +1,56 @@
+/**********************************************************
+ * @file    Port_cfg.c
+ * @brief   Port Driver Configuration Source File
+ * @details File này chứa cấu hình từng chân (Port) cho hệ thống AUTOSAR,
+ *          ví dụ này chỉ cấu hình 2 chân dùng cho PWM trên STM32F103.
+ * @version 1.0
+ * @date    2024-06-27
+ * @author  HALA Academy
+ **********************************************************/
+
+#include "Port_cfg.h"
+#include <stddef.h>
+
+/**********************************************************
+ * Cấu hình chi tiết cho các chân sử dụng trong hệ thống
+ * - PA0:  PWM output (TIM2_CH1) - Alternate Function Push-Pull
+ * - PA7:  PWM output (TIM3_CH2) - Alternate Function Push-Pull
+ **********************************************************/
+const Port_PinConfigType PortCfg_Pins[PortCfg_PinsCount] = {
+    /* PA0 - TIM2_CH1 - PWM Output */
+    {
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(0),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_PWM),   // Alternate Function Push-Pull
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_50Mhz),
+        .Direction           = PORT_PIN_OUT,
+        .DirectionChangeable = 0,
+        .Level               = PORT_PIN_LEVEL_LOW,                 // Không quan trọng với AF_PP
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_LOW)
+    },
+    /* PA7 - TIM3_CH2 - PWM Output */
+    {
+        .PortNum             = PORT_CFG_PORT(PORT_ID_A),
+        .PinNum              = PORT_CFG_PIN(7),
+        .Mode                = PORT_CFG_MODE(PORT_PIN_MODE_PWM),   // Alternate Function Push-Pull
+        .Speed               = PORT_CFG_SPEED(PORT_SPEED_50Mhz),
+        .Direction           = PORT_PIN_OUT,
+        .DirectionChangeable = 0,
+        .Level               = PORT_PIN_LEVEL_LOW,
+        .Pull                = PORT_CFG_PULL(PORT_PIN_PULL_NONE),
+        .ModeChangeable      = 0,
+        .SleepKeep           = 0,
+        .SafeState           = PORT_CFG_SAFE(PORT_SAFE_LOW)
+    }
+};
+
+const Port_ConfigType PortCfg_Config = {
+    .PinConfigs = PortCfg_Pins,
+    .PinCount   = PortCfg_PinsCount,
+    .Images     = NULL,              /* Port_Init dựng ảnh CRL/CRH/ODR từ PortCfg_Pins */
+    .Remap      = PORT_REMAP_NONE,   /* TIM2_CH1 = PA0, TIM3_CH2 = PA7: mặc định */
+    .SwjCfg     = PORT_SWJ_FULL
+};
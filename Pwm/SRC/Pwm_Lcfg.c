@@ -7,8 +7,8 @@
  * @author  HALA Academy
  **********************************************************/
 
-#include "Pwm.h"
-#include <stdio.h> // Nếu muốn test bằng printf hoặc debug trong callback
+#include "Pwm_Lcfg.h"
+#include <stddef.h>
 
 /* ==== Ví dụ hàm callback cho PWM notification ==== */
 void Pwm_Channel0_Notification(void)
@@ -22,25 +22,25 @@ void Pwm_Channel0_Notification(void)
 }
 
 /* ==== Cấu hình từng kênh PWM ==== */
-const Pwm_ChannelConfigType PwmChannelsConfig[] = {
+static const Pwm_ChannelConfigType PwmChannelsConfig[] = {
     /* Channel 0: PA0 - TIM2_CH1, có callback */
     {
-        .TIMx             = TIM2,
-        .channel          = 1,
+        PWM_CFG_CH(2, 1),                 /* .TIMx, .channel, .ccr */
         .classType        = PWM_VARIABLE_PERIOD,
-        .defaultPeriod    = 999,          // 1ms (72MHz/72/1000)
-        .defaultDutyCycle = 0x0000,       // Duty 0%
+        .prescaler        = 0,
+        .defaultPeriod    = 999,          // 72 kHz (72MHz/1000)
+        .defaultDutyCycle = PWM_CFG_DUTY(0x0000),   // Duty 0%
         .polarity         = PWM_HIGH,
         .idleState        = PWM_LOW,
         .NotificationCb   = Pwm_Channel0_Notification   // Callback không NULL!
     },
     /* Channel 1: PA7 - TIM3_CH2, không dùng callback */
     {
-        .TIMx             = TIM3,
-        .channel          = 2,
+        PWM_CFG_CH(3, 2),                 /* .TIMx, .channel, .ccr */
         .classType        = PWM_VARIABLE_PERIOD,
+        .prescaler        = 0,
         .defaultPeriod    = 999,
-        .defaultDutyCycle = 0x0000,
+        .defaultDutyCycle = PWM_CFG_DUTY(0x0000),
         .polarity         = PWM_HIGH,
         .idleState        = PWM_LOW,
         .NotificationCb   = NULL
@@ -50,5 +50,5 @@ const Pwm_ChannelConfigType PwmChannelsConfig[] = {
 /* ==== Cấu hình tổng PWM driver ==== */
 const Pwm_ConfigType PwmDriverConfig = {
     .Channels    = PwmChannelsConfig,
-    .NumChannels = sizeof(PwmChannelsConfig) / sizeof(Pwm_ChannelConfigType)
+    .NumChannels = PWM_CFG_COUNT(PwmChannelsConfig)
 };
@@ -9,25 +9,21 @@
 #include "Port_cfg.h"
 #include "Pwm.h"
 #include "Pwm_Lcfg.h"
+#include "Tm.h"
 #include <stdint.h>
 
-/* Hàm delay đơn giản cho test (blocking) */
+/* Hàm delay cho test (blocking, DWT CYCCNT - không dùng TIM2/TIM3 của PWM) */
 static void DelayMs(uint32_t ms)
 {
-    volatile uint32_t n;
-    for (; ms > 0; ms--) {
-        for (n = 0; n < 8000; n++) __NOP();
-    }
+    Tm_BusyWaitUs(ms * 1000U);
 }
 
 int main(void)
 {
+    Tm_Init();
+
     /* ==== 1. Khởi tạo cấu hình Port chuẩn AUTOSAR ==== */
-    Port_ConfigType portConfig = {
-        .PinConfigs = PortCfg_Pins,
-        .PinCount   = PortCfg_PinsCount
-    };
-    Port_Init(&portConfig);
+    Port_Init(&PortCfg_Config);
 
     /* ==== 2. Khởi tạo PWM ==== */
     Pwm_Init(&PwmDriverConfig);
@@ -1,24 +0,0 @@
-
-/*
- * Auto generated Run-Time-Environment Component Configuration File
- *      *** Do not modify ! ***
- *
- * Project: 'ButtonLed' 
- * Target:  'Target 1' 
- */
-
-#ifndef RTE_COMPONENTS_H
-#define RTE_COMPONENTS_H
-
-
-/*
- * Define the Device Header File: 
- */
-#define CMSIS_device_header "stm32f10x.h"
-
-#define RTE_DEVICE_STDPERIPH_FRAMEWORK
-#define RTE_DEVICE_STDPERIPH_GPIO
-#define RTE_DEVICE_STDPERIPH_RCC
-#define RTE_DEVICE_STDPERIPH_TIM
-
-#endif /* RTE_COMPONENTS_H */